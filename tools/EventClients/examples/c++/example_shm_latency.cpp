@@ -0,0 +1,70 @@
+/* Measures the latency of the local (shared memory) event transport.
+
+   Every iteration queues a batch of analog stick events, wakes up the event
+   server once and waits until the server has handed all of them to its
+   clients, which is where CInputManager picks them up on the next frame.
+
+   usage: example_shm_latency [iterations] [events per batch] */
+
+#include "../../lib/c++/xbmcclient_shm.h"
+
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+int main(int argc, char **argv)
+{
+  int iterations = argc > 1 ? atoi(argv[1]) : 1000;
+  int batch = argc > 2 ? atoi(argv[2]) : 8;
+  if (iterations <= 0 || batch <= 0)
+  {
+    printf("usage: %s [iterations] [events per batch]\n", argv[0]);
+    return -1;
+  }
+
+  CXBMCClientShm client;
+  if (!client.Open())
+  {
+    printf("Could not attach to the local event server, is Kodi running?\n");
+    return -1;
+  }
+
+  CPacketHELO helo("Latency Benchmark", ICON_NONE);
+  client.Send(helo);
+  client.WaitUntilConsumed(1000);
+
+  std::vector<double> latencies;
+  latencies.reserve(iterations);
+
+  for (int i = 0; i < iterations; i++)
+  {
+    auto start = std::chrono::steady_clock::now();
+    for (int j = 0; j < batch; j++)
+    {
+      // sweep the left stick, axis events are never repeated by the server
+      CPacketBUTTON axis(1, "JS0:Latency Benchmark", BTN_USE_AMOUNT | BTN_AXIS | BTN_NO_REPEAT,
+                         (unsigned short)((i * batch + j) % 65536));
+      client.Queue(axis);
+    }
+    client.Flush();
+    if (!client.WaitUntilConsumed(1000))
+    {
+      printf("Timeout waiting for the event server\n");
+      return -1;
+    }
+    auto end = std::chrono::steady_clock::now();
+    latencies.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+  }
+
+  CPacketBYE bye;
+  client.Send(bye);
+  client.Close();
+
+  std::sort(latencies.begin(), latencies.end());
+  printf("%d batches of %d events\n", iterations, batch);
+  printf("latency p50 %.1f us, p99 %.1f us, max %.1f us\n", latencies[latencies.size() / 2],
+         latencies[latencies.size() * 99 / 100], latencies.back());
+  return 0;
+}
@@ -199,10 +199,26 @@ public:
   virtual ~CPacket() = default;
 
   bool Send(int Socket, CAddress &Addr, unsigned int UID = XBMCClientUtils::GetUniqueIdentifier())
+  {
+    bool SendSuccessful = true;
+    std::vector<std::vector<char> > Datagrams;
+    Serialize(Datagrams, UID);
+    for (const std::vector<char> &Datagram : Datagrams)
+    {
+      int rtn = sendto(Socket, Datagram.data(), Datagram.size(), 0, Addr.GetAddress(), sizeof(struct sockaddr));
+
+      if (rtn != (int)Datagram.size())
+        SendSuccessful = false;
+    }
+    return SendSuccessful;
+  }
+
+  /* Split the packet into wire format datagrams (header + payload chunk),
+     as sent over UDP or pushed into a local shared memory ring. */
+  void Serialize(std::vector<std::vector<char> > &Datagrams, unsigned int UID = XBMCClientUtils::GetUniqueIdentifier())
   {
     if (m_Payload.empty())
       ConstructPayload();
-    bool SendSuccessful = true;
     int NbrOfPackages = (m_Payload.size() / MAX_PAYLOAD_SIZE) + 1;
     int Send = 0;
     int Sent = 0;
@@ -221,22 +237,18 @@ public:
       }
 
       ConstructHeader(m_PacketType, NbrOfPackages, Package, Send, UID, m_Header);
-      char t[MAX_PACKET_SIZE];
+      std::vector<char> t(HEADER_SIZE + Send);
       int i, j;
-      for (i = 0; i < 32; i++)
+      for (i = 0; i < HEADER_SIZE; i++)
         t[i] = m_Header[i];
 
       for (j = 0; j < Send; j++)
-        t[(32 + j)] = m_Payload[j + Sent];
+        t[(HEADER_SIZE + j)] = m_Payload[j + Sent];
 
-      int rtn = sendto(Socket, t, (32 + Send), 0, Addr.GetAddress(), sizeof(struct sockaddr));
-
-      if (rtn != (32 + Send))
-        SendSuccessful = false;
+      Datagrams.push_back(t);
 
       Sent += Send;
     }
-    return SendSuccessful;
   }
 protected:
   char            m_Header[HEADER_SIZE];
@@ -0,0 +1,257 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+/* Local (shared memory) transport for event clients running on the same
+   Linux host as Kodi. Packets are the very same CPacket classes as used
+   over UDP, but they are pushed into a single producer / single consumer
+   ring instead of being sent to a socket. Several packets can be queued and
+   delivered with a single wakeup of the event server:
+
+     CXBMCClientShm client;
+     if (client.Open())
+     {
+       CPacketHELO helo("My Remote", ICON_NONE);
+       client.Send(helo);
+
+       CPacketBUTTON x(1, "JS0:My Stick", BTN_USE_AMOUNT | BTN_AXIS | BTN_NO_REPEAT, 1000);
+       CPacketBUTTON y(2, "JS0:My Stick", BTN_USE_AMOUNT | BTN_AXIS | BTN_NO_REPEAT, 2000);
+       client.Queue(x);
+       client.Queue(y);
+       client.Flush();
+     }
+
+   The shared memory layout must match xbmc/network/EventRing.h. */
+
+#include "xbmcclient.h"
+
+#include <atomic>
+#include <chrono>
+#include <stdint.h>
+#include <thread>
+
+#include <fcntl.h>
+#include <semaphore.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define SHM_SEGMENT_NAME   "/kodi-eventserver"
+#define SHM_RING_ALIGNMENT 64
+
+struct XBMCShmSegment
+{
+  char      magic[4];
+  uint32_t  version;
+  uint32_t  ringCount;
+  uint32_t  ringCapacity;
+  int32_t   serverPid;
+  sem_t     wakeup;
+};
+
+struct XBMCShmRing
+{
+  std::atomic<int32_t> owner;
+  alignas(SHM_RING_ALIGNMENT) std::atomic<uint64_t> head;
+  alignas(SHM_RING_ALIGNMENT) std::atomic<uint64_t> tail;
+};
+
+class CXBMCClientShm
+{
+private:
+  void           *m_Memory;
+  size_t          m_Size;
+  XBMCShmSegment *m_Segment;
+  XBMCShmRing    *m_Ring;
+  uint8_t        *m_Data;
+  unsigned int    m_UID;
+  bool            m_Pending;
+
+  static size_t Align(size_t Size)
+  {
+    return (Size + SHM_RING_ALIGNMENT - 1) & ~(size_t)(SHM_RING_ALIGNMENT - 1);
+  }
+
+  void Write(uint64_t Pos, const char *Data, size_t Size)
+  {
+    const uint32_t Capacity = m_Segment->ringCapacity;
+    for (size_t i = 0; i < Size; i++)
+      m_Data[(Pos + i) & (Capacity - 1)] = Data[i];
+  }
+
+  bool Push(const std::vector<char> &Datagram)
+  {
+    const uint16_t Size = Datagram.size();
+    const uint64_t Head = m_Ring->head.load(std::memory_order_relaxed);
+    const uint64_t Tail = m_Ring->tail.load(std::memory_order_acquire);
+    if (m_Segment->ringCapacity - (Head - Tail) < sizeof(Size) + Size)
+      return false;
+
+    Write(Head, (const char *)&Size, sizeof(Size));
+    Write(Head + sizeof(Size), Datagram.data(), Size);
+    m_Ring->head.store(Head + sizeof(Size) + Size, std::memory_order_release);
+    return true;
+  }
+
+public:
+  CXBMCClientShm(unsigned int UID = 0)
+  {
+    m_Memory = NULL;
+    m_Size = 0;
+    m_Segment = NULL;
+    m_Ring = NULL;
+    m_Data = NULL;
+    m_Pending = false;
+
+    if (UID)
+      m_UID = UID;
+    else
+      m_UID = XBMCClientUtils::GetUniqueIdentifier();
+  }
+
+  ~CXBMCClientShm()
+  {
+    Close();
+  }
+
+  /* Attach to the event server and claim a free ring */
+  bool Open()
+  {
+    if (m_Ring)
+      return true;
+
+    int fd = shm_open(SHM_SEGMENT_NAME, O_RDWR, 0);
+    if (fd < 0)
+      return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(XBMCShmSegment))
+    {
+      close(fd);
+      return false;
+    }
+
+    m_Size = st.st_size;
+    m_Memory = mmap(NULL, m_Size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (m_Memory == MAP_FAILED)
+    {
+      m_Memory = NULL;
+      return false;
+    }
+
+    m_Segment = (XBMCShmSegment *)m_Memory;
+    const size_t RingSize = Align(sizeof(XBMCShmRing)) + Align(m_Segment->ringCapacity);
+    if (memcmp(m_Segment->magic, "XBER", 4) != 0 || m_Segment->version != 2 ||
+        Align(sizeof(XBMCShmSegment)) + m_Segment->ringCount * RingSize > m_Size)
+    {
+      Close();
+      return false;
+    }
+
+    for (uint32_t i = 0; i < m_Segment->ringCount; i++)
+    {
+      XBMCShmRing *Ring = (XBMCShmRing *)((uint8_t *)m_Memory + Align(sizeof(XBMCShmSegment)) + i * RingSize);
+      int32_t Free = 0;
+      if (Ring->owner.compare_exchange_strong(Free, getpid()))
+      {
+        m_Ring = Ring;
+        m_Data = (uint8_t *)Ring + Align(sizeof(XBMCShmRing));
+        return true;
+      }
+    }
+
+    // all rings are in use
+    Close();
+    return false;
+  }
+
+  /* Deliver pending packets and release the ring */
+  void Close()
+  {
+    if (m_Ring)
+    {
+      Flush();
+      WaitUntilConsumed(1000);
+      m_Ring->owner = 0;
+      m_Ring = NULL;
+    }
+    if (m_Memory)
+    {
+      munmap(m_Memory, m_Size);
+      m_Memory = NULL;
+    }
+    m_Segment = NULL;
+  }
+
+  bool IsOpen() const
+  {
+    return m_Ring != NULL;
+  }
+
+  /* Add a packet to the ring without waking up the event server. Waits for
+     the server to make room for at most TimeoutMs if the ring is full. */
+  bool Queue(CPacket &Packet, int TimeoutMs = 100)
+  {
+    if (!m_Ring)
+      return false;
+
+    std::vector<std::vector<char> > Datagrams;
+    Packet.Serialize(Datagrams, m_UID);
+
+    for (const std::vector<char> &Datagram : Datagrams)
+    {
+      auto Deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(TimeoutMs);
+      while (!Push(Datagram))
+      {
+        Flush();
+        if (std::chrono::steady_clock::now() > Deadline)
+          return false;
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+      }
+      m_Pending = true;
+    }
+    return true;
+  }
+
+  /* Wake up the event server once for all packets queued so far */
+  void Flush()
+  {
+    if (m_Ring && m_Pending)
+    {
+      sem_post(&m_Segment->wakeup);
+      m_Pending = false;
+    }
+  }
+
+  bool Send(CPacket &Packet)
+  {
+    if (!Queue(Packet))
+      return false;
+    Flush();
+    return true;
+  }
+
+  /* Wait until the event server has taken all packets out of the ring,
+     returns false on timeout */
+  bool WaitUntilConsumed(int TimeoutMs)
+  {
+    if (!m_Ring)
+      return false;
+
+    auto Deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(TimeoutMs);
+    while (m_Ring->tail.load(std::memory_order_acquire) != m_Ring->head.load(std::memory_order_relaxed))
+    {
+      if (std::chrono::steady_clock::now() > Deadline)
+        return false;
+      std::this_thread::yield();
+    }
+    return true;
+  }
+};
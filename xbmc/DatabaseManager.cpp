@@ -11,6 +11,7 @@
 #include "ServiceBroker.h"
 #include "TextureDatabase.h"
 #include "addons/AddonDatabase.h"
+#include "filesystem/ChangeJournalDatabase.h"
 #include "music/MusicDatabase.h"
 #include "pvr/PVRDatabase.h"
 #include "pvr/epg/EpgDatabase.h"
@@ -53,6 +54,7 @@ bool CDatabaseManager::Initialize()
   }
   { CViewDatabase db; UpdateDatabase(db); }
   { CTextureDatabase db; UpdateDatabase(db); }
+  { XFILE::CChangeJournalDatabase db; UpdateDatabase(db); }
   { CMusicDatabase db; UpdateDatabase(db, &advancedSettings->m_databaseMusic); }
   { CVideoDatabase db; UpdateDatabase(db, &advancedSettings->m_databaseVideo); }
   { CPVRDatabase db; UpdateDatabase(db, &advancedSettings->m_databaseTV); }
@@ -144,7 +146,11 @@ bool CDatabaseManager::Update(CDatabase &db, const DatabaseSettings &settings)
 
       // yay - we have a copy of our db, now do our worst with it
       if (UpdateVersion(db, latestDb))
+      {
+        // a bulk import may have been interrupted while its analytics were dropped
+        db.RestoreDeferredAnalytics();
         return true;
+      }
 
       // update failed - loop around and see if we have another one available
       db.Close();
@@ -148,3 +148,6 @@ constexpr const int GUI_MSG_PLAYBACK_PAUSED = GUI_MSG_USER + 47;
 constexpr const int GUI_MSG_PLAYBACK_RESUMED = GUI_MSG_USER + 48;
 constexpr const int GUI_MSG_PLAYBACK_SEEKED = GUI_MSG_USER + 49;
 constexpr const int GUI_MSG_PLAYBACK_SPEED_CHANGED = GUI_MSG_USER + 50;
+
+// Sent to CGUIMediaWindow with the items of a directory that is still being listed
+constexpr const int GUI_MSG_DIRECTORY_ITEMS = GUI_MSG_USER + 51;
@@ -9,10 +9,29 @@
 #include "InfoScanner.h"
 
 #include "URL.h"
+#include "filesystem/ChangeJournal.h"
+#include "filesystem/Directory.h"
+#include "utils/StringUtils.h"
 #include "utils/FileUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+namespace
+{
+// the folder directly below path containing directory
+std::string GetItemFolder(const std::string& path, const std::string& directory)
+{
+  const size_t end = directory.find('/', path.size());
+  if (end == std::string::npos)
+    return path;
+  return directory.substr(0, end + 1);
+}
+} // unnamed namespace
+
 bool CInfoScanner::HasNoMedia(const std::string& strDirectory)
 {
   std::string noMediaFile = URIUtils::AddFileToFolder(strDirectory, ".nomedia");
@@ -28,3 +47,60 @@ bool CInfoScanner::HasNoMedia(const std::string& strDirectory)
 
   return false;
 }
+
+void CInfoScanner::ApplyChangeJournal(const std::string& library, bool itemFolders)
+{
+  m_journaledPaths.clear();
+
+  // nested paths are covered by their parent, which sorts right before them
+  std::vector<std::string> paths;
+  for (const auto& path : m_pathsToScan)
+  {
+    if (paths.empty() || !StringUtils::StartsWith(path, paths.back()))
+      paths.push_back(path);
+  }
+
+  XFILE::CChangeJournal& journal = XFILE::CChangeJournal::GetInstance();
+  for (const auto& path : paths)
+  {
+    std::set<std::string> changes;
+    int lastChange = -1;
+    if (!journal.GetChanges(library, path, changes, lastChange))
+    {
+      if (journal.BeginScan(library, path))
+        m_journaledPaths[path] = -1;
+      continue;
+    }
+
+    // known paths removed below a changed directory stay, so they are cleaned as before
+    auto it = m_pathsToScan.lower_bound(path);
+    while (it != m_pathsToScan.end() && StringUtils::StartsWith(*it, path))
+    {
+      const bool removed = std::any_of(changes.begin(), changes.end(),
+                                       [&it](const std::string& directory) {
+                                         return StringUtils::StartsWith(*it, directory);
+                                       }) &&
+                           !XFILE::CDirectory::Exists(*it);
+      it = removed ? std::next(it) : m_pathsToScan.erase(it);
+    }
+
+    for (const auto& directory : changes)
+    {
+      const std::string scanPath = itemFolders ? GetItemFolder(path, directory) : directory;
+      if (XFILE::CDirectory::Exists(scanPath))
+        m_pathsToScan.insert(scanPath);
+    }
+
+    m_journaledPaths[path] = lastChange;
+    CLog::Log(LOGDEBUG, "{}: {} directories changed below {}", __FUNCTION__, changes.size(),
+              CURL::GetRedacted(path));
+  }
+}
+
+void CInfoScanner::CommitChangeJournal(const std::string& library)
+{
+  XFILE::CChangeJournal& journal = XFILE::CChangeJournal::GetInstance();
+  for (const auto& [path, lastChange] : m_journaledPaths)
+    journal.EndScan(library, path, lastChange);
+  m_journaledPaths.clear();
+}
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <map>
 #include <set>
 #include <string>
 
@@ -65,10 +66,25 @@ protected:
   //! \brief Protected constructor to only allow subclass instances.
   CInfoScanner() = default;
 
+  /*! \brief Reduce the paths to scan to the directories changed since the last scan.
+   Paths whose changes were journaled are replaced by the changed directories below them, all
+   other paths are scanned completely and journaled from now on.
+   \param library name of the library in the change journal
+   \param itemFolders scan the folder directly below the path that contains a change instead of
+   the changed directory itself, for items spanning several folders like tv shows
+   */
+  void ApplyChangeJournal(const std::string& library, bool itemFolders);
+
+  /*! \brief Mark the journaled paths as scanned, call after a successful scan.
+   \param library name of the library in the change journal
+   */
+  void CommitChangeJournal(const std::string& library);
+
   std::set<std::string, std::less<>> m_pathsToScan; //!< Set of paths to scan
   bool m_showDialog = false; //!< Whether or not to show progress bar dialog
   CGUIDialogProgressBarHandle* m_handle = nullptr; //!< Progress bar handle
   bool m_bRunning = false; //!< Whether or not scanner is running
   bool m_bCanInterrupt = false; //!< Whether or not scanner is currently interruptible
   bool m_bClean = false; //!< Whether or not to perform cleaning during scanning
+  std::map<std::string, int> m_journaledPaths; //!< Last change scanned per path, -1 if complete
 };
@@ -218,11 +218,11 @@ void CTextureCache::ClearCachedImage(const std::string& image, bool deleteSource
   std::string path = deleteSource ? url : "";
   std::string cachedFile;
   if (ClearCachedTexture(url, cachedFile))
-    path = GetCachedPath(cachedFile);
-  if (CFile::Exists(path))
+    path = !cachedFile.empty() ? GetCachedPath(cachedFile) : "";
+  if (!path.empty() && CFile::Exists(path))
     CFile::Delete(path);
   path = URIUtils::ReplaceExtension(path, ".dds");
-  if (CFile::Exists(path))
+  if (!path.empty() && CFile::Exists(path))
     CFile::Delete(path);
 }
 
@@ -231,6 +231,10 @@ bool CTextureCache::ClearCachedImage(int id)
   std::string cachedFile;
   if (ClearCachedTexture(id, cachedFile))
   {
+    // other textures of the same content still use the file
+    if (cachedFile.empty())
+      return true;
+
     cachedFile = GetCachedPath(cachedFile);
     if (CFile::Exists(cachedFile))
       CFile::Delete(cachedFile);
@@ -248,10 +252,24 @@ bool CTextureCache::GetCachedTexture(const std::string &url, CTextureDetails &de
   return m_database.GetCachedTexture(url, details);
 }
 
+bool CTextureCache::GetCachedContent(const std::string& contentHash, CTextureDetails& details)
+{
+  std::unique_lock lock(m_databaseSection);
+  return m_database.GetCachedContent(contentHash, details);
+}
+
 bool CTextureCache::AddCachedTexture(const std::string &url, const CTextureDetails &details)
 {
   std::unique_lock lock(m_databaseSection);
-  return m_database.AddCachedTexture(url, details);
+  CTextureDetails previous;
+  const bool moved = m_database.GetCachedTexture(url, previous) && previous.file != details.file;
+  if (!m_database.AddCachedTexture(url, details))
+    return false;
+
+  // a recached image is stored by its new content, drop the old file unless it is shared
+  if (moved && !previous.file.empty() && !m_database.IsCachedFileUsed(previous.file))
+    CFile::Delete(GetCachedPath(previous.file));
+  return true;
 }
 
 void CTextureCache::IncrementUseCount(const CTextureDetails &details)
@@ -156,6 +156,14 @@ public:
    */
   bool AddCachedTexture(const std::string &image, const CTextureDetails &details);
 
+  /*! \brief Get a cached image with the given content
+   Thread-safe wrapper of CTextureDatabase::GetCachedContent
+   \param contentHash hash of the content of the image
+   \param details [out] the cached file and its size
+   \return true if an image with this content is cached, false otherwise.
+   */
+  bool GetCachedContent(const std::string& contentHash, CTextureDetails& details);
+
   /*! \brief Export a (possibly) cached image to a file
    \param image url of the original image
    \param destination url of the destination image, excluding extension.
@@ -22,6 +22,8 @@
 #include "pictures/Picture.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
+#include "utils/Digest.h"
+#include "utils/Mime.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
@@ -30,6 +32,7 @@
 #include <cstring>
 #include <exception>
 #include <utility>
+#include <vector>
 
 #include "PlatformDefs.h"
 
@@ -91,6 +94,54 @@ bool ShouldCheckForChanges(const std::string& specialType, const std::string& ur
       StringUtils::StartsWith(url, "http://") || StringUtils::StartsWith(url, "https://");
   return !isHTTP;
 }
+
+bool IsPictureFile(CFileItem& file)
+{
+  file.FillInMimeType();
+  return (file.IsPicture() && !(file.IsZIP() || file.IsRAR() || file.IsCBR() || file.IsCBZ())) ||
+         StringUtils::StartsWithNoCase(file.GetMimeType(), "image/") ||
+         StringUtils::EqualsNoCase(file.GetMimeType(), "application/octet-stream");
+}
+
+// images the texture loader reads in its own way can't be identified by the bytes of the file
+bool IsPlainImageFile(const std::string& path)
+{
+  if (URIUtils::HasExtension(path, ".dds"))
+    return false;
+
+  const CURL url(path);
+  return !url.IsProtocol("xbt") && !url.IsProtocol("resource") && !url.IsProtocol("androidapp");
+}
+
+std::string GetFileHash(const void* data, size_t size, bool flipped)
+{
+  KODI::UTILITY::CDigest digest{KODI::UTILITY::CDigest::Type::MD5};
+  digest.Update("file");
+  digest.Update(data, size);
+  if (flipped)
+    digest.Update("flipped");
+  return digest.Finalize();
+}
+
+// the same pixels stand for another image if they are laid out or oriented differently
+std::string GetPixelsHash(const CTexture& texture)
+{
+  KODI::UTILITY::CDigest digest{KODI::UTILITY::CDigest::Type::MD5};
+  digest.Update("pixels");
+  digest.Update(StringUtils::Format(
+      "{}x{} pitch {} rows {} format {} swizzle {} alpha {} orientation {}", texture.GetWidth(),
+      texture.GetHeight(), texture.GetPitch(), texture.GetRows(),
+      static_cast<int>(texture.GetTextureFormat()), static_cast<int>(texture.GetSwizzle()),
+      texture.HasAlpha(), texture.GetOrientation()));
+  digest.Update(texture.GetPixels(), static_cast<size_t>(texture.GetPitch()) * texture.GetRows());
+  return digest.Finalize();
+}
+
+// cached files named by their content are shared by all URLs of that content
+std::string GetContentCacheFile(const std::string& contentHash)
+{
+  return StringUtils::Format("{}/{}", contentHash[0], contentHash);
+}
 } // namespace
 
 bool CTextureCacheJob::CacheTexture(std::unique_ptr<CTexture>* out_texture)
@@ -114,13 +165,34 @@ bool CTextureCacheJob::CacheTexture(std::unique_ptr<CTexture>* out_texture)
     }
   }
 
-  std::unique_ptr<CTexture> texture = LoadImage(imageURL);
+  std::unique_ptr<CTexture> texture;
+  if (!imageURL.IsSpecialImage() && IsPlainImageFile(image))
+  {
+    texture = LoadImageFile(imageURL, out_texture);
+    // no texture either if the content was cached already by another URL
+    if (!texture)
+      return !m_details.file.empty();
+  }
+  else
+  {
+    // generated images are identified by their pixels, which saves storing them again
+    texture = LoadImage(imageURL);
+    if (texture)
+    {
+      m_details.contentHash = GetPixelsHash(*texture);
+      if (UseCachedContent(out_texture))
+        return true;
+    }
+  }
+
   if (texture)
   {
+    const std::string cachePath =
+        !m_details.contentHash.empty() ? GetContentCacheFile(m_details.contentHash) : m_cachePath;
     if (texture->HasAlpha())
-      m_details.file = m_cachePath + ".png";
+      m_details.file = cachePath + ".png";
     else
-      m_details.file = m_cachePath + ".jpg";
+      m_details.file = cachePath + ".jpg";
 
     CLog::Log(LOGDEBUG, "{} image '{}' to '{}':", m_oldHash.empty() ? "Caching" : "Recaching",
               CURL::GetRedacted(image), m_details.file);
@@ -177,14 +249,8 @@ std::unique_ptr<CTexture> CTextureCacheJob::LoadImage(const IMAGE_FILES::CImageF
 
   // Validate file URL to see if it is an image
   CFileItem file(imageURL.GetTargetFile(), false);
-  file.FillInMimeType();
-  if (!(file.IsPicture() && !(file.IsZIP() || file.IsRAR() || file.IsCBR() || file.IsCBZ())) &&
-      !StringUtils::StartsWithNoCase(file.GetMimeType(), "image/") &&
-      !StringUtils::EqualsNoCase(file.GetMimeType(),
-                                 "application/octet-stream")) // ignore non-pictures
-  {
+  if (!IsPictureFile(file)) // ignore non-pictures
     return {};
-  }
 
   auto texture = CTexture::LoadFromFile(imageURL.GetTargetFile(), 0, 0, CAspectRatio::CENTER,
                                         file.GetMimeType());
@@ -200,6 +266,68 @@ std::unique_ptr<CTexture> CTextureCacheJob::LoadImage(const IMAGE_FILES::CImageF
   return texture;
 }
 
+std::unique_ptr<CTexture> CTextureCacheJob::LoadImageFile(
+    const IMAGE_FILES::CImageFileURL& imageURL, std::unique_ptr<CTexture>* out_texture)
+{
+  const std::string& image = imageURL.GetTargetFile();
+  CFileItem file(image, false);
+  if (!IsPictureFile(file)) // ignore non-pictures
+    return {};
+
+  std::vector<uint8_t> buffer;
+  XFILE::CFile source;
+  if (source.LoadFile(image, buffer) <= 0)
+    return {};
+
+  m_details.contentHash = GetFileHash(buffer.data(), buffer.size(), imageURL.flipped);
+  if (UseCachedContent(out_texture))
+    return {};
+
+  // the same loader CTexture::LoadFromFile picks for this file
+  std::string mimeType = file.GetMimeType();
+  if (mimeType.empty())
+  {
+    const CURL url(image);
+    mimeType =
+        !url.GetFileType().empty() ? "image/" + url.GetFileType() : CMime::GetMimeType(url);
+  }
+
+  auto texture = CTexture::LoadFromFileInMemory(buffer.data(), buffer.size(), mimeType);
+  if (!texture)
+    return {};
+
+  // see LoadImage
+  if (imageURL.flipped)
+    texture->SetOrientation(texture->GetOrientation() ^ 1);
+
+  return texture;
+}
+
+bool CTextureCacheJob::UseCachedContent(std::unique_ptr<CTexture>* out_texture)
+{
+  CTextureDetails cached;
+  if (!CServiceBroker::GetTextureCache()->GetCachedContent(m_details.contentHash, cached))
+    return false;
+
+  const std::string cachedPath = CTextureCache::GetCachedPath(cached.file);
+  if (!XFILE::CFile::Exists(cachedPath))
+    return false;
+
+  if (out_texture) // caller wants the texture
+  {
+    *out_texture = CTexture::LoadFromFile(cachedPath);
+    if (!*out_texture)
+      return false;
+  }
+
+  CLog::Log(LOGDEBUG, "{} image '{}' as '{}', cached for the same content",
+            m_oldHash.empty() ? "Caching" : "Recaching", CURL::GetRedacted(m_url), cached.file);
+  m_details.file = cached.file;
+  m_details.width = cached.width;
+  m_details.height = cached.height;
+  return true;
+}
+
 std::string CTextureCacheJob::GetImageHash(const std::string &url)
 {
   // silently ignore - we cannot stat these
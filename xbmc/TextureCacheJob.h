@@ -38,6 +38,7 @@ public:
   int id{-1};
   std::string file;
   std::string hash;
+  std::string contentHash; ///< identical images share one cached file, see CTextureCacheJob
   unsigned int width{0};
   unsigned int height{0};
   bool updateable{false};
@@ -95,6 +96,24 @@ private:
    */
   static std::unique_ptr<CTexture> LoadImage(const IMAGE_FILES::CImageFileURL& imageURL);
 
+  /*! \brief Load a plain image file, identifying it by the content of the file.
+
+   The content hash is computed before decoding, so an image that is cached already by another URL
+   is neither decoded nor stored again.
+
+   \param imageURL the image, not a special image.
+   \param out_texture [out] the texture, if the caller wants it.
+   \return the loaded texture, empty if failed or if the cached content was used.
+   */
+  std::unique_ptr<CTexture> LoadImageFile(const IMAGE_FILES::CImageFileURL& imageURL,
+                                          std::unique_ptr<CTexture>* out_texture);
+
+  /*! \brief Use the cached file of an image with the same content, if there is one.
+   \param out_texture [out] the texture, if the caller wants it.
+   \return true if the image is cached already, false otherwise.
+   */
+  bool UseCachedContent(std::unique_ptr<CTexture>* out_texture);
+
   std::string    m_cachePath;
 };
 
@@ -124,7 +124,7 @@ void CTextureDatabase::CreateTables()
 {
   CLog::Log(LOGINFO, "create texture table");
   m_pDS->exec("CREATE TABLE texture (id integer primary key, url text, cachedurl text, "
-              "imagehash text, lasthashcheck text, lastlibrarycheck text)");
+              "imagehash text, lasthashcheck text, lastlibrarycheck text, contenthash text)");
 
   CLog::Log(LOGINFO, "create sizes table, index,  and trigger");
   m_pDS->exec("CREATE TABLE sizes (idtexture integer, size integer, width integer, height integer, usecount integer, lastusetime text)");
@@ -137,6 +137,8 @@ void CTextureDatabase::CreateAnalytics()
 {
   CLog::Log(LOGINFO, "{} creating indices", __FUNCTION__);
   m_pDS->exec("CREATE INDEX idxTexture ON texture(url)");
+  m_pDS->exec("CREATE INDEX idxTextureContent ON texture(contenthash)");
+  m_pDS->exec("CREATE INDEX idxTextureCachedUrl ON texture(cachedurl)");
   m_pDS->exec("CREATE INDEX idxSize ON sizes(idtexture, size)");
   m_pDS->exec("CREATE INDEX idxSize2 ON sizes(idtexture, width, height)");
   //! @todo Should the path index be a covering index? (we need only retrieve texture)
@@ -203,6 +205,10 @@ void CTextureDatabase::UpdateTables(int version)
   {
     m_pDS->exec("ALTER TABLE texture ADD lastlibrarycheck text");
   }
+  if (version < 15)
+  {
+    m_pDS->exec("ALTER TABLE texture ADD contenthash text");
+  }
 }
 
 bool CTextureDatabase::IncrementUseCount(const CTextureDetails &details)
@@ -247,6 +253,44 @@ bool CTextureDatabase::GetCachedTexture(const std::string &url, CTextureDetails
   return false;
 }
 
+bool CTextureDatabase::GetCachedContent(const std::string& contentHash, CTextureDetails& details)
+{
+  try
+  {
+    if (!m_pDB)
+      return false;
+    if (!m_pDS)
+      return false;
+
+    std::string sql = PrepareSQL("SELECT cachedurl, width, height FROM texture JOIN sizes ON "
+                                 "(texture.id=sizes.idtexture AND sizes.size=1) WHERE "
+                                 "contenthash='%s' LIMIT 1",
+                                 contentHash.c_str());
+    m_pDS->query(sql);
+    if (!m_pDS->eof())
+    {
+      details.file = m_pDS->fv(0).get_asString();
+      details.width = m_pDS->fv(1).get_asInt();
+      details.height = m_pDS->fv(2).get_asInt();
+      m_pDS->close();
+      return true;
+    }
+    m_pDS->close();
+  }
+  catch (...)
+  {
+    CLog::Log(LOGERROR, "{}, failed on content '{}'", __FUNCTION__, contentHash);
+  }
+  return false;
+}
+
+bool CTextureDatabase::IsCachedFileUsed(const std::string& cachedFile)
+{
+  return !GetSingleValue(
+              PrepareSQL("SELECT id FROM texture WHERE cachedurl='%s' LIMIT 1", cachedFile.c_str()))
+              .empty();
+}
+
 bool CTextureDatabase::GetTextures(CVariant &items, const Filter &filter)
 {
   try
@@ -257,11 +301,15 @@ bool CTextureDatabase::GetTextures(CVariant &items, const Filter &filter)
       return false;
 
     std::string sql = "SELECT %s FROM texture JOIN sizes ON (texture.id=sizes.idtexture AND sizes.size=1)";
+    // the columns read below, by position
+    const std::string columns = "texture.id, url, cachedurl, imagehash, lasthashcheck, "
+                                "sizes.idtexture, size, width, height, usecount, lastusetime";
     std::string sqlFilter;
     if (!CDatabase::BuildSQL("", filter, sqlFilter))
       return false;
 
-    sql = PrepareSQL(sql, !filter.fields.empty() ? filter.fields.c_str() : "*") + sqlFilter;
+    sql = PrepareSQL(sql, !filter.fields.empty() ? filter.fields.c_str() : columns.c_str()) +
+          sqlFilter;
     if (!m_pDS->query(sql))
       return false;
 
@@ -372,7 +420,12 @@ bool CTextureDatabase::AddCachedTexture(const std::string &url, const CTextureDe
     m_pDS->exec(sql);
 
     std::string date = details.updateable ? CDateTime::GetCurrentDateTime().GetAsDBDateTime() : "";
-    sql = PrepareSQL("INSERT INTO texture (id, url, cachedurl, imagehash, lasthashcheck) VALUES(NULL, '%s', '%s', '%s', '%s')", url.c_str(), details.file.c_str(), details.hash.c_str(), date.c_str());
+    const std::string contentHash =
+        details.contentHash.empty() ? "NULL" : PrepareSQL("'%s'", details.contentHash.c_str());
+    sql = PrepareSQL("INSERT INTO texture (id, url, cachedurl, imagehash, lasthashcheck, "
+                     "contenthash) VALUES(NULL, '%s', '%s', '%s', '%s', ",
+                     url.c_str(), details.file.c_str(), details.hash.c_str(), date.c_str()) +
+          contentHash + ")";
     m_pDS->exec(sql);
     int textureID = (int)m_pDS->lastinsertid();
 
@@ -415,6 +468,9 @@ bool CTextureDatabase::ClearCachedTexture(int id, std::string &cacheFile)
       // remove it
       sql = PrepareSQL("delete from texture where id=%u", id);
       m_pDS->exec(sql);
+      // the cached file stays while other textures of the same content refer to it
+      if (IsCachedFileUsed(cacheFile))
+        cacheFile.clear();
       return true;
     }
     m_pDS->close();
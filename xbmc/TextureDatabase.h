@@ -43,8 +43,26 @@ public:
   bool Open() override;
 
   bool GetCachedTexture(const std::string &originalURL, CTextureDetails &details);
+
+  /*! \brief Get a cached texture with the given content
+   Images with the same content share one cached file, whichever URL they were reached through.
+   \param contentHash hash of the content of the image
+   \param details [out] the cached file and its size
+   \return true if an image with this content is cached, false otherwise
+   */
+  bool GetCachedContent(const std::string& contentHash, CTextureDetails& details);
+
+  /*! \brief Check whether any texture refers to the given cached file
+   \param cachedFile the cached file, relative to the cache path
+   \return true if the file is in use, false otherwise
+   */
+  bool IsCachedFileUsed(const std::string& cachedFile);
+
   bool AddCachedTexture(const std::string &originalURL, const CTextureDetails &details);
   bool SetCachedTextureValid(const std::string &originalURL, bool updateable);
+  /*! \brief Remove a texture
+   \param cacheFile [out] the cached file of the texture, empty if other textures still refer to it
+   */
   bool ClearCachedTexture(const std::string &originalURL, std::string &cacheFile);
   bool ClearCachedTexture(int textureID, std::string &cacheFile);
   bool IncrementUseCount(const CTextureDetails &details);
@@ -114,6 +132,6 @@ protected:
   void CreateTables() override;
   void CreateAnalytics() override;
   void UpdateTables(int version) override;
-  int GetSchemaVersion() const override { return 14; }
+  int GetSchemaVersion() const override { return 15; }
   const char* GetBaseDBName() const override { return "Textures"; }
 };
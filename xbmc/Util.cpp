@@ -440,7 +440,8 @@ bool CUtil::GetFilenameIdentifier(const std::string& fileName,
 
   const std::shared_ptr<CAdvancedSettings> advancedSettings =
       CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
-  if (!reIdentifier.RegComp(advancedSettings->m_videoFilenameIdentifierRegExp))
+  if (!reIdentifier.RegComp(advancedSettings->m_videoFilenameIdentifierRegExp,
+                            CRegExp::StudyWithJitComp))
   {
     CLog::LogF(LOGERROR, "Invalid filename identifier RegExp:'{}'",
                advancedSettings->m_videoFilenameIdentifierRegExp);
@@ -448,7 +449,8 @@ bool CUtil::GetFilenameIdentifier(const std::string& fileName,
   }
   else
   {
-    if (reIdentifier.RegComp(advancedSettings->m_videoFilenameIdentifierRegExp))
+    if (reIdentifier.RegComp(advancedSettings->m_videoFilenameIdentifierRegExp,
+                             CRegExp::StudyWithJitComp))
     {
       if (reIdentifier.RegFind(fileName) >= 0)
       {
@@ -494,7 +496,7 @@ void CUtil::CleanString(const std::string& strFileName,
   CRegExp reTags(true, CRegExp::autoUtf8);
   CRegExp reYear(false, CRegExp::autoUtf8);
 
-  if (!reYear.RegComp(advancedSettings->m_videoCleanDateTimeRegExp))
+  if (!reYear.RegComp(advancedSettings->m_videoCleanDateTimeRegExp, CRegExp::StudyWithJitComp))
   {
     CLog::Log(LOGERROR, "{}: Invalid datetime clean RegExp:'{}'", __FUNCTION__,
               advancedSettings->m_videoCleanDateTimeRegExp);
@@ -512,7 +514,7 @@ void CUtil::CleanString(const std::string& strFileName,
 
   for (const auto &regexp : regexps)
   {
-    if (!reTags.RegComp(regexp.c_str()))
+    if (!reTags.RegComp(regexp.c_str(), CRegExp::StudyWithJitComp))
     { // invalid regexp - complain in logs
       CLog::Log(LOGERROR, "{}: Invalid string clean RegExp:'{}'", __FUNCTION__, regexp);
       continue;
@@ -632,7 +634,7 @@ bool CUtil::ExcludeFileOrFolder(const std::string& strFileOrFolder, const std::v
 
   for (const auto &regexp : regexps)
   {
-    if (!regExExcludes.RegComp(regexp.c_str()))
+    if (!regExExcludes.RegComp(regexp.c_str(), CRegExp::StudyWithJitComp))
     { // invalid regexp - complain in logs
       CLog::Log(LOGERROR, "{}: Invalid exclude RegExp:'{}'", __FUNCTION__, regexp);
       continue;
@@ -23,6 +23,7 @@
 #include "addons/IAddon.h"
 #include "addons/addoninfo/AddonInfo.h"
 #include "addons/addoninfo/AddonInfoBuilder.h"
+#include "addons/addoninfo/AddonManifestCache.h"
 #include "addons/addoninfo/AddonType.h"
 #include "events/AddonManagementEvent.h"
 #include "events/EventLog.h"
@@ -128,14 +129,22 @@ bool CAddonMgr::Init()
 {
   std::unique_lock lock(m_critSection);
 
+  auto start = std::chrono::steady_clock::now();
   if (!LoadManifest(m_systemAddons, m_optionalSystemAddons))
   {
     CLog::Log(LOGERROR, "ADDONS: Failed to read manifest");
     return false;
   }
+  auto end = std::chrono::steady_clock::now();
+  CLog::Log(LOGINFO, "ADDONS: Reading system add-on manifest took {} ms",
+            std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
 
+  start = std::chrono::steady_clock::now();
   if (!m_database->Open())
     CLog::Log(LOGFATAL, "ADDONS: Failed to open database");
+  end = std::chrono::steady_clock::now();
+  CLog::Log(LOGINFO, "ADDONS: Opening database took {} ms",
+            std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
 
   FindAddons();
 
@@ -688,11 +697,30 @@ bool CAddonMgr::FindAddons()
 {
   AddonInfoMap installedAddons;
 
-  FindAddons(installedAddons, "special://xbmcbin/addons");
+  auto start = std::chrono::steady_clock::now();
+  CAddonManifestCache manifestCache("special://database/AddonManifests.cache");
+  manifestCache.Load();
+  auto end = std::chrono::steady_clock::now();
+  const auto loadDuration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+
+  start = std::chrono::steady_clock::now();
+  FindAddons(installedAddons, "special://xbmcbin/addons", &manifestCache);
   // Confirm special://xbmcbin/addons and special://xbmc/addons are not the same
   if (!CSpecialProtocol::ComparePath("special://xbmcbin/addons", "special://xbmc/addons"))
-    FindAddons(installedAddons, "special://xbmc/addons");
-  FindAddons(installedAddons, "special://home/addons");
+    FindAddons(installedAddons, "special://xbmc/addons", &manifestCache);
+  FindAddons(installedAddons, "special://home/addons", &manifestCache);
+  end = std::chrono::steady_clock::now();
+  const auto scanDuration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+
+  start = std::chrono::steady_clock::now();
+  manifestCache.Save();
+  end = std::chrono::steady_clock::now();
+  CLog::Log(LOGINFO,
+            "ADDONS: Scanning add-on directories took {} ms ({} manifests cached, {} parsed), "
+            "loading manifest cache {} ms, saving manifest cache {} ms",
+            scanDuration.count(), manifestCache.GetHits(), manifestCache.GetMisses(),
+            loadDuration.count(),
+            std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
 
   std::set<std::string, std::less<>> installed;
   for (const auto& [_, addon] : installedAddons)
@@ -700,6 +728,8 @@ bool CAddonMgr::FindAddons()
 
   std::unique_lock lock(m_critSection);
 
+  start = std::chrono::steady_clock::now();
+
   // Sync with db
   m_database->SyncInstalled(installed, m_systemAddons, m_optionalSystemAddons);
   for (const auto& [_, addon] : installedAddons)
@@ -718,6 +748,11 @@ bool CAddonMgr::FindAddons()
 
   m_updateRules->RefreshRulesMap(*m_database);
 
+  end = std::chrono::steady_clock::now();
+  CLog::Log(LOGINFO, "ADDONS: Syncing {} add-ons with database took {} ms",
+            m_installedAddons.size(),
+            std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
+
   return true;
 }
 
@@ -1266,7 +1301,9 @@ AddonInfoPtr CAddonMgr::GetAddonInfo(const std::string& id, AddonType type) cons
   return nullptr;
 }
 
-void CAddonMgr::FindAddons(AddonInfoMap& addonmap, const std::string& path) const
+void CAddonMgr::FindAddons(AddonInfoMap& addonmap,
+                           const std::string& path,
+                           CAddonManifestCache* manifestCache /* = nullptr */) const
 {
   CFileItemList items;
   if (XFILE::CDirectory::GetDirectory(path, items, "", XFILE::DIR_FLAG_NO_FILE_DIRS))
@@ -1276,7 +1313,8 @@ void CAddonMgr::FindAddons(AddonInfoMap& addonmap, const std::string& path) cons
       const std::string p{i->GetPath()};
       if (CFileUtils::Exists(p + "addon.xml"))
       {
-        AddonInfoPtr addonInfo = CAddonInfoBuilder::Generate(p);
+        AddonInfoPtr addonInfo =
+            manifestCache ? manifestCache->Get(p) : CAddonInfoBuilder::Generate(p);
         if (addonInfo)
         {
           const auto it = addonmap.find(addonInfo->ID());
@@ -29,6 +29,7 @@ enum class AddonUpdateRule;
 enum class AllowCheckForUpdates : bool;
 
 class CAddonDatabase;
+class CAddonManifestCache;
 class CAddonUpdateRules;
 class CAddonVersion;
 class IAddonMgrCallback;
@@ -632,7 +633,15 @@ private:
 
   bool EnableSingle(const std::string& id);
 
-  void FindAddons(AddonInfoMap& addonmap, const std::string& path) const;
+  /*!
+   * @brief Add the add-ons installed in the given directory to the map.
+   * @param addonmap The map to fill.
+   * @param path The directory containing the add-on directories.
+   * @param manifestCache The cache of the parsed manifests to use or nullptr to parse all of them.
+   */
+  void FindAddons(AddonInfoMap& addonmap,
+                  const std::string& path,
+                  CAddonManifestCache* manifestCache = nullptr) const;
 
   /*!
      * @brief Fills the the provided vector with the list of incompatible
@@ -72,6 +72,7 @@ public:
 private:
   friend class CAddonInfoBuilder;
   friend class CAddonDatabaseSerializer;
+  friend class CAddonManifestSerializer;
 
   std::string m_point;
   EXT_VALUES m_values;
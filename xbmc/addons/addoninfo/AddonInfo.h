@@ -261,6 +261,7 @@ public:
 private:
   friend class CAddonInfoBuilder;
   friend class CAddonInfoBuilderFromDB;
+  friend class CAddonManifestSerializer;
 
   std::string m_id;
   AddonType m_mainType{};
@@ -0,0 +1,501 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "AddonManifestCache.h"
+
+#include "CompileInfo.h"
+#include "addons/addoninfo/AddonInfoBuilder.h"
+#include "addons/addoninfo/AddonType.h"
+#include "filesystem/File.h"
+#include "filesystem/SpecialProtocol.h"
+#include "utils/StringUtils.h"
+#include "utils/URIUtils.h"
+#include "utils/log.h"
+
+#include <cstring>
+#include <type_traits>
+
+using namespace ADDON;
+
+namespace
+{
+constexpr std::string_view CACHE_MAGIC = "KODIADDONCACHE";
+constexpr uint32_t CACHE_VERSION = 1;
+
+// extension elements nest a few levels deep, anything deeper comes from a damaged file
+constexpr int MAX_EXTENSION_DEPTH = 32;
+
+class CWriter
+{
+public:
+  template<typename T>
+    requires std::is_integral_v<T> || std::is_enum_v<T>
+  void Put(T value)
+  {
+    const auto v = static_cast<int64_t>(value);
+    m_data.append(reinterpret_cast<const char*>(&v), sizeof(v));
+  }
+
+  void Put(std::string_view value)
+  {
+    Put(value.size());
+    m_data.append(value);
+  }
+
+  void Put(const std::string& value) { Put(std::string_view(value)); }
+
+  template<typename Map>
+  void PutMap(const Map& values)
+  {
+    Put(values.size());
+    for (const auto& [key, value] : values)
+    {
+      Put(key);
+      Put(value);
+    }
+  }
+
+  void PutList(const std::vector<std::string>& values)
+  {
+    Put(values.size());
+    for (const auto& value : values)
+      Put(value);
+  }
+
+  std::string& Data() { return m_data; }
+
+private:
+  std::string m_data;
+};
+
+class CReader
+{
+public:
+  explicit CReader(std::string_view data) : m_data(data) {}
+
+  bool Failed() const { return m_failed; }
+  void Fail() { m_failed = true; }
+  bool AtEnd() const { return m_pos == m_data.size(); }
+
+  int64_t GetInt()
+  {
+    int64_t v{0};
+    if (m_failed || m_data.size() - m_pos < sizeof(v))
+    {
+      m_failed = true;
+      return 0;
+    }
+    std::memcpy(&v, m_data.data() + m_pos, sizeof(v));
+    m_pos += sizeof(v);
+    return v;
+  }
+
+  template<typename T>
+  T Get()
+  {
+    return static_cast<T>(GetInt());
+  }
+
+  size_t GetSize()
+  {
+    const int64_t size = GetInt();
+    if (size < 0 || static_cast<uint64_t>(size) > m_data.size() - m_pos)
+    {
+      // every element takes at least one byte, so a valid count never exceeds the remaining data
+      m_failed = true;
+      return 0;
+    }
+    return static_cast<size_t>(size);
+  }
+
+  std::string_view GetStringView()
+  {
+    const size_t size = GetSize();
+    if (m_failed)
+      return {};
+    const std::string_view value = m_data.substr(m_pos, size);
+    m_pos += size;
+    return value;
+  }
+
+  std::string GetString() { return std::string(GetStringView()); }
+
+  template<typename Map>
+  void GetMap(Map& values)
+  {
+    for (size_t count = GetSize(); count > 0 && !m_failed; --count)
+    {
+      std::string key = GetString();
+      values[key] = GetString();
+    }
+  }
+
+  void GetList(std::vector<std::string>& values)
+  {
+    const size_t count = GetSize();
+    values.reserve(count);
+    for (size_t i = 0; i < count && !m_failed; ++i)
+      values.emplace_back(GetString());
+  }
+
+private:
+  const std::string_view m_data;
+  size_t m_pos{0};
+  bool m_failed{false};
+};
+
+std::string GetBuildId()
+{
+  return std::string(CCompileInfo::GetSCMID());
+}
+} // unnamed namespace
+
+namespace ADDON
+{
+/*!
+ * @brief Access to the private members of the add-on info classes for the cache.
+ */
+class CAddonManifestSerializer
+{
+public:
+  static void Write(CWriter& writer, const CAddonExtensions& ext)
+  {
+    writer.Put(ext.m_point);
+    writer.Put(ext.m_values.size());
+    for (const auto& [id, values] : ext.m_values)
+    {
+      writer.Put(id);
+      writer.Put(values.size());
+      for (const auto& [key, value] : values)
+      {
+        writer.Put(key);
+        writer.Put(value.str);
+      }
+    }
+    writer.Put(ext.m_children.size());
+    for (const auto& [id, child] : ext.m_children)
+    {
+      writer.Put(id);
+      Write(writer, child);
+    }
+  }
+
+  static void Read(CReader& reader, CAddonExtensions& ext, int depth)
+  {
+    if (depth > MAX_EXTENSION_DEPTH)
+    {
+      reader.Fail();
+      return;
+    }
+
+    ext.m_point = reader.GetString();
+    const size_t valueCount = reader.GetSize();
+    for (size_t i = 0; i < valueCount && !reader.Failed(); ++i)
+    {
+      std::string id = reader.GetString();
+      EXT_VALUE values;
+      for (size_t count = reader.GetSize(); count > 0 && !reader.Failed(); --count)
+      {
+        std::string key = reader.GetString();
+        values.emplace_back(std::move(key), SExtValue(reader.GetString()));
+      }
+      ext.m_values.emplace_back(std::move(id), CExtValues(values));
+    }
+    const size_t childCount = reader.GetSize();
+    for (size_t i = 0; i < childCount && !reader.Failed(); ++i)
+    {
+      std::string id = reader.GetString();
+      CAddonExtensions child;
+      Read(reader, child, depth + 1);
+      ext.m_children.emplace_back(std::move(id), std::move(child));
+    }
+  }
+
+  static void Write(CWriter& writer, const CAddonInfo& addon)
+  {
+    writer.Put(addon.m_id);
+    writer.Put(addon.m_mainType);
+    writer.Put(addon.m_types.size());
+    for (const auto& type : addon.m_types)
+    {
+      writer.Put(type.m_type);
+      writer.Put(type.m_path);
+      writer.Put(type.m_libname);
+      writer.Put(type.m_providedSubContent.size());
+      for (const AddonType content : type.m_providedSubContent)
+        writer.Put(content);
+      Write(writer, static_cast<const CAddonExtensions&>(type));
+    }
+    writer.Put(addon.m_version.asString());
+    writer.Put(addon.m_minversion.asString());
+    writer.Put(addon.m_isBinary);
+    writer.Put(addon.m_name);
+    writer.Put(addon.m_license);
+    writer.PutMap(addon.m_summary);
+    writer.PutMap(addon.m_description);
+    writer.Put(addon.m_author);
+    writer.Put(addon.m_source);
+    writer.Put(addon.m_website);
+    writer.Put(addon.m_forum);
+    writer.Put(addon.m_email);
+    writer.Put(addon.m_path);
+    writer.Put(addon.m_profilePath);
+    writer.PutMap(addon.m_changelog);
+    writer.Put(addon.m_icon);
+    writer.PutMap(addon.m_art);
+    writer.PutList(addon.m_screenshots);
+    writer.PutMap(addon.m_disclaimer);
+    writer.Put(addon.m_dependencies.size());
+    for (const auto& dependency : addon.m_dependencies)
+    {
+      writer.Put(dependency.id);
+      writer.Put(dependency.versionMin.asString());
+      writer.Put(dependency.version.asString());
+      writer.Put(dependency.optional);
+    }
+    writer.Put(addon.m_lifecycleState);
+    writer.PutMap(addon.m_lifecycleStateDescription);
+    writer.Put(addon.m_packageSize);
+    writer.Put(addon.m_libname);
+    writer.PutMap(addon.m_extrainfo);
+    writer.PutList(addon.m_platforms);
+    writer.Put(addon.m_addonInstanceSupportType);
+    writer.Put(addon.m_supportsAddonSettings);
+    writer.Put(addon.m_supportsInstanceSettings);
+  }
+
+  static AddonInfoPtr Read(CReader& reader)
+  {
+    auto addon = std::make_shared<CAddonInfo>();
+    addon->m_id = reader.GetString();
+    addon->m_mainType = reader.Get<AddonType>();
+    const size_t typeCount = reader.GetSize();
+    for (size_t i = 0; i < typeCount && !reader.Failed(); ++i)
+    {
+      CAddonType type(reader.Get<AddonType>());
+      type.m_path = reader.GetString();
+      type.m_libname = reader.GetString();
+      for (size_t count = reader.GetSize(); count > 0 && !reader.Failed(); --count)
+        type.m_providedSubContent.insert(reader.Get<AddonType>());
+      Read(reader, type, 0);
+      addon->m_types.emplace_back(std::move(type));
+    }
+    addon->m_version = CAddonVersion(reader.GetString());
+    addon->m_minversion = CAddonVersion(reader.GetString());
+    addon->m_isBinary = reader.Get<bool>();
+    addon->m_name = reader.GetString();
+    addon->m_license = reader.GetString();
+    reader.GetMap(addon->m_summary);
+    reader.GetMap(addon->m_description);
+    addon->m_author = reader.GetString();
+    addon->m_source = reader.GetString();
+    addon->m_website = reader.GetString();
+    addon->m_forum = reader.GetString();
+    addon->m_email = reader.GetString();
+    addon->m_path = reader.GetString();
+    addon->m_profilePath = reader.GetString();
+    reader.GetMap(addon->m_changelog);
+    addon->m_icon = reader.GetString();
+    reader.GetMap(addon->m_art);
+    reader.GetList(addon->m_screenshots);
+    reader.GetMap(addon->m_disclaimer);
+    const size_t dependencyCount = reader.GetSize();
+    for (size_t i = 0; i < dependencyCount && !reader.Failed(); ++i)
+    {
+      std::string id = reader.GetString();
+      const CAddonVersion versionMin(reader.GetString());
+      const CAddonVersion version(reader.GetString());
+      const bool optional = reader.Get<bool>();
+      addon->m_dependencies.emplace_back(std::move(id), versionMin, version, optional);
+    }
+    addon->m_lifecycleState = reader.Get<AddonLifecycleState>();
+    reader.GetMap(addon->m_lifecycleStateDescription);
+    addon->m_packageSize = reader.Get<uint64_t>();
+    addon->m_libname = reader.GetString();
+    reader.GetMap(addon->m_extrainfo);
+    reader.GetList(addon->m_platforms);
+    addon->m_addonInstanceSupportType = reader.Get<AddonInstanceSupport>();
+    addon->m_supportsAddonSettings = reader.Get<bool>();
+    addon->m_supportsInstanceSettings = reader.Get<bool>();
+
+    if (reader.Failed() || addon->m_id.empty() || addon->m_types.empty())
+      return {};
+
+    return addon;
+  }
+};
+} // namespace ADDON
+
+std::string CAddonManifestCache::Serialize(const CAddonInfo& addon)
+{
+  CWriter writer;
+  CAddonManifestSerializer::Write(writer, addon);
+  return std::move(writer.Data());
+}
+
+AddonInfoPtr CAddonManifestCache::Deserialize(std::string_view data)
+{
+  CReader reader(data);
+  AddonInfoPtr addon = CAddonManifestSerializer::Read(reader);
+  if (!addon || !reader.AtEnd())
+    return {};
+
+  return addon;
+}
+
+CAddonManifestCache::Fingerprint CAddonManifestCache::GetFingerprint(const std::string& addonPath)
+{
+  // everything the manifest is built from: the manifest itself, the change log used if it has no
+  // news and the settings files in resources, whose presence changes the resources directory
+  static constexpr const char* files[] = {"", "addon.xml", "changelog.txt", "resources"};
+
+  Fingerprint fingerprint;
+  fingerprint.reserve(std::size(files) * 2);
+  for (const char* file : files)
+  {
+    struct __stat64 st;
+    if (XFILE::CFile::Stat(URIUtils::AddFileToFolder(addonPath, file), &st) == 0)
+    {
+      fingerprint.emplace_back(static_cast<int64_t>(st.st_mtime));
+      fingerprint.emplace_back(static_cast<int64_t>(st.st_size));
+    }
+    else
+    {
+      fingerprint.emplace_back(-1);
+      fingerprint.emplace_back(-1);
+    }
+  }
+  return fingerprint;
+}
+
+void CAddonManifestCache::Load()
+{
+  m_entries.clear();
+
+  XFILE::CFile file;
+  std::vector<uint8_t> buffer;
+  if (!XFILE::CFile::Exists(m_path) || file.LoadFile(m_path, buffer) <= 0)
+    return;
+
+  CReader reader(std::string_view(reinterpret_cast<const char*>(buffer.data()), buffer.size()));
+  if (reader.GetStringView() != CACHE_MAGIC || reader.Get<uint32_t>() != CACHE_VERSION ||
+      reader.GetStringView() != GetBuildId())
+  {
+    CLog::LogF(LOGDEBUG, "Discarding add-on manifest cache written by another build");
+    return;
+  }
+
+  const size_t count = reader.GetSize();
+  for (size_t i = 0; i < count && !reader.Failed(); ++i)
+  {
+    std::string addonPath = reader.GetString();
+    Entry entry;
+    for (size_t n = reader.GetSize(); n > 0 && !reader.Failed(); --n)
+      entry.fingerprint.emplace_back(reader.GetInt());
+    entry.data = reader.GetString();
+    m_entries.insert_or_assign(std::move(addonPath), std::move(entry));
+  }
+
+  if (reader.Failed() || !reader.AtEnd())
+  {
+    CLog::LogF(LOGWARNING, "Discarding damaged add-on manifest cache '{}'", m_path);
+    m_entries.clear();
+  }
+}
+
+bool CAddonManifestCache::Save()
+{
+  for (auto it = m_entries.begin(); it != m_entries.end();)
+  {
+    if (!it->second.used)
+    {
+      it = m_entries.erase(it);
+      m_changed = true;
+    }
+    else
+      ++it;
+  }
+
+  if (!m_changed)
+    return true;
+
+  CWriter writer;
+  writer.Put(CACHE_MAGIC);
+  writer.Put(CACHE_VERSION);
+  writer.Put(GetBuildId());
+  writer.Put(m_entries.size());
+  for (const auto& [addonPath, entry] : m_entries)
+  {
+    writer.Put(addonPath);
+    writer.Put(entry.fingerprint.size());
+    for (const int64_t value : entry.fingerprint)
+      writer.Put(value);
+    writer.Put(entry.data);
+  }
+
+  // write to a file of its own and move it in place, so that neither a crash nor a concurrent
+  // scan leaves a partly written cache behind
+  const std::string tempPath = m_path + "." + StringUtils::CreateUUID() + ".tmp";
+  XFILE::CFile file;
+  const std::string& data = writer.Data();
+  if (!file.OpenForWrite(tempPath, true) ||
+      file.Write(data.data(), data.size()) != static_cast<ssize_t>(data.size()))
+  {
+    CLog::LogF(LOGERROR, "Unable to write add-on manifest cache '{}'", tempPath);
+    file.Close();
+    XFILE::CFile::Delete(tempPath);
+    return false;
+  }
+  file.Close();
+
+  // not every platform replaces an existing file on rename
+  if (!XFILE::CFile::Rename(tempPath, m_path) &&
+      !(XFILE::CFile::Delete(m_path) && XFILE::CFile::Rename(tempPath, m_path)))
+  {
+    CLog::LogF(LOGERROR, "Unable to replace add-on manifest cache '{}'", m_path);
+    XFILE::CFile::Delete(tempPath);
+    return false;
+  }
+
+  m_changed = false;
+  return true;
+}
+
+AddonInfoPtr CAddonManifestCache::Get(const std::string& addonPath)
+{
+  const std::string realPath = CSpecialProtocol::TranslatePath(addonPath);
+  Fingerprint fingerprint = GetFingerprint(realPath);
+
+  const auto it = m_entries.find(realPath);
+  if (it != m_entries.end() && it->second.fingerprint == fingerprint)
+  {
+    AddonInfoPtr addonInfo = Deserialize(it->second.data);
+    if (addonInfo)
+    {
+      it->second.used = true;
+      m_hits++;
+      return addonInfo;
+    }
+  }
+
+  m_misses++;
+  AddonInfoPtr addonInfo = CAddonInfoBuilder::Generate(addonPath);
+  if (addonInfo)
+  {
+    m_entries.insert_or_assign(realPath,
+                               Entry{std::move(fingerprint), Serialize(*addonInfo), true});
+    m_changed = true;
+  }
+  else if (it != m_entries.end())
+  {
+    m_entries.erase(it);
+    m_changed = true;
+  }
+
+  return addonInfo;
+}
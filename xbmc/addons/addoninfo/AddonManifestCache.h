@@ -0,0 +1,94 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "addons/addoninfo/AddonInfo.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace ADDON
+{
+
+/*!
+ * @brief Binary cache of the manifests of the installed add-ons.
+ *
+ * Parsing the addon.xml of every installed add-on takes most of the time the add-on manager
+ * needs at startup. The cache keeps the parsed manifest of each add-on directory together with the
+ * modification times and sizes of the files it was built from, so only add-ons changed since the
+ * cache was written are parsed again. A cache written by another build or in another format is
+ * discarded.
+ */
+class CAddonManifestCache
+{
+public:
+  /*!
+   * @param path The cache file.
+   */
+  explicit CAddonManifestCache(std::string path) : m_path(std::move(path)) {}
+
+  /*!
+   * @brief Read the cache file. A missing, outdated or damaged file leaves the cache empty.
+   */
+  void Load();
+
+  /*!
+   * @brief Write the cache file if anything changed. Only the directories requested since the
+   * cache was loaded are kept, so removed add-ons drop out.
+   * @return True on success or if nothing changed, false otherwise.
+   */
+  bool Save();
+
+  /*!
+   * @brief Get the manifest of the add-on in the given directory, from the cache if the directory
+   * did not change since it was cached, parsed from its addon.xml otherwise.
+   * @param addonPath The add-on directory.
+   * @return The add-on info or nullptr if the manifest is invalid or the add-on is not supported
+   * on this platform.
+   */
+  AddonInfoPtr Get(const std::string& addonPath);
+
+  unsigned int GetHits() const { return m_hits; }
+  unsigned int GetMisses() const { return m_misses; }
+
+  /*!
+   * @brief Serialize an add-on info to the binary format of the cache.
+   */
+  static std::string Serialize(const CAddonInfo& addon);
+
+  /*!
+   * @brief Deserialize an add-on info serialized with Serialize().
+   * @return The add-on info or nullptr if the data is damaged.
+   */
+  static AddonInfoPtr Deserialize(std::string_view data);
+
+private:
+  using Fingerprint = std::vector<int64_t>;
+
+  static Fingerprint GetFingerprint(const std::string& addonPath);
+
+  struct Entry
+  {
+    Fingerprint fingerprint;
+    std::string data;
+    bool used{false};
+  };
+
+  const std::string m_path;
+  std::map<std::string, Entry, std::less<>> m_entries; //!< key is the translated directory path
+  bool m_changed{false};
+  unsigned int m_hits{0};
+  unsigned int m_misses{0};
+};
+
+} /* namespace ADDON */
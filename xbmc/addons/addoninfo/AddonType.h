@@ -112,6 +112,7 @@ private:
   friend class CAddonInfoBuilder;
   friend class CAddonInfoBuilderFromDB;
   friend class CAddonDatabaseSerializer;
+  friend class CAddonManifestSerializer;
 
   void SetProvides(const std::string& content);
 
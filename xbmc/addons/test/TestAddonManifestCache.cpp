@@ -0,0 +1,322 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "addons/Repository.h"
+#include "addons/addoninfo/AddonInfo.h"
+#include "addons/addoninfo/AddonInfoBuilder.h"
+#include "addons/addoninfo/AddonManifestCache.h"
+#include "addons/addoninfo/AddonType.h"
+#include "filesystem/Directory.h"
+#include "filesystem/File.h"
+#include "utils/StringUtils.h"
+#include "utils/URIUtils.h"
+#include "utils/XBMCTinyXML2.h"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ADDON;
+
+namespace
+{
+const std::string addonXML = R"xml(
+<addon id="metadata.blablabla.org"
+       name="The Bla Bla Bla Addon"
+       version="1.2.3"
+       provider-name="Team Kodi">
+  <requires>
+    <import addon="xbmc.metadata" version="2.1.0"/>
+    <import addon="plugin.video.youtube" minversion="4.4.0" version="4.4.10" optional="true"/>
+  </requires>
+  <extension point="xbmc.metadata.scraper.movies"
+             language="en"
+             library="blablabla.xml">
+    <menu id="kodi.core.main">
+      <item library="menu.py">
+        <label>1234</label>
+      </item>
+    </menu>
+  </extension>
+  <extension point="xbmc.python.module"
+             library="lib.so"/>
+  <extension point="kodi.addon.metadata">
+    <summary lang="en">Summary bla bla bla</summary>
+    <summary lang="de">Zusammenfassung bla bla bla</summary>
+    <description lang="en">Description bla bla bla</description>
+    <platform>all</platform>
+    <language>marsian</language>
+    <license>GPL v2.0</license>
+    <assets>
+      <icon>icon.png</icon>
+      <fanart>fanart.jpg</fanart>
+      <screenshot>screenshot-01.jpg</screenshot>
+    </assets>
+  </extension>
+</addon>
+)xml";
+
+AddonInfoPtr GenerateAddon()
+{
+  CXBMCTinyXML2 doc;
+  if (!doc.Parse(addonXML))
+    return {};
+
+  RepositoryDirInfo repo;
+  return CAddonInfoBuilder::Generate(doc.RootElement(), repo);
+}
+} // unnamed namespace
+
+TEST(TestAddonManifestCache, RoundTrip)
+{
+  const AddonInfoPtr addon = GenerateAddon();
+  ASSERT_NE(nullptr, addon);
+
+  const AddonInfoPtr cached =
+      CAddonManifestCache::Deserialize(CAddonManifestCache::Serialize(*addon));
+  ASSERT_NE(nullptr, cached);
+
+  EXPECT_EQ(cached->ID(), addon->ID());
+  EXPECT_EQ(cached->MainType(), AddonType::SCRAPER_MOVIES);
+  EXPECT_TRUE(cached->HasType(AddonType::SCRIPT_MODULE));
+  EXPECT_EQ(cached->Type(AddonType::SCRIPT_MODULE)->LibName(), "lib.so");
+  EXPECT_EQ(cached->Type(AddonType::SCRAPER_MOVIES)->GetValue("@language").asString(), "en");
+  const CAddonExtensions* menu = cached->Type(AddonType::SCRAPER_MOVIES)->GetElement("menu");
+  ASSERT_NE(nullptr, menu);
+  EXPECT_EQ(menu->GetValue("item@library").asString(), "menu.py");
+  const CAddonExtensions* item = menu->GetElement("item");
+  ASSERT_NE(nullptr, item);
+  EXPECT_EQ(item->GetValue("label").asString(), "1234");
+
+  EXPECT_EQ(cached->Version(), addon->Version());
+  EXPECT_EQ(cached->Name(), addon->Name());
+  EXPECT_EQ(cached->Author(), addon->Author());
+  EXPECT_EQ(cached->Summary(), addon->Summary());
+  EXPECT_EQ(cached->Description(), addon->Description());
+  EXPECT_EQ(cached->License(), addon->License());
+  EXPECT_EQ(cached->Path(), addon->Path());
+  EXPECT_EQ(cached->Icon(), addon->Icon());
+  EXPECT_EQ(cached->Art(), addon->Art());
+  EXPECT_EQ(cached->Screenshots(), addon->Screenshots());
+  EXPECT_EQ(cached->GetDependencies(), addon->GetDependencies());
+  EXPECT_EQ(cached->ExtraInfo(), addon->ExtraInfo());
+  EXPECT_EQ(cached->InstanceUseType(), addon->InstanceUseType());
+}
+
+TEST(TestAddonManifestCache, DamagedData)
+{
+  const AddonInfoPtr addon = GenerateAddon();
+  ASSERT_NE(nullptr, addon);
+
+  const std::string data = CAddonManifestCache::Serialize(*addon);
+  EXPECT_EQ(nullptr, CAddonManifestCache::Deserialize(""));
+  EXPECT_EQ(nullptr,
+            CAddonManifestCache::Deserialize(std::string_view(data).substr(0, data.size() / 2)));
+  EXPECT_EQ(nullptr, CAddonManifestCache::Deserialize(data + "x"));
+
+  std::string corrupted = data;
+  corrupted.replace(0, 8, 8, '\x7f'); // length of the id, far beyond the end of the data
+  EXPECT_EQ(nullptr, CAddonManifestCache::Deserialize(corrupted));
+}
+
+class TestAddonManifestCacheFile : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    XFILE::CDirectory::RemoveRecursive(FOLDER);
+    ASSERT_TRUE(XFILE::CDirectory::Create(FOLDER));
+  }
+
+  void TearDown() override { XFILE::CDirectory::RemoveRecursive(FOLDER); }
+
+  static std::string WriteAddon(const std::string& id, const std::string& version)
+  {
+    const std::string addonPath = URIUtils::AddFileToFolder(FOLDER, id);
+    XFILE::CDirectory::Create(addonPath);
+
+    std::string xml = addonXML;
+    StringUtils::Replace(xml, "metadata.blablabla.org", id);
+    StringUtils::Replace(xml, "version=\"1.2.3\"", "version=\"" + version + "\"");
+    WriteFile(URIUtils::AddFileToFolder(addonPath, "addon.xml"), xml);
+    return addonPath;
+  }
+
+  static void WriteFile(const std::string& path, const std::string& data)
+  {
+    XFILE::CFile file;
+    ASSERT_TRUE(file.OpenForWrite(path, true));
+    ASSERT_EQ(static_cast<ssize_t>(data.size()), file.Write(data.data(), data.size()));
+  }
+
+  static std::string ReadFile(const std::string& path)
+  {
+    std::vector<uint8_t> buffer;
+    XFILE::CFile().LoadFile(path, buffer);
+    return std::string(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+  }
+
+  static std::vector<std::string> GetFiles()
+  {
+    CFileItemList items;
+    XFILE::CDirectory::GetDirectory(FOLDER, items, "", XFILE::DIR_FLAG_NO_FILE_DIRS);
+    std::vector<std::string> files;
+    for (const auto& item : items)
+    {
+      if (!item->IsFolder())
+        files.emplace_back(URIUtils::GetFileName(item->GetPath()));
+    }
+    return files;
+  }
+
+  // replaces the string of the cache header at the given offset, the build id
+  static void ReplaceHeaderString(size_t offset, std::string_view value)
+  {
+    std::string data = ReadFile(CACHE);
+    ASSERT_GT(data.size(), offset + sizeof(int64_t));
+    int64_t size;
+    std::memcpy(&size, data.data() + offset, sizeof(size));
+    const auto newSize = static_cast<int64_t>(value.size());
+    data.replace(offset, sizeof(size) + size,
+                 std::string(reinterpret_cast<const char*>(&newSize), sizeof(newSize)) +
+                     std::string(value));
+    WriteFile(CACHE, data);
+  }
+
+  static constexpr const char* FOLDER = "special://temp/addonmanifestcache/";
+  static constexpr const char* CACHE = "special://temp/addonmanifestcache/AddonManifests.cache";
+};
+
+TEST_F(TestAddonManifestCacheFile, UnchangedAddonIsCached)
+{
+  const std::string addonPath = WriteAddon("metadata.a", "1.0.0");
+  {
+    CAddonManifestCache cache(CACHE);
+    cache.Load();
+    ASSERT_NE(nullptr, cache.Get(addonPath));
+    EXPECT_EQ(1u, cache.GetMisses());
+    EXPECT_TRUE(cache.Save());
+  }
+
+  // the cache file is written in place of a temporary file
+  EXPECT_EQ(std::vector<std::string>{"AddonManifests.cache"}, GetFiles());
+
+  CAddonManifestCache cache(CACHE);
+  cache.Load();
+  const AddonInfoPtr addon = cache.Get(addonPath);
+  ASSERT_NE(nullptr, addon);
+  EXPECT_EQ("metadata.a", addon->ID());
+  EXPECT_EQ(CAddonVersion("1.0.0"), addon->Version());
+  EXPECT_EQ(1u, cache.GetHits());
+  EXPECT_EQ(0u, cache.GetMisses());
+}
+
+TEST_F(TestAddonManifestCacheFile, ChangedAddonIsParsed)
+{
+  const std::string addonPath = WriteAddon("metadata.a", "1.0.0");
+  {
+    CAddonManifestCache cache(CACHE);
+    cache.Load();
+    ASSERT_NE(nullptr, cache.Get(addonPath));
+    EXPECT_TRUE(cache.Save());
+  }
+
+  // a longer version changes the size of addon.xml, even if written within the same second
+  WriteAddon("metadata.a", "1.0.10");
+
+  CAddonManifestCache cache(CACHE);
+  cache.Load();
+  const AddonInfoPtr addon = cache.Get(addonPath);
+  ASSERT_NE(nullptr, addon);
+  EXPECT_EQ(CAddonVersion("1.0.10"), addon->Version());
+  EXPECT_EQ(0u, cache.GetHits());
+  EXPECT_EQ(1u, cache.GetMisses());
+}
+
+TEST_F(TestAddonManifestCacheFile, RemovedAddonIsDropped)
+{
+  const std::string addonPathA = WriteAddon("metadata.a", "1.0.0");
+  const std::string addonPathB = WriteAddon("metadata.b", "1.0.0");
+  {
+    CAddonManifestCache cache(CACHE);
+    cache.Load();
+    ASSERT_NE(nullptr, cache.Get(addonPathA));
+    ASSERT_NE(nullptr, cache.Get(addonPathB));
+    EXPECT_TRUE(cache.Save());
+  }
+  {
+    // b is not installed anymore
+    CAddonManifestCache cache(CACHE);
+    cache.Load();
+    ASSERT_NE(nullptr, cache.Get(addonPathA));
+    EXPECT_EQ(1u, cache.GetHits());
+    EXPECT_TRUE(cache.Save());
+  }
+
+  CAddonManifestCache cache(CACHE);
+  cache.Load();
+  ASSERT_NE(nullptr, cache.Get(addonPathA));
+  ASSERT_NE(nullptr, cache.Get(addonPathB));
+  EXPECT_EQ(1u, cache.GetHits());
+  EXPECT_EQ(1u, cache.GetMisses());
+}
+
+TEST_F(TestAddonManifestCacheFile, OtherBuildIsDiscarded)
+{
+  const std::string addonPath = WriteAddon("metadata.a", "1.0.0");
+  {
+    CAddonManifestCache cache(CACHE);
+    cache.Load();
+    ASSERT_NE(nullptr, cache.Get(addonPath));
+    EXPECT_TRUE(cache.Save());
+  }
+
+  // magic string and format version come before the build id
+  const size_t buildIdOffset = sizeof(int64_t) + std::string_view("KODIADDONCACHE").size() +
+                               sizeof(int64_t);
+  ReplaceHeaderString(buildIdOffset, "another build");
+
+  CAddonManifestCache cache(CACHE);
+  cache.Load();
+  ASSERT_NE(nullptr, cache.Get(addonPath));
+  EXPECT_EQ(0u, cache.GetHits());
+  EXPECT_EQ(1u, cache.GetMisses());
+}
+
+TEST_F(TestAddonManifestCacheFile, OtherVersionIsDiscarded)
+{
+  const std::string addonPath = WriteAddon("metadata.a", "1.0.0");
+  {
+    CAddonManifestCache cache(CACHE);
+    cache.Load();
+    ASSERT_NE(nullptr, cache.Get(addonPath));
+    EXPECT_TRUE(cache.Save());
+  }
+
+  // the format version follows the magic string
+  std::string data = ReadFile(CACHE);
+  const size_t versionOffset = sizeof(int64_t) + std::string_view("KODIADDONCACHE").size();
+  ASSERT_GT(data.size(), versionOffset + sizeof(int64_t));
+  int64_t version;
+  std::memcpy(&version, data.data() + versionOffset, sizeof(version));
+  version++;
+  std::memcpy(data.data() + versionOffset, &version, sizeof(version));
+  WriteFile(CACHE, data);
+
+  CAddonManifestCache cache(CACHE);
+  cache.Load();
+  ASSERT_NE(nullptr, cache.Get(addonPath));
+  EXPECT_EQ(0u, cache.GetHits());
+  EXPECT_EQ(1u, cache.GetMisses());
+}
@@ -59,6 +59,7 @@
 #ifdef HAVE_LIBBLURAY
 #include "filesystem/BlurayDiscCache.h"
 #endif
+#include "filesystem/ChangeJournal.h"
 #include "filesystem/Directory.h"
 #include "filesystem/DirectoryCache.h"
 #include "filesystem/DirectoryFactory.h"
@@ -397,6 +398,9 @@ bool CApplication::Create()
     }
   }
 
+  if (settingsComponent->GetAdvancedSettings()->m_traceMessageLatency)
+    appMessenger->SetLatencyTracing(true);
+
   CUtil::InitRandomSeed();
 
   m_lastRenderTime = std::chrono::steady_clock::now();
@@ -2120,6 +2124,7 @@ bool CApplication::Stop(int exitCode)
     // Add this here to keep the same ordering behaviour for now
     // Needs cleaning up
     CServiceBroker::GetAppMessenger()->Stop();
+    CServiceBroker::GetAppMessenger()->SetLatencyTracing(false);
     m_AppFocused = false;
     m_ExitCode = exitCode;
     CLog::Log(LOGINFO, "Stopping all");
@@ -2134,6 +2139,8 @@ bool CApplication::Stop(int exitCode)
     if (CVideoLibraryQueue::GetInstance().IsRunning())
       CVideoLibraryQueue::GetInstance().CancelAllJobs();
 
+    XFILE::CChangeJournal::GetInstance().Stop();
+
     CServiceBroker::GetAppMessenger()->Cleanup();
 
     m_ServiceManager->GetNetwork().NetworkMessage(CNetworkBase::SERVICES_DOWN, 0);
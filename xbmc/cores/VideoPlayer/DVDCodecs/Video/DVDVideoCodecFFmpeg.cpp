@@ -420,6 +420,10 @@ bool CDVDVideoCodecFFmpeg::Open(CDVDStreamInfo &hints, CDVDCodecOptions &options
     m_pCodecContext->skip_loop_filter = static_cast<AVDiscard>(iSkipLoopFilter);
   }
 
+  // only key frames are wanted, e.g. when extracting a thumbnail
+  if (hints.codecOptions & CODEC_KEYFRAMES_ONLY)
+    m_pCodecContext->skip_frame = AVDISCARD_NONKEY;
+
   // set any special options
   for(std::vector<CDVDCodecOption>::iterator it = options.m_keys.begin(); it != options.m_keys.end(); ++it)
   {
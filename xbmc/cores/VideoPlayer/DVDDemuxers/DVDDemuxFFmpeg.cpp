@@ -359,6 +359,8 @@ bool CDVDDemuxFFmpeg::Open(const std::shared_ptr<CDVDInputStream>& pInput, bool
 
     if (blockSize > 1 && seekable) // non seakable input streams are not supposed to set block size
       bufferSize = blockSize;
+    else if (fileinfo && seekable)
+      bufferSize = 65536; // fewer, larger reads while probing the headers of files on shares
 
     unsigned char* buffer = (unsigned char*)av_malloc(bufferSize);
     m_ioContext = avio_alloc_context(buffer, bufferSize, 0, this, dvd_file_read, NULL, dvd_file_seek);
@@ -489,6 +491,13 @@ bool CDVDDemuxFFmpeg::Open(const std::shared_ptr<CDVDInputStream>& pInput, bool
     if (m_pInput->IsStreamType(DVDSTREAM_TYPE_DVD))
       av_opt_set_int(m_pFormatContext, "analyzeduration", 500000, 0);
 
+    // the stream details of matroska and mp4 files are declared in their headers
+    if (fileinfo && (m_bMatroska || strncmp(m_pFormatContext->iformat->name, "mov", 3) == 0))
+    {
+      av_opt_set_int(m_pFormatContext, "analyzeduration", 500000, 0);
+      m_pFormatContext->fps_probe_size = 0;
+    }
+
     CLog::Log(LOGDEBUG, "{} - avformat_find_stream_info starting", __FUNCTION__);
     int iErr = avformat_find_stream_info(m_pFormatContext, NULL);
     if (iErr < 0)
@@ -152,7 +152,7 @@ std::unique_ptr<CTexture> CDVDFileInfo::ExtractThumbToTexture(const CFileItem& f
     pProcessInfo->SetPixFormats(pixFmts);
 
     CDVDStreamInfo hint(*demuxer->GetStream(demuxerId, nVideoStream), true);
-    hint.codecOptions = CODEC_FORCE_SOFTWARE;
+    hint.codecOptions = CODEC_FORCE_SOFTWARE | CODEC_KEYFRAMES_ONLY;
 
     std::unique_ptr<CDVDVideoCodec> pVideoCodec =
         CDVDFactoryCodec::CreateVideoCodec(hint, *pProcessInfo);
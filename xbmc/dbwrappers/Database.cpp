@@ -31,6 +31,8 @@
 #include <cstdlib>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 using namespace dbiplus;
 
@@ -520,6 +522,187 @@ size_t CDatabase::GetDeleteQueriesCount() const
   return m_pDS->delete_sql_count();
 }
 
+bool CDatabase::BeginBulkImport(unsigned int batchSize, bool deferAnalytics /* = false */)
+{
+  if (nullptr == m_pDB || nullptr == m_pDS || m_bulkImport || m_pDB->in_transaction())
+    return false;
+
+  m_bulkImportDeferred = deferAnalytics && DeferAnalytics();
+
+  BeginTransaction();
+  m_bulkImport = true;
+  m_bulkImportBatchSize = batchSize;
+  m_bulkImportItems = 0;
+  m_savepoints = 0;
+  return true;
+}
+
+bool CDatabase::BulkImportItemDone()
+{
+  if (!m_bulkImport)
+    return false;
+
+  m_bulkImportItems++;
+  if (m_bulkImportBatchSize == 0 || m_bulkImportItems % m_bulkImportBatchSize != 0 ||
+      m_savepoints > 0)
+    return true;
+
+  try
+  {
+    m_pDB->commit_transaction();
+    m_pDB->start_transaction();
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "unable to commit batch");
+    return false;
+  }
+  return true;
+}
+
+bool CDatabase::CommitBulkImport()
+{
+  if (!m_bulkImport)
+    return false;
+
+  CLog::LogF(LOGDEBUG, "imported {} items", m_bulkImportItems);
+  m_bulkImport = false;
+  bool success = CommitTransaction();
+  if (m_bulkImportDeferred)
+  {
+    m_bulkImportDeferred = false;
+    success = RestoreDeferredAnalytics() && success;
+  }
+  return success;
+}
+
+void CDatabase::RollbackBulkImport()
+{
+  if (!m_bulkImport)
+    return;
+
+  m_bulkImport = false;
+  RollbackTransaction();
+  if (m_bulkImportDeferred)
+  {
+    m_bulkImportDeferred = false;
+    RestoreDeferredAnalytics();
+  }
+}
+
+bool CDatabase::DeferAnalytics()
+{
+  if (!m_sqlite || nullptr == m_pDB || nullptr == m_pDS || m_pDB->in_transaction())
+    return false;
+
+  const std::vector<std::string> names = GetDeferrableAnalytics();
+  if (names.empty())
+    return false;
+
+  unsigned int deferred = 0;
+  BeginTransaction();
+  try
+  {
+    // DDL is transactional in SQLite, the statements are committed together with the drop
+    m_pDS->exec("CREATE TABLE IF NOT EXISTS deferred_analytics (name TEXT PRIMARY KEY, sql TEXT)");
+    for (const auto& name : names)
+    {
+      m_pDS->query(PrepareSQL("SELECT type FROM sqlite_master WHERE name = '%s'", name.c_str()));
+      if (m_pDS->eof())
+      {
+        m_pDS->close();
+        continue;
+      }
+      const std::string type = m_pDS->fv(0).get_asString();
+      m_pDS->close();
+      if (type != "index" && type != "trigger")
+        continue;
+
+      // copied within SQLite, the statement text must not pass through PrepareSQL()
+      m_pDS->exec(PrepareSQL("INSERT OR REPLACE INTO deferred_analytics (name, sql) "
+                             "SELECT name, sql FROM sqlite_master WHERE name = '%s'",
+                             name.c_str()));
+      if (type == "index")
+        m_pDS->exec(PrepareSQL("DROP INDEX %s", name.c_str()));
+      else
+        m_pDS->exec(PrepareSQL("DROP TRIGGER %s", name.c_str()));
+      deferred++;
+    }
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "unable to defer analytics");
+    RollbackTransaction();
+    return false;
+  }
+
+  if (!CommitTransaction())
+    return false;
+
+  CLog::LogF(LOGDEBUG, "deferred {} indices and triggers", deferred);
+  return true;
+}
+
+bool CDatabase::RestoreDeferredAnalytics()
+{
+  if (!m_sqlite)
+    return true;
+  if (nullptr == m_pDB || nullptr == m_pDS || m_pDB->in_transaction())
+    return false;
+
+  std::vector<std::pair<std::string, std::string>> analytics;
+  try
+  {
+    m_pDS->query("SELECT name FROM sqlite_master WHERE type = 'table' AND "
+                 "name = 'deferred_analytics'");
+    const bool deferred = !m_pDS->eof();
+    m_pDS->close();
+    if (!deferred)
+      return true;
+
+    m_pDS->query("SELECT name, sql FROM deferred_analytics");
+    while (!m_pDS->eof())
+    {
+      analytics.emplace_back(m_pDS->fv(0).get_asString(), m_pDS->fv(1).get_asString());
+      m_pDS->next();
+    }
+    m_pDS->close();
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "unable to get the deferred analytics");
+    return false;
+  }
+
+  if (analytics.empty())
+    return true;
+
+  BeginTransaction();
+  try
+  {
+    UpdateDeferredAnalytics();
+    for (const auto& [name, sql] : analytics)
+    {
+      // a schema update since they were deferred has created them already
+      m_pDS->query(PrepareSQL("SELECT 1 FROM sqlite_master WHERE name = '%s'", name.c_str()));
+      const bool exists = !m_pDS->eof();
+      m_pDS->close();
+      if (!exists)
+        m_pDS->exec(sql);
+    }
+    m_pDS->exec("DELETE FROM deferred_analytics");
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "unable to restore deferred analytics");
+    RollbackTransaction();
+    return false;
+  }
+
+  CLog::LogF(LOGDEBUG, "restored {} deferred indices and triggers", analytics.size());
+  return CommitTransaction();
+}
+
 bool CDatabase::Open()
 {
   DatabaseSettings db_fallback;
@@ -707,6 +890,8 @@ void CDatabase::Close()
 
   m_openCount = 0;
   m_multipleExecute = false;
+  m_bulkImport = false;
+  m_bulkImportDeferred = false;
 
   if (nullptr == m_pDB)
     return;
@@ -765,7 +950,9 @@ void CDatabase::BeginTransaction()
 {
   try
   {
-    if (nullptr != m_pDB)
+    if (m_bulkImport)
+      m_pDS->exec(PrepareSQL("SAVEPOINT item%u", m_savepoints++));
+    else if (nullptr != m_pDB)
       m_pDB->start_transaction();
   }
   catch (...)
@@ -778,7 +965,12 @@ bool CDatabase::CommitTransaction()
 {
   try
   {
-    if (nullptr != m_pDB)
+    if (m_bulkImport)
+    {
+      if (m_savepoints > 0)
+        m_pDS->exec(PrepareSQL("RELEASE SAVEPOINT item%u", --m_savepoints));
+    }
+    else if (nullptr != m_pDB)
       m_pDB->commit_transaction();
   }
   catch (...)
@@ -793,7 +985,15 @@ void CDatabase::RollbackTransaction()
 {
   try
   {
-    if (nullptr != m_pDB)
+    if (m_bulkImport)
+    {
+      if (m_savepoints > 0)
+      {
+        m_pDS->exec(PrepareSQL("ROLLBACK TO SAVEPOINT item%u", --m_savepoints));
+        m_pDS->exec(PrepareSQL("RELEASE SAVEPOINT item%u", m_savepoints));
+      }
+    }
+    else if (nullptr != m_pDB)
       m_pDB->rollback_transaction();
   }
   catch (...)
@@ -241,6 +241,59 @@ public:
    */
   size_t GetDeleteQueriesCount() const;
 
+  /*!
+   * @brief Start a bulk import session. Everything written until CommitBulkImport() is written
+   *        in large transactions instead of one per item. Transactions begun meanwhile become
+   *        savepoints within them, so items can still be rolled back on their own.
+   * @param batchSize The number of items to commit at once, see BulkImportItemDone(). 0 to write
+   *        the whole import in a single transaction.
+   * @param deferAnalytics Whether to drop the indices and triggers returned by
+   *        GetDeferrableAnalytics() for the session, see DeferAnalytics().
+   * @return True if the session was started, false otherwise.
+   * @sa BulkImportItemDone, CommitBulkImport, RollbackBulkImport
+   */
+  bool BeginBulkImport(unsigned int batchSize, bool deferAnalytics = false);
+
+  /*!
+   * @brief Tell the bulk import session that an item was imported. Commits the current batch
+   *        once it is full.
+   * @return True if successful, false if the batch could not be committed.
+   */
+  bool BulkImportItemDone();
+
+  /*!
+   * @brief Finish a bulk import session. Commits the remaining items and creates the analytics
+   *        the session deferred again.
+   * @return True if successful, false otherwise.
+   */
+  bool CommitBulkImport();
+
+  /*!
+   * @brief Abort a bulk import session. The items since the last commit are rolled back, which are
+   *        all of them if the batch size is 0. Analytics the session deferred are created again.
+   */
+  void RollbackBulkImport();
+
+  bool InBulkImport() const { return m_bulkImport; }
+
+  /*!
+   * @brief Drop the indices and triggers returned by GetDeferrableAnalytics(), so that they are
+   *        not maintained row by row while importing. SQLite only. The statements creating them
+   *        are stored in the database together with the drop, so imports spanning several bulk
+   *        import sessions or transactions can defer them too, and an interrupted import does not
+   *        lose them.
+   * @return True if the analytics were deferred, false otherwise.
+   * @sa RestoreDeferredAnalytics
+   */
+  bool DeferAnalytics();
+
+  /*!
+   * @brief Do what the deferred triggers would have done and create the deferred analytics
+   *        again, in a transaction of its own. Does nothing if no analytics are deferred.
+   * @return True if successful, false otherwise.
+   */
+  bool RestoreDeferredAnalytics();
+
   virtual bool GetFilter(CDbUrl& dbUrl, Filter& filter, SortDescription& sorting) { return true; }
   virtual bool BuildSQL(const std::string& strBaseDir,
                         const std::string& strQuery,
@@ -302,6 +355,17 @@ protected:
   virtual int GetSchemaVersion() const = 0;
   virtual const char* GetBaseDBName() const = 0;
 
+  /* \brief Names of the indices and triggers that may be dropped during a bulk import.
+   Indices used to look up rows while importing must not be listed, nor unique indices that are
+   the only ones enforcing their constraint.
+   */
+  virtual std::vector<std::string> GetDeferrableAnalytics() const { return {}; }
+
+  /* \brief Do what the deferred triggers would have done for the rows written while they were
+   dropped. Called before they are created again.
+   */
+  virtual void UpdateDeferredAnalytics() {}
+
   int GetDBVersion();
 
   bool BuildSQL(std::string_view strQuery, const Filter& filter, std::string& strSQL) const;
@@ -327,4 +391,10 @@ private:
 
   bool m_multipleExecute{false};
   std::vector<std::string> m_multipleQueries;
+
+  bool m_bulkImport{false};
+  unsigned int m_bulkImportBatchSize{0};
+  unsigned int m_bulkImportItems{0};
+  unsigned int m_savepoints{0}; ///< transactions begun within the bulk import
+  bool m_bulkImportDeferred{false}; ///< whether the bulk import deferred the analytics
 };
@@ -0,0 +1,285 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "dbwrappers/Database.h"
+#include "dbwrappers/dataset.h"
+#include "filesystem/File.h"
+#include "filesystem/SpecialProtocol.h"
+#include "settings/AdvancedSettings.h"
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+const std::string DATABASE_NAME = "TestBulkImport.db";
+
+class CTestDatabase : public CDatabase
+{
+public:
+  void Insert(const std::string& name)
+  {
+    m_pDS->exec(PrepareSQL("INSERT INTO item (name, added) VALUES ('%s', '2026-01-01')",
+                           name.c_str()));
+  }
+
+  bool AddItem(const std::string& name)
+  {
+    BeginTransaction();
+    Insert(name);
+    return CommitTransaction();
+  }
+
+  int Count(const std::string& table) const
+  {
+    return GetSingleValueInt("SELECT COUNT(1) FROM " + table);
+  }
+
+  bool HasAnalytics(const std::string& name) const
+  {
+    return GetSingleValueInt(
+               PrepareSQL("SELECT COUNT(1) FROM sqlite_master WHERE name = '%s'", name.c_str())) ==
+           1;
+  }
+
+protected:
+  void CreateTables() override
+  {
+    m_pDS->exec("CREATE TABLE item (idItem INTEGER PRIMARY KEY, name TEXT, added TEXT)");
+    m_pDS->exec("CREATE TABLE item_log (idItem INTEGER)");
+  }
+
+  void CreateAnalytics() override
+  {
+    m_pDS->exec("CREATE INDEX ix_item_name ON item (name)");
+    m_pDS->exec("CREATE INDEX ix_item_added ON item (added, name)");
+    m_pDS->exec("CREATE TRIGGER tgr_item_insert AFTER INSERT ON item FOR EACH ROW BEGIN "
+                "INSERT INTO item_log (idItem) VALUES (NEW.idItem); END");
+  }
+
+  int GetSchemaVersion() const override { return 1; }
+  const char* GetBaseDBName() const override { return "TestBulkImport"; }
+
+  std::vector<std::string> GetDeferrableAnalytics() const override
+  {
+    return {"ix_item_name", "ix_item_added", "tgr_item_insert", "ix_missing"};
+  }
+
+  void UpdateDeferredAnalytics() override
+  {
+    m_pDS->exec("INSERT INTO item_log (idItem) SELECT idItem FROM item "
+                "WHERE idItem NOT IN (SELECT idItem FROM item_log)");
+  }
+};
+} // unnamed namespace
+
+class TestDatabase : public ::testing::Test
+{
+protected:
+  DatabaseSettings settings;
+  CTestDatabase database;
+  CTestDatabase reader; ///< sees committed rows only
+
+  void SetUp() override
+  {
+    settings.type = "sqlite3";
+    settings.host = CSpecialProtocol::TranslatePath("special://temp/");
+    XFILE::CFile::Delete("special://temp/" + DATABASE_NAME);
+
+    ASSERT_EQ(CDatabase::ConnectionState::STATE_CONNECTED,
+              database.Connect(DATABASE_NAME, settings, true));
+    ASSERT_EQ(CDatabase::ConnectionState::STATE_CONNECTED,
+              reader.Connect(DATABASE_NAME, settings, false));
+  }
+
+  void TearDown() override
+  {
+    database.Close();
+    reader.Close();
+    XFILE::CFile::Delete("special://temp/" + DATABASE_NAME);
+  }
+};
+
+TEST_F(TestDatabase, BulkImportTransactionsBecomeSavepoints)
+{
+  ASSERT_TRUE(database.BeginBulkImport(0));
+  EXPECT_TRUE(database.InBulkImport());
+  EXPECT_FALSE(database.BeginBulkImport(0));
+
+  // SAVEPOINT item0, RELEASE
+  EXPECT_TRUE(database.AddItem("a"));
+
+  // SAVEPOINT item0, ROLLBACK TO and RELEASE
+  database.BeginTransaction();
+  database.Insert("b");
+  database.RollbackTransaction();
+  EXPECT_EQ(1, database.Count("item"));
+
+  // nested: the inner item rolls back on its own
+  database.BeginTransaction();
+  database.Insert("c");
+  database.BeginTransaction();
+  database.Insert("d");
+  database.RollbackTransaction();
+  EXPECT_TRUE(database.CommitTransaction());
+  EXPECT_EQ(2, database.Count("item"));
+
+  // a savepoint is no commit
+  EXPECT_EQ(0, reader.Count("item"));
+
+  EXPECT_TRUE(database.CommitBulkImport());
+  EXPECT_FALSE(database.InBulkImport());
+  EXPECT_EQ(2, reader.Count("item"));
+  EXPECT_EQ("a", reader.GetSingleValue("item", "name", "", "idItem"));
+  EXPECT_EQ(0, reader.Count("item WHERE name IN ('b', 'd')"));
+}
+
+TEST_F(TestDatabase, BulkImportCommitsBatches)
+{
+  ASSERT_TRUE(database.BeginBulkImport(2));
+  for (const char* name : {"a", "b", "c"})
+  {
+    EXPECT_TRUE(database.AddItem(name));
+    EXPECT_TRUE(database.BulkImportItemDone());
+  }
+  EXPECT_EQ(2, reader.Count("item"));
+
+  // not within an item
+  database.BeginTransaction();
+  database.Insert("d");
+  EXPECT_TRUE(database.BulkImportItemDone());
+  EXPECT_TRUE(database.CommitTransaction());
+  EXPECT_EQ(2, reader.Count("item"));
+
+  database.RollbackBulkImport();
+  EXPECT_FALSE(database.InBulkImport());
+  EXPECT_EQ(2, database.Count("item"));
+  EXPECT_EQ(2, reader.Count("item"));
+}
+
+TEST_F(TestDatabase, BulkImportDefersAnalytics)
+{
+  ASSERT_TRUE(database.BeginBulkImport(2, true));
+  EXPECT_FALSE(database.HasAnalytics("ix_item_name"));
+  EXPECT_FALSE(database.HasAnalytics("ix_item_added"));
+  EXPECT_FALSE(database.HasAnalytics("tgr_item_insert"));
+  EXPECT_EQ(3, database.Count("deferred_analytics"));
+
+  for (const char* name : {"a", "b", "c"})
+  {
+    EXPECT_TRUE(database.AddItem(name));
+    EXPECT_TRUE(database.BulkImportItemDone());
+  }
+  EXPECT_EQ(0, database.Count("item_log"));
+
+  EXPECT_TRUE(database.CommitBulkImport());
+  EXPECT_TRUE(reader.HasAnalytics("ix_item_name"));
+  EXPECT_TRUE(reader.HasAnalytics("ix_item_added"));
+  EXPECT_TRUE(reader.HasAnalytics("tgr_item_insert"));
+  EXPECT_EQ(0, reader.Count("deferred_analytics"));
+  EXPECT_EQ(3, reader.Count("item_log"));
+
+  // the triggers are back
+  EXPECT_TRUE(database.AddItem("d"));
+  EXPECT_EQ(4, reader.Count("item_log"));
+}
+
+TEST_F(TestDatabase, RollbackRestoresDeferredAnalytics)
+{
+  ASSERT_TRUE(database.BeginBulkImport(2, true));
+  for (const char* name : {"a", "b", "c"})
+  {
+    EXPECT_TRUE(database.AddItem(name));
+    EXPECT_TRUE(database.BulkImportItemDone());
+  }
+
+  database.RollbackBulkImport();
+  EXPECT_TRUE(reader.HasAnalytics("ix_item_name"));
+  EXPECT_TRUE(reader.HasAnalytics("tgr_item_insert"));
+  EXPECT_EQ(0, reader.Count("deferred_analytics"));
+  EXPECT_EQ(2, reader.Count("item"));
+  EXPECT_EQ(2, reader.Count("item_log"));
+}
+
+TEST_F(TestDatabase, InterruptedImportRestoresAnalytics)
+{
+  ASSERT_TRUE(database.BeginBulkImport(1, true));
+  EXPECT_TRUE(database.AddItem("a"));
+  EXPECT_TRUE(database.BulkImportItemDone());
+  EXPECT_TRUE(database.AddItem("b"));
+  database.Close();
+
+  EXPECT_FALSE(reader.HasAnalytics("ix_item_name"));
+  EXPECT_EQ(3, reader.Count("deferred_analytics"));
+
+  EXPECT_TRUE(reader.RestoreDeferredAnalytics());
+  EXPECT_TRUE(reader.HasAnalytics("ix_item_name"));
+  EXPECT_TRUE(reader.HasAnalytics("ix_item_added"));
+  EXPECT_TRUE(reader.HasAnalytics("tgr_item_insert"));
+  EXPECT_EQ(0, reader.Count("deferred_analytics"));
+  EXPECT_EQ(1, reader.Count("item"));
+  EXPECT_EQ(1, reader.Count("item_log"));
+
+  // nothing left to do
+  EXPECT_TRUE(reader.RestoreDeferredAnalytics());
+}
+
+TEST_F(TestDatabase, DeferAnalyticsAcrossSessions)
+{
+  ASSERT_TRUE(database.DeferAnalytics());
+  for (const char* name : {"a", "b"})
+  {
+    ASSERT_TRUE(database.BeginBulkImport(0));
+    EXPECT_TRUE(database.AddItem(name));
+    EXPECT_TRUE(database.CommitBulkImport());
+  }
+  EXPECT_FALSE(reader.HasAnalytics("ix_item_name"));
+  EXPECT_EQ(2, reader.Count("item"));
+
+  EXPECT_TRUE(database.RestoreDeferredAnalytics());
+  EXPECT_TRUE(reader.HasAnalytics("ix_item_name"));
+  EXPECT_EQ(2, reader.Count("item_log"));
+}
+
+// Benchmark, run with --gtest_also_run_disabled_tests. Imports 100k items with a transaction per
+// item, in bulk import sessions committing every 1000 items, and in such sessions with the
+// analytics deferred.
+TEST_F(TestDatabase, DISABLED_BulkImportBenchmark)
+{
+  constexpr int ITEMS = 100000;
+
+  const auto run = [&](const std::string& property, unsigned int batchSize, bool bulk, bool defer)
+  {
+    if (bulk)
+      ASSERT_TRUE(database.BeginBulkImport(batchSize, defer));
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITEMS; ++i)
+    {
+      ASSERT_TRUE(database.AddItem(property + std::to_string((i * 7919) % ITEMS)));
+      if (bulk)
+        database.BulkImportItemDone();
+    }
+    if (bulk)
+      ASSERT_TRUE(database.CommitBulkImport());
+    const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                        std::chrono::steady_clock::now() - start)
+                        .count();
+    RecordProperty(property + "_rows_per_s",
+                   std::to_string(ITEMS * 1000LL / std::max<long long>(ms, 1)));
+  };
+
+  run("per_item", 0, false, false);
+  run("bulk", 1000, true, false);
+  run("bulk_deferred", 1000, true, true);
+  EXPECT_EQ(3 * ITEMS, reader.Count("item"));
+  EXPECT_EQ(3 * ITEMS, reader.Count("item_log"));
+}
@@ -0,0 +1,239 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ChangeJournal.h"
+
+#include "URL.h"
+#include "utils/log.h"
+
+#if defined(TARGET_LINUX) && !defined(TARGET_ANDROID)
+#include "platform/linux/InotifyChangeMonitor.h"
+#endif
+
+#include <mutex>
+
+using namespace XFILE;
+
+namespace
+{
+// changes are written to the database in batches
+constexpr size_t MAX_PENDING_CHANGES = 256;
+} // unnamed namespace
+
+CChangeJournal& CChangeJournal::GetInstance()
+{
+  static CChangeJournal journal;
+  return journal;
+}
+
+CChangeJournal::~CChangeJournal()
+{
+  Stop();
+}
+
+bool CChangeJournal::GetChanges(const std::string& library,
+                                const std::string& root,
+                                std::set<std::string>& directories,
+                                int& lastChange)
+{
+  std::unique_lock lock(m_critSection);
+  if (!Initialize())
+    return false;
+
+  const CChangeJournalDatabase::Root* journalRoot = FindRoot(library, root);
+  if (!journalRoot || journalRoot->state != CChangeJournalDatabase::RootState::VALID)
+    return false;
+
+  Flush();
+  return m_database.GetChanges(journalRoot->id, directories, lastChange);
+}
+
+bool CChangeJournal::BeginScan(const std::string& library, const std::string& root)
+{
+  std::shared_ptr<IChangeMonitor> monitor;
+  {
+    std::unique_lock lock(m_critSection);
+    if (!Initialize())
+      return false;
+
+    if (!FindRoot(library, root))
+    {
+      const int id = m_database.AddRoot(library, root);
+      if (id < 0)
+        return false;
+
+      m_roots.push_back({id, library, root, CChangeJournalDatabase::RootState::PENDING});
+    }
+    monitor = m_monitor;
+  }
+
+  // watching walks the whole tree, the monitor reports the changes of other roots meanwhile
+  const bool watched = monitor->Watch(root);
+
+  std::unique_lock lock(m_critSection);
+  CChangeJournalDatabase::Root* journalRoot = FindRoot(library, root);
+  if (m_stopped || !journalRoot)
+    return false;
+
+  if (!watched)
+  {
+    CLog::Log(LOGDEBUG, "CChangeJournal: can't watch {}, it is scanned completely",
+              CURL::GetRedacted(root));
+    SetState(*journalRoot, CChangeJournalDatabase::RootState::LOST);
+    return false;
+  }
+
+  // the complete scan covers everything recorded so far
+  m_pendingCount -= m_pending[journalRoot->id].size();
+  m_pending.erase(journalRoot->id);
+  m_database.RemoveChanges(journalRoot->id);
+  SetState(*journalRoot, CChangeJournalDatabase::RootState::PENDING);
+  return true;
+}
+
+void CChangeJournal::EndScan(const std::string& library, const std::string& root, int lastChange)
+{
+  std::unique_lock lock(m_critSection);
+  if (!Initialize())
+    return;
+
+  CChangeJournalDatabase::Root* journalRoot = FindRoot(library, root);
+  if (!journalRoot)
+    return;
+
+  if (lastChange < 0)
+  {
+    // changes lost during the scan keep the root invalid
+    if (journalRoot->state == CChangeJournalDatabase::RootState::PENDING)
+      SetState(*journalRoot, CChangeJournalDatabase::RootState::VALID);
+  }
+  else if (journalRoot->state == CChangeJournalDatabase::RootState::VALID)
+  {
+    // changes recorded during the scan are kept for the next one
+    m_database.RemoveChanges(journalRoot->id, lastChange);
+  }
+}
+
+void CChangeJournal::Stop()
+{
+  std::shared_ptr<IChangeMonitor> monitor;
+  {
+    std::unique_lock lock(m_critSection);
+    if (m_stopped)
+      return;
+
+    m_stopped = true;
+    if (m_monitor)
+      Flush();
+    monitor = std::move(m_monitor);
+  }
+  // the monitor thread may be waiting for the lock in a callback
+  monitor.reset();
+}
+
+void CChangeJournal::OnDirectoryChanged(const std::string& root, const std::string& directory)
+{
+  std::unique_lock lock(m_critSection);
+  if (m_stopped)
+    return;
+
+  for (const auto& journalRoot : m_roots)
+  {
+    if (journalRoot.path != root || journalRoot.state == CChangeJournalDatabase::RootState::LOST)
+      continue;
+
+    if (m_pending[journalRoot.id].insert(directory).second)
+      m_pendingCount++;
+  }
+
+  if (m_pendingCount >= MAX_PENDING_CHANGES)
+    Flush();
+}
+
+void CChangeJournal::OnChangesLost(const std::string& root)
+{
+  std::unique_lock lock(m_critSection);
+  if (m_stopped)
+    return;
+
+  CLog::Log(LOGINFO, "CChangeJournal: changes below {} were lost, it is scanned completely next",
+            CURL::GetRedacted(root));
+
+  for (auto& journalRoot : m_roots)
+  {
+    if (journalRoot.path != root)
+      continue;
+
+    m_pendingCount -= m_pending[journalRoot.id].size();
+    m_pending.erase(journalRoot.id);
+    m_database.RemoveChanges(journalRoot.id);
+    SetState(journalRoot, CChangeJournalDatabase::RootState::LOST);
+  }
+}
+
+bool CChangeJournal::Initialize()
+{
+  if (m_initialized)
+    return m_monitor != nullptr;
+
+  m_initialized = true;
+  if (m_stopped)
+    return false;
+
+#if defined(TARGET_LINUX) && !defined(TARGET_ANDROID)
+  m_monitor = std::make_shared<CInotifyChangeMonitor>(*this);
+#endif
+
+  if (!m_monitor)
+    return false;
+
+  if (!m_database.Open())
+  {
+    m_monitor.reset();
+    return false;
+  }
+
+  // changes made while not running are unknown, every root needs a complete scan again. it is
+  // watched by BeginScan() then, not here with the lock held.
+  m_database.GetRoots(m_roots);
+  for (auto& root : m_roots)
+  {
+    m_database.RemoveChanges(root.id);
+    SetState(root, CChangeJournalDatabase::RootState::LOST);
+  }
+  return true;
+}
+
+CChangeJournalDatabase::Root* CChangeJournal::FindRoot(const std::string& library,
+                                                      const std::string& root)
+{
+  for (auto& journalRoot : m_roots)
+  {
+    if (journalRoot.library == library && journalRoot.path == root)
+      return &journalRoot;
+  }
+  return nullptr;
+}
+
+void CChangeJournal::SetState(CChangeJournalDatabase::Root& root,
+                              CChangeJournalDatabase::RootState state)
+{
+  root.state = state;
+  m_database.SetRootState(root.id, state);
+}
+
+void CChangeJournal::Flush()
+{
+  for (const auto& [idRoot, directories] : m_pending)
+  {
+    if (!directories.empty())
+      m_database.AddChanges(idRoot, directories);
+  }
+  m_pending.clear();
+  m_pendingCount = 0;
+}
@@ -0,0 +1,93 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "ChangeJournalDatabase.h"
+#include "IChangeMonitor.h"
+#include "threads/CriticalSection.h"
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace XFILE
+{
+
+/*!
+ \brief Journal of the directories changed below the roots of the libraries.
+
+ Library scans detect changes by walking every directory of a source and comparing hashes. For
+ roots that can be watched by the platform, the journal records the directories where files or
+ folders were created, moved or deleted, so that a scan only needs to visit those. A root becomes
+ valid once it was scanned completely while being watched, and stays valid as long as no change
+ got lost. Changes made while Kodi is not running are unknown, so all roots need a complete scan
+ again after a restart.
+
+ Each library keeps its own journal for a root, as they are scanned independently.
+ */
+class CChangeJournal : public IChangeMonitorCallback
+{
+public:
+  static CChangeJournal& GetInstance();
+
+  /*!
+   \brief Get the directories changed below a root since its last scan
+   \param library [in] name of the library scanning the root
+   \param root [in] the root, with a trailing slash
+   \param directories [out] the changed directories, some may not exist anymore
+   \param lastChange [out] id of the last change, to pass to EndScan()
+   \return false if the changes are not known and the root needs a complete scan
+   */
+  bool GetChanges(const std::string& library,
+                  const std::string& root,
+                  std::set<std::string>& directories,
+                  int& lastChange);
+
+  /*!
+   \brief Start journaling a root ahead of its complete scan
+   \return false if the root can't be watched
+   */
+  bool BeginScan(const std::string& library, const std::string& root);
+
+  /*!
+   \brief Mark a successful scan of a root
+   \param lastChange [in] the last change handled by an incremental scan, -1 after a complete scan
+   */
+  void EndScan(const std::string& library, const std::string& root, int lastChange);
+
+  /*!
+   \brief Stop watching, called on shutdown
+   */
+  void Stop();
+
+  void OnDirectoryChanged(const std::string& root, const std::string& directory) override;
+  void OnChangesLost(const std::string& root) override;
+
+private:
+  CChangeJournal() = default;
+  ~CChangeJournal() override;
+
+  bool Initialize();
+  CChangeJournalDatabase::Root* FindRoot(const std::string& library, const std::string& root);
+  void SetState(CChangeJournalDatabase::Root& root, CChangeJournalDatabase::RootState state);
+  void Flush();
+
+  CCriticalSection m_critSection;
+  bool m_initialized = false;
+  bool m_stopped = false;
+  std::shared_ptr<IChangeMonitor> m_monitor; // shared with Watch() calls made without the lock
+  CChangeJournalDatabase m_database;
+  std::vector<CChangeJournalDatabase::Root> m_roots;
+  std::map<int, std::set<std::string>> m_pending; // changes not written yet, by root id
+  size_t m_pendingCount = 0;
+};
+
+} // namespace XFILE
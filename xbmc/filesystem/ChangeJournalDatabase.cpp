@@ -0,0 +1,187 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ChangeJournalDatabase.h"
+
+#include "dbwrappers/dataset.h"
+#include "utils/log.h"
+
+#include <algorithm>
+
+using namespace XFILE;
+
+CChangeJournalDatabase::CChangeJournalDatabase() = default;
+
+CChangeJournalDatabase::~CChangeJournalDatabase() = default;
+
+bool CChangeJournalDatabase::Open()
+{
+  return CDatabase::Open();
+}
+
+void CChangeJournalDatabase::CreateTables()
+{
+  CLog::Log(LOGINFO, "create journalroot table");
+  m_pDS->exec("CREATE TABLE journalroot ("
+              "idRoot integer primary key,"
+              "strLibrary text,"
+              "strPath text,"
+              "iState integer)");
+
+  CLog::Log(LOGINFO, "create journalchange table");
+  m_pDS->exec("CREATE TABLE journalchange ("
+              "idChange integer primary key,"
+              "idRoot integer,"
+              "strPath text)");
+}
+
+void CChangeJournalDatabase::CreateAnalytics()
+{
+  CLog::Log(LOGINFO, "{} - creating indices", __FUNCTION__);
+  m_pDS->exec("CREATE UNIQUE INDEX idxJournalRoot ON journalroot(strLibrary, strPath)");
+  m_pDS->exec("CREATE INDEX idxJournalChange ON journalchange(idRoot)");
+}
+
+void CChangeJournalDatabase::UpdateTables(int version)
+{
+}
+
+bool CChangeJournalDatabase::GetRoots(std::vector<Root>& roots)
+{
+  try
+  {
+    if (nullptr == m_pDB)
+      return false;
+    if (nullptr == m_pDS)
+      return false;
+
+    if (!m_pDS->query("SELECT idRoot, strLibrary, strPath, iState FROM journalroot"))
+      return false;
+
+    while (!m_pDS->eof())
+    {
+      Root root;
+      root.id = m_pDS->fv(0).get_asInt();
+      root.library = m_pDS->fv(1).get_asString();
+      root.path = m_pDS->fv(2).get_asString();
+      root.state = static_cast<RootState>(m_pDS->fv(3).get_asInt());
+      roots.push_back(std::move(root));
+      m_pDS->next();
+    }
+    m_pDS->close();
+    return true;
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "failed");
+  }
+  return false;
+}
+
+int CChangeJournalDatabase::AddRoot(const std::string& library, const std::string& path)
+{
+  try
+  {
+    if (nullptr == m_pDB)
+      return -1;
+    if (nullptr == m_pDS)
+      return -1;
+
+    m_pDS->query(
+        PrepareSQL("SELECT idRoot FROM journalroot WHERE strLibrary='%s' AND strPath='%s'",
+                   library.c_str(), path.c_str()));
+    if (!m_pDS->eof())
+    {
+      const int idRoot = m_pDS->fv(0).get_asInt();
+      m_pDS->close();
+      return idRoot;
+    }
+    m_pDS->close();
+
+    m_pDS->exec(PrepareSQL("INSERT INTO journalroot (idRoot, strLibrary, strPath, iState) "
+                           "VALUES (NULL, '%s', '%s', %i)",
+                           library.c_str(), path.c_str(), static_cast<int>(RootState::PENDING)));
+    return static_cast<int>(m_pDS->lastinsertid());
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "failed on path '{}'", path);
+  }
+  return -1;
+}
+
+bool CChangeJournalDatabase::SetRootState(int idRoot, RootState state)
+{
+  return ExecuteQuery(PrepareSQL("UPDATE journalroot SET iState=%i WHERE idRoot=%i",
+                                 static_cast<int>(state), idRoot));
+}
+
+bool CChangeJournalDatabase::AddChanges(int idRoot, const std::set<std::string>& directories)
+{
+  try
+  {
+    if (nullptr == m_pDB)
+      return false;
+    if (nullptr == m_pDS)
+      return false;
+
+    BeginTransaction();
+    for (const auto& directory : directories)
+      m_pDS->exec(PrepareSQL(
+          "INSERT INTO journalchange (idChange, idRoot, strPath) VALUES (NULL, %i, '%s')", idRoot,
+          directory.c_str()));
+    return CommitTransaction();
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "failed");
+    RollbackTransaction();
+  }
+  return false;
+}
+
+bool CChangeJournalDatabase::GetChanges(int idRoot,
+                                        std::set<std::string>& directories,
+                                        int& lastChange)
+{
+  lastChange = -1;
+  try
+  {
+    if (nullptr == m_pDB)
+      return false;
+    if (nullptr == m_pDS)
+      return false;
+
+    if (!m_pDS->query(
+            PrepareSQL("SELECT idChange, strPath FROM journalchange WHERE idRoot=%i", idRoot)))
+      return false;
+
+    while (!m_pDS->eof())
+    {
+      lastChange = std::max(lastChange, m_pDS->fv(0).get_asInt());
+      directories.insert(m_pDS->fv(1).get_asString());
+      m_pDS->next();
+    }
+    m_pDS->close();
+    return true;
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "failed");
+  }
+  return false;
+}
+
+bool CChangeJournalDatabase::RemoveChanges(int idRoot, int lastChange /* = -1 */)
+{
+  if (lastChange < 0)
+    return ExecuteQuery(PrepareSQL("DELETE FROM journalchange WHERE idRoot=%i", idRoot));
+
+  return ExecuteQuery(PrepareSQL("DELETE FROM journalchange WHERE idRoot=%i AND idChange<=%i",
+                                 idRoot, lastChange));
+}
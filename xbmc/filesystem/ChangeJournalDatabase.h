@@ -0,0 +1,75 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "dbwrappers/Database.h"
+
+#include <set>
+#include <string>
+#include <vector>
+
+namespace XFILE
+{
+
+/*!
+ \brief Persistent queue of the directories changed below the journaled library roots.
+ */
+class CChangeJournalDatabase : public CDatabase
+{
+public:
+  enum class RootState
+  {
+    PENDING = 0, //!< changes are recorded, waiting for a complete scan
+    VALID = 1, //!< all changes since the last scan are recorded
+    LOST = 2 //!< changes were lost, a complete scan is needed
+  };
+
+  struct Root
+  {
+    int id = -1;
+    std::string library;
+    std::string path;
+    RootState state = RootState::PENDING;
+  };
+
+  CChangeJournalDatabase();
+  ~CChangeJournalDatabase() override;
+  bool Open() override;
+
+  bool GetRoots(std::vector<Root>& roots);
+
+  /*!
+   \brief Add a root or look up an existing one
+   \return the id of the root, -1 on error
+   */
+  int AddRoot(const std::string& library, const std::string& path);
+  bool SetRootState(int idRoot, RootState state);
+
+  bool AddChanges(int idRoot, const std::set<std::string>& directories);
+
+  /*!
+   \brief Get the changed directories of a root
+   \param lastChange [out] id of the last change, -1 if there are none
+   */
+  bool GetChanges(int idRoot, std::set<std::string>& directories, int& lastChange);
+
+  /*!
+   \brief Remove the changes of a root up to and including the given one, all if it's -1
+   */
+  bool RemoveChanges(int idRoot, int lastChange = -1);
+
+protected:
+  void CreateTables() override;
+  void CreateAnalytics() override;
+  void UpdateTables(int version) override;
+  int GetSchemaVersion() const override { return 1; }
+  const char* GetBaseDBName() const override { return "ChangeJournal"; }
+};
+
+} // namespace XFILE
@@ -1951,6 +1951,11 @@ void CCurlFile::CReadState::SetReadBuffer(const void* lpBuf, int64_t uiBufSize)
   m_filePos = 0;
 }
 
+void CCurlFile::RemoveRequestHeader(const std::string& header)
+{
+  m_requestheaders.erase(header);
+}
+
 void CCurlFile::ClearRequestHeaders()
 {
   m_requestheaders.clear();
@@ -79,10 +79,12 @@ namespace XFILE
       void SetRequestHeader(const std::string& header, const std::string& value);
       void SetRequestHeader(const std::string& header, long value);
 
+      void RemoveRequestHeader(const std::string& header);
       void ClearRequestHeaders();
       void SetBufferSize(unsigned int size);
 
       const CHttpHeader& GetHttpHeader() const { return m_state->m_httpheader; }
+      long GetResponseCode() const { return m_httpresponse; }
       const std::string& GetURL() const { return m_url; }
       std::string GetRedirectURL();
 
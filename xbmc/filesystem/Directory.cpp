@@ -183,6 +183,7 @@ bool CDirectory::GetDirectory(const CURL& url,
         g_directoryCache.ClearDirectory(realURL);
 
       pDirectory->SetFlags(hints.flags);
+      pDirectory->SetItemsCallback(hints.itemsCallback);
 
       bool result = false;
       CURL authUrl = realURL;
@@ -211,11 +212,14 @@ bool CDirectory::GetDirectory(const CURL& url,
             continue;
           }
 
+          pDirectory->SetItemsCallback({});
           CLog::Log(LOGERROR, "{} - Error getting {}", __FUNCTION__, url.GetRedacted());
           return false;
         }
       }
 
+      pDirectory->SetItemsCallback({});
+
       // hide credentials if necessary
       if (CPasswordManager::GetInstance().IsURLSupported(realURL))
       {
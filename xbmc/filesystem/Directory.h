@@ -33,6 +33,7 @@ public:
   public:
     std::string mask;
     int flags = DIR_FLAG_DEFAULTS;
+    DirectoryItemsCallback itemsCallback; ///< see IDirectory::SetItemsCallback
   };
 
   static bool GetDirectory(const CURL& url
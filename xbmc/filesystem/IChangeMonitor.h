@@ -0,0 +1,55 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <string>
+
+namespace XFILE
+{
+
+/*!
+ \brief Receiver of the changes reported by a change monitor.
+
+ Callbacks are made from the thread of the monitor.
+ */
+class IChangeMonitorCallback
+{
+public:
+  virtual ~IChangeMonitorCallback() = default;
+
+  /*!
+   \brief Files or folders were created, moved or deleted in a directory
+   \param root the watched root containing the directory
+   \param directory the changed directory, with a trailing slash
+   */
+  virtual void OnDirectoryChanged(const std::string& root, const std::string& directory) = 0;
+
+  /*!
+   \brief Changes below a root were lost, it has to be scanned completely again
+   */
+  virtual void OnChangesLost(const std::string& root) = 0;
+};
+
+/*!
+ \brief Platform specific watcher of directory trees.
+ */
+class IChangeMonitor
+{
+public:
+  virtual ~IChangeMonitor() = default;
+
+  /*!
+   \brief Watch a directory tree for changes
+   \param root the root of the tree, with a trailing slash
+   \return false if the tree can't be watched, e.g. as it is remote or too large
+   */
+  virtual bool Watch(const std::string& root) = 0;
+};
+
+} // namespace XFILE
@@ -10,6 +10,7 @@
 
 #include "utils/Variant.h"
 
+#include <functional>
 #include <string>
 
 class CFileItemList;
@@ -32,6 +33,13 @@ enum class CacheType
   ALWAYS ///< Always cache this directory to memory, so that each additional fetch of this folder will utilize the cache (until it's cleared)
 };
 
+/*!
+ \brief Receives the items of a directory in batches while the directory is listed.
+ \param items the items listed since the previous batch
+ \param final true for the last batch of the listing
+ */
+using DirectoryItemsCallback = std::function<void(const CFileItemList& items, bool final)>;
+
 /*! \brief Available directory flags
    The defaults are to allow file directories, no prompting, retrieve file information, hide hidden files, and utilise the directory cache
    based on the implementation's wishes.
@@ -82,6 +90,14 @@ public:
    \sa GetDirectory
    */
   virtual void CancelDirectory() {}
+  /*!
+   \brief Receive the items in batches while the directory is fetched (if possible).
+   Only directories which list their items incrementally deliver batches, the items returned by
+   GetDirectory are still the complete listing.
+   \param callback called from the fetching thread, must not block. Empty to stop receiving.
+   \sa GetDirectory
+   */
+  virtual void SetItemsCallback(const DirectoryItemsCallback& callback) {}
   /*!
   \brief Create the directory
   \param url Directory to create.
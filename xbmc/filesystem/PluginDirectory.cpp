@@ -31,9 +31,13 @@
 using namespace XFILE;
 using namespace ADDON;
 using namespace KODI::MESSAGING;
+using namespace std::chrono_literals;
 
 namespace
 {
+// items added by a script are passed on in batches at most this often
+constexpr auto ITEMS_BATCH_INTERVAL = 200ms;
+
 /*!
   \brief Get the plugin path from a CFileItem.
 
@@ -89,6 +93,7 @@ bool CPluginDirectory::StartScript(const std::string& strPath, bool resume)
   m_cancelled = false;
   m_success = false;
   m_totalItems = 0;
+  m_itemsDelivered = 0;
 
   // run the script
   return RunScript(this, addon, strPath, resume);
@@ -174,6 +179,7 @@ bool CPluginDirectory::AddItem(int handle, const CFileItem *item, int totalItems
   CFileItemPtr pItem(new CFileItem(*item));
   dir->m_listItems->Add(pItem);
   dir->m_totalItems = totalItems;
+  dir->DeliverItems(false);
 
   return !dir->m_cancelled;
 }
@@ -189,6 +195,21 @@ bool CPluginDirectory::AddItems(int handle, const CFileItemList *items, int tota
   pItemList.Copy(*items);
   dir->m_listItems->Append(pItemList);
   dir->m_totalItems = totalItems;
+  dir->DeliverItems(false);
+
+  return !dir->m_cancelled;
+}
+
+bool CPluginDirectory::MoveItems(int handle, const CFileItemList& items, int totalItems)
+{
+  std::unique_lock lock(GetScriptsLock());
+  CPluginDirectory* dir = GetScriptFromHandle(handle);
+  if (!dir)
+    return false;
+
+  dir->m_listItems->Append(items);
+  dir->m_totalItems = totalItems;
+  dir->DeliverItems(false);
 
   return !dir->m_cancelled;
 }
@@ -210,6 +231,8 @@ void CPluginDirectory::EndOfDirectory(int handle, bool success, bool replaceList
   if (!dir->m_listItems->HasSortDetails())
     dir->m_listItems->AddSortMethod(SortByNone, 552, LABEL_MASKS("%L", "%D"));
 
+  dir->DeliverItems(true);
+
   // set the event to mark that we're done
   dir->SetDone();
 }
@@ -553,6 +576,34 @@ void CPluginDirectory::CancelDirectory()
   m_cancelled = true;
 }
 
+void CPluginDirectory::SetItemsCallback(const DirectoryItemsCallback& callback)
+{
+  std::unique_lock lock(GetScriptsLock());
+  m_itemsCallback = callback;
+}
+
+void CPluginDirectory::DeliverItems(bool final)
+{
+  if (!m_itemsCallback)
+    return;
+
+  // the first items are passed on at once, later ones are collected for a while so that the
+  // caller does not refresh its view for every single item
+  const auto now = std::chrono::steady_clock::now();
+  if (!final && m_itemsDelivered > 0 && now - m_itemsDeliveredTime < ITEMS_BATCH_INTERVAL)
+    return;
+
+  CFileItemList batch(m_listItems->GetPath());
+  for (int i = m_itemsDelivered; i < m_listItems->Size(); ++i)
+    batch.Add(std::make_shared<CFileItem>(*m_listItems->Get(i)));
+  if (batch.IsEmpty() && !final)
+    return;
+
+  m_itemsDelivered = m_listItems->Size();
+  m_itemsDeliveredTime = now;
+  m_itemsCallback(batch, final);
+}
+
 float CPluginDirectory::GetProgress() const
 {
   if (m_totalItems > 0)
@@ -12,6 +12,7 @@
 #include "interfaces/generic/RunningScriptsHandler.h"
 
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <string>
 
@@ -34,6 +35,7 @@ public:
   bool Exists(const CURL& url) override { return true; }
   float GetProgress() const override;
   void CancelDirectory() override;
+  void SetItemsCallback(const DirectoryItemsCallback& callback) override;
   static bool RunScriptWithParams(const std::string& strPath, bool resume);
 
   /*! \brief Get a reproducible CFileItem by trying to recursively resolve the plugin paths
@@ -62,6 +64,10 @@ public:
   // callbacks from python
   static bool AddItem(int handle, const CFileItem *item, int totalItems);
   static bool AddItems(int handle, const CFileItemList *items, int totalItems);
+  /*! \brief Append items built for this listing only, sharing them instead of copying.
+   \param items the items to append, must not be changed afterwards.
+   */
+  static bool MoveItems(int handle, const CFileItemList& items, int totalItems);
   static void EndOfDirectory(int handle, bool success, bool replaceListing, bool cacheToDisc);
   static void AddSortMethod(int handle,
                             SortMethod sortMethod,
@@ -81,6 +87,7 @@ protected:
 
 private:
   bool StartScript(const std::string& strPath, bool resume);
+  void DeliverItems(bool final);
 
   std::unique_ptr<CFileItemList> m_listItems;
   std::unique_ptr<CFileItem> m_fileResult;
@@ -88,5 +95,9 @@ private:
   std::atomic<bool> m_cancelled;
   bool m_success = false; // set by script in EndOfDirectory
   int m_totalItems = 0; // set by script in AddDirectoryItem
+
+  DirectoryItemsCallback m_itemsCallback;
+  int m_itemsDelivered = 0; // items of m_listItems passed to m_itemsCallback
+  std::chrono::steady_clock::time_point m_itemsDeliveredTime;
 };
 }
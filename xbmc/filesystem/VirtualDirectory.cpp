@@ -68,7 +68,11 @@ bool CVirtualDirectory::GetDirectory(const CURL& url, CFileItemList &items, bool
     CURL realURL = URIUtils::SubstitutePath(url);
     if (!m_pDir)
       m_pDir.reset(CDirectoryFactory::Create(realURL));
-    bool ret = CDirectory::GetDirectory(strPath, m_pDir, items, m_strFileMask, flags);
+    CDirectory::CHints hints;
+    hints.mask = m_strFileMask;
+    hints.flags = flags;
+    hints.itemsCallback = m_itemsCallback;
+    bool ret = CDirectory::GetDirectory(url, m_pDir, items, hints);
     if (!keepImpl)
       m_pDir.reset();
     return ret;
@@ -94,6 +98,11 @@ void CVirtualDirectory::CancelDirectory()
     m_pDir->CancelDirectory();
 }
 
+void CVirtualDirectory::SetItemsCallback(const DirectoryItemsCallback& callback)
+{
+  m_itemsCallback = callback;
+}
+
 /*!
  \brief Is the share \e strPath in the virtual directory.
  \param strPath Share to test
@@ -28,6 +28,7 @@ namespace XFILE
     ~CVirtualDirectory(void) override;
     bool GetDirectory(const CURL& url, CFileItemList &items) override;
     void CancelDirectory() override;
+    void SetItemsCallback(const DirectoryItemsCallback& callback) override;
     bool GetDirectory(const CURL& url, CFileItemList &items, bool bUseFileDirectories, bool keepImpl);
     void SetSources(const std::vector<CMediaSource>& sources);
     inline unsigned int GetNumberOfSources() { return static_cast<uint32_t>(m_sources.size()); }
@@ -54,5 +55,6 @@ namespace XFILE
     std::vector<CMediaSource> m_sources;
     bool m_allowNonLocalSources;
     std::shared_ptr<IDirectory> m_pDir;
+    DirectoryItemsCallback m_itemsCallback;
   };
 }
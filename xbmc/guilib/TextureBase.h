@@ -68,6 +68,8 @@ public:
   uint32_t GetOriginalWidth() const { return m_originalWidth; }
   /*! \brief return the original height of the image, before scaling/cropping */
   uint32_t GetOriginalHeight() const { return m_originalHeight; }
+  /*! \brief return the texture format */
+  KD_TEX_FMT GetTextureFormat() const { return m_textureFormat; }
   /*! \brief return the texture swizzle */
   KD_TEX_SWIZ GetSwizzle() const { return m_textureSwizzle; }
 
@@ -10,6 +10,7 @@
 
 #include "ScriptInvocationManager.h"
 
+#include <chrono>
 #include <utility>
 
 CLanguageInvokerThread::CLanguageInvokerThread(std::shared_ptr<ILanguageInvoker> invoker,
@@ -101,10 +102,16 @@ void CLanguageInvokerThread::Process()
     return;
 
   std::unique_lock<std::mutex> lckdl(m_mutex);
+  bool warm = false;
   do
   {
     m_restart = false;
+    const auto start = std::chrono::steady_clock::now();
     m_invoker->Execute(m_script, m_args);
+    m_invocationManager->OnScriptRun(GetId(), warm,
+                                     std::chrono::duration_cast<std::chrono::milliseconds>(
+                                         std::chrono::steady_clock::now() - start));
+    warm = true;
 
     if (m_invoker->GetState() != InvokerStateScriptDone)
       m_reusable = false;
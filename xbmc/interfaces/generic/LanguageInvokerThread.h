@@ -32,6 +32,7 @@ public:
   {
     return !m_bStop && m_reusable && GetState() == InvokerStateScriptDone && m_script == script;
   };
+  bool IsReusable() const { return !m_bStop && m_reusable; }
   virtual void Release();
 
 protected:
@@ -8,15 +8,19 @@
 
 #include "ScriptInvocationManager.h"
 
+#include "ServiceBroker.h"
 #include "interfaces/generic/ILanguageInvocationHandler.h"
 #include "interfaces/generic/ILanguageInvoker.h"
 #include "interfaces/generic/LanguageInvokerThread.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
 #include "utils/FileUtils.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/XTimeUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <cerrno>
 #include <memory>
 #include <mutex>
@@ -73,8 +77,8 @@ void CScriptInvocationManager::Uninitialize()
   // execute Process() once more to handle the remaining scripts
   Process();
 
-  // it is safe to release early, thread must be in m_scripts too
-  m_lastInvokerThread = nullptr;
+  // it is safe to release early, threads must be in m_scripts too
+  m_reusableInvokers.clear();
 
   // make sure all scripts are done
   std::vector<LanguageInvokerThread> tempList;
@@ -180,32 +184,48 @@ int CScriptInvocationManager::GetReusablePluginHandle(const std::string& script)
 {
   std::unique_lock lock(m_critSection);
 
-  if (m_lastInvokerThread)
+  pruneReusableInvokers(m_reusableInvokers.size());
+  for (auto& invoker : m_reusableInvokers)
   {
-    if (m_lastInvokerThread->Reuseable(script))
-      return m_lastPluginHandle;
-    m_lastInvokerThread->Release();
-    m_lastInvokerThread = nullptr;
+    if (!invoker.reserved && invoker.thread->Reuseable(script))
+    {
+      invoker.reserved = true;
+      return invoker.pluginHandle;
+    }
   }
   return -1;
 }
 
+CScriptInvocationManager::InvocationStats CScriptInvocationManager::GetInvocationStats() const
+{
+  std::unique_lock lock(m_critSection);
+  return m_stats;
+}
+
 std::shared_ptr<ILanguageInvoker> CScriptInvocationManager::GetLanguageInvoker(
     const std::string& script)
+{
+  return getLanguageInvoker(script, -1);
+}
+
+std::shared_ptr<ILanguageInvoker> CScriptInvocationManager::getLanguageInvoker(
+    const std::string& script, int pluginHandle)
 {
   std::unique_lock lock(m_critSection);
 
-  if (m_lastInvokerThread)
+  // the script of a reused invoker may still refer to the plugin handle of its first run
+  auto reusable = std::find_if(m_reusableInvokers.begin(), m_reusableInvokers.end(),
+                               [&script, pluginHandle](const ReusableInvokerThread& invoker)
+                               {
+                                 return invoker.pluginHandle == pluginHandle &&
+                                        invoker.thread->Reuseable(script);
+                               });
+  if (reusable != m_reusableInvokers.end())
   {
-    if (m_lastInvokerThread->Reuseable(script))
-    {
-      CLog::Log(LOGDEBUG, "{} - Reusing LanguageInvokerThread {} for script {}", __FUNCTION__,
-                m_lastInvokerThread->GetId(), script);
-      m_lastInvokerThread->GetInvoker()->Reset();
-      return m_lastInvokerThread->GetInvoker();
-    }
-    m_lastInvokerThread->Release();
-    m_lastInvokerThread = nullptr;
+    CLog::Log(LOGDEBUG, "{} - Reusing LanguageInvokerThread {} for script {}", __FUNCTION__,
+              reusable->thread->GetId(), script);
+    reusable->thread->GetInvoker()->Reset();
+    return reusable->thread->GetInvoker();
   }
 
   std::string extension = URIUtils::GetExtension(script);
@@ -218,6 +238,25 @@ std::shared_ptr<ILanguageInvoker> CScriptInvocationManager::GetLanguageInvoker(
   return {};
 }
 
+void CScriptInvocationManager::pruneReusableInvokers(size_t maxSize)
+{
+  // drop the invokers which failed or were stopped, then the least recently used ones
+  size_t size = 0;
+  for (auto it = m_reusableInvokers.begin(); it != m_reusableInvokers.end();)
+  {
+    if (!it->thread->IsReusable() || size >= maxSize)
+    {
+      it->thread->Release();
+      it = m_reusableInvokers.erase(it);
+    }
+    else
+    {
+      ++size;
+      ++it;
+    }
+  }
+}
+
 int CScriptInvocationManager::ExecuteAsync(
     const std::string& script,
     const ADDON::AddonPtr& addon /* = ADDON::AddonPtr() */,
@@ -234,7 +273,7 @@ int CScriptInvocationManager::ExecuteAsync(
     return -1;
   }
 
-  auto invoker = GetLanguageInvoker(script);
+  auto invoker = getLanguageInvoker(script, pluginHandle);
   return ExecuteAsync(script, invoker, addon, arguments, reuseable, pluginHandle);
 }
 
@@ -257,34 +296,48 @@ int CScriptInvocationManager::ExecuteAsync(
 
   std::unique_lock lock(m_critSection);
 
-  if (m_lastInvokerThread && m_lastInvokerThread->GetInvoker() == languageInvoker)
+  auto reusable = std::find_if(m_reusableInvokers.begin(), m_reusableInvokers.end(),
+                               [&languageInvoker](const ReusableInvokerThread& invoker)
+                               { return invoker.thread->GetInvoker() == languageInvoker; });
+  if (reusable != m_reusableInvokers.end())
   {
+    // keep the most recently used invokers at the front, the pool is pruned from the back
+    m_reusableInvokers.splice(m_reusableInvokers.begin(), m_reusableInvokers, reusable);
+    reusable->reserved = false;
     if (addon != NULL)
-      m_lastInvokerThread->SetAddon(addon);
+      reusable->thread->SetAddon(addon);
 
-    // After we leave the lock, m_lastInvokerThread can be released -> copy!
-    CLanguageInvokerThreadPtr invokerThread = m_lastInvokerThread;
+    // After we leave the lock, the thread can be released -> copy!
+    CLanguageInvokerThreadPtr invokerThread = reusable->thread;
     lock.unlock();
     invokerThread->Execute(script, arguments);
 
     return invokerThread->GetId();
   }
 
-  m_lastInvokerThread = std::make_shared<CLanguageInvokerThread>(languageInvoker, this, reuseable);
-  if (m_lastInvokerThread == NULL)
+  const size_t poolSize = static_cast<size_t>(
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_languageInvokerPoolSize);
+  reuseable = reuseable && poolSize > 0;
+
+  CLanguageInvokerThreadPtr invokerThread =
+      std::make_shared<CLanguageInvokerThread>(languageInvoker, this, reuseable);
+  if (invokerThread == NULL)
     return -1;
 
   if (addon != NULL)
-    m_lastInvokerThread->SetAddon(addon);
+    invokerThread->SetAddon(addon);
+
+  invokerThread->SetId(m_nextId++);
 
-  m_lastInvokerThread->SetId(m_nextId++);
-  m_lastPluginHandle = pluginHandle;
+  if (reuseable)
+  {
+    m_reusableInvokers.push_front({invokerThread, pluginHandle, false});
+    pruneReusableInvokers(poolSize);
+  }
 
-  LanguageInvokerThread thread = {m_lastInvokerThread, script, false};
-  m_scripts.insert(std::make_pair(m_lastInvokerThread->GetId(), thread));
-  m_scriptPaths.insert(std::make_pair(script, m_lastInvokerThread->GetId()));
-  // After we leave the lock, m_lastInvokerThread can be released -> copy!
-  CLanguageInvokerThreadPtr invokerThread = m_lastInvokerThread;
+  LanguageInvokerThread thread = {invokerThread, script, false};
+  m_scripts.insert(std::make_pair(invokerThread->GetId(), thread));
+  m_scriptPaths.insert(std::make_pair(script, invokerThread->GetId()));
   lock.unlock();
   invokerThread->Execute(script, arguments);
 
@@ -411,6 +464,29 @@ void CScriptInvocationManager::OnExecutionDone(int scriptId)
     script->second.done = true;
 }
 
+void CScriptInvocationManager::OnScriptRun(int scriptId,
+                                           bool warm,
+                                           std::chrono::milliseconds duration)
+{
+  std::unique_lock lock(m_critSection);
+  if (warm)
+  {
+    m_stats.warmRuns++;
+    m_stats.warmTime += duration;
+  }
+  else
+  {
+    m_stats.coldRuns++;
+    m_stats.coldTime += duration;
+  }
+
+  CLog::Log(LOGDEBUG,
+            "{} - {} run of script {} took {} ms (average cold run {} ms, warm run {} ms)",
+            __FUNCTION__, warm ? "warm" : "cold", scriptId, duration.count(),
+            m_stats.coldRuns > 0 ? m_stats.coldTime.count() / m_stats.coldRuns : 0,
+            m_stats.warmRuns > 0 ? m_stats.warmTime.count() / m_stats.warmRuns : 0);
+}
+
 CScriptInvocationManager::LanguageInvokerThread CScriptInvocationManager::getInvokerThread(int scriptId) const
 {
   if (scriptId < 0)
@@ -12,6 +12,8 @@
 #include "interfaces/generic/ILanguageInvoker.h"
 #include "threads/CriticalSection.h"
 
+#include <chrono>
+#include <list>
 #include <map>
 #include <memory>
 #include <set>
@@ -35,10 +37,25 @@ public:
   std::shared_ptr<ILanguageInvoker> GetLanguageInvoker(const std::string& script);
 
   /*!
-  * \brief Returns addon_handle if last reusable invoker is ready to use.
+  * \brief Returns addon_handle if a reusable invoker of the script is ready to use.
+  *
+  * \details The invoker is reserved for the next execution of the script with that handle.
   */
   int GetReusablePluginHandle(const std::string& script);
 
+  struct InvocationStats
+  {
+    unsigned int coldRuns{0}; //!< runs in a newly created interpreter
+    unsigned int warmRuns{0}; //!< runs in a reused interpreter
+    std::chrono::milliseconds coldTime{0};
+    std::chrono::milliseconds warmTime{0};
+  };
+
+  /*!
+   * \brief Run counts and accumulated run times of the scripts, split by cold and warm runs.
+   */
+  InvocationStats GetInvocationStats() const;
+
   /*!
    * \brief Executes the given script asynchronously in a separate thread.
    *
@@ -128,6 +145,7 @@ protected:
   friend class CLanguageInvokerThread;
 
   void OnExecutionDone(int scriptId);
+  void OnScriptRun(int scriptId, bool warm, std::chrono::milliseconds duration);
 
 private:
   CScriptInvocationManager() = default;
@@ -143,12 +161,22 @@ private:
   typedef std::map<int, LanguageInvokerThread> LanguageInvokerThreadMap;
   typedef std::map<std::string, ILanguageInvocationHandler*> LanguageInvocationHandlerMap;
 
+  struct ReusableInvokerThread
+  {
+    CLanguageInvokerThreadPtr thread;
+    int pluginHandle;
+    bool reserved;
+  };
+  typedef std::list<ReusableInvokerThread> ReusableInvokerThreadList;
+
   LanguageInvokerThread getInvokerThread(int scriptId) const;
+  std::shared_ptr<ILanguageInvoker> getLanguageInvoker(const std::string& script, int pluginHandle);
+  void pruneReusableInvokers(size_t maxSize);
 
   LanguageInvocationHandlerMap m_invocationHandlers;
   LanguageInvokerThreadMap m_scripts;
-  CLanguageInvokerThreadPtr m_lastInvokerThread;
-  int m_lastPluginHandle = -1;
+  ReusableInvokerThreadList m_reusableInvokers; //!< most recently used first
+  InvocationStats m_stats;
 
   std::map<std::string, int> m_scriptPaths;
   int m_nextId = 0;
@@ -17,6 +17,8 @@
 #include "interfaces/generic/RunningScriptObserver.h"
 #include "interfaces/generic/ScriptInvocationManager.h"
 #include "messaging/ApplicationMessenger.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
 #include "threads/SystemClock.h"
 #include "utils/StringUtils.h"
 #include "utils/log.h"
@@ -80,6 +82,10 @@ int CScriptRunner::ExecuteScript(const ADDON::AddonPtr& addon,
   const auto reuseLanguageInvokerIt = addon->ExtraInfo().find("reuselanguageinvoker");
   if (reuseLanguageInvokerIt != addon->ExtraInfo().end())
     reuseLanguageInvoker = reuseLanguageInvokerIt->second == "true";
+  if (!reuseLanguageInvoker)
+    reuseLanguageInvoker = CServiceBroker::GetSettingsComponent()
+                               ->GetAdvancedSettings()
+                               ->m_languageInvokerReuseAddons.contains(addon->ID());
 
   // run the script
   CLog::Log(LOGDEBUG, "CScriptRunner: running add-on script {:s}('{:s}', '{:s}', '{:s}')",
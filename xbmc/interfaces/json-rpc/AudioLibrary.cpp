@@ -10,6 +10,7 @@
 
 #include "FileItem.h"
 #include "FileItemList.h"
+#include "ListCursors.h"
 #include "ServiceBroker.h"
 #include "Util.h"
 #include "filesystem/Directory.h"
@@ -350,6 +351,17 @@ JSONRPC_STATUS CAudioLibrary::GetAlbumDetails(const std::string &method, ITransp
 
 JSONRPC_STATUS CAudioLibrary::GetSongs(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant &parameterObject, CVariant &result)
 {
+  const std::string cursor = GetCursor(parameterObject);
+  if (!cursor.empty() && cursor != CListCursors::NEW_CURSOR)
+  {
+    std::shared_ptr<CListCursor> songs = CListCursors::GetInstance().Get(cursor, method);
+    if (!songs)
+      return InvalidParams;
+
+    HandleSongsCursor(*songs, cursor, parameterObject, result);
+    return OK;
+  }
+
   CMusicDatabase musicdatabase;
   if (!musicdatabase.Open())
     return InternalError;
@@ -398,88 +410,30 @@ JSONRPC_STATUS CAudioLibrary::GetSongs(const std::string &method, ITransportLaye
   }
 
   SortDescription sorting;
-  ParseLimits(parameterObject, sorting.limitStart, sorting.limitEnd);
+  // a new cursor keeps the complete result
+  if (cursor.empty())
+    ParseLimits(parameterObject, sorting.limitStart, sorting.limitEnd);
   if (!ParseSorting(parameterObject, sorting.sortBy, sorting.sortOrder, sorting.sortAttributes))
     return InvalidParams;
 
   int total;
-  std::set<std::string, std::less<>> fields;
-  if (parameterObject.isMember("properties") && parameterObject["properties"].isArray())
-  {
-    for (CVariant::const_iterator_array field = parameterObject["properties"].begin_array();
-         field != parameterObject["properties"].end_array(); ++field)
-      fields.insert(field->asString());
-  }
-
+  std::set<std::string, std::less<>> fields = GetSongFields(parameterObject);
   if (!musicdatabase.GetSongsByWhereJSON(fields, musicUrl.ToString(), result, total, sorting))
     return InternalError;
 
-  if (!result.isNull())
+  if (!cursor.empty())
   {
-    bool bFetchArt = fields.contains("art");
-    bool bFetchFanart = fields.contains("fanart");
-    bool bFetchThumb = fields.contains("thumbnail");
-    if (bFetchArt || bFetchFanart || bFetchThumb)
-    {
-      CThumbLoader* thumbLoader = new CMusicThumbLoader();
-      thumbLoader->OnLoaderStart();
-
-      std::set<std::string> artfields;
-      if (bFetchArt)
-        artfields.insert("art");
-      if (bFetchFanart)
-        artfields.insert("fanart");
-      if (bFetchThumb)
-        artfields.insert("thumbnail");
+    auto songs = std::make_shared<CListCursor>(method, parameterObject);
+    songs->SetRows(std::move(result["songs"]));
+    result.erase("songs");
 
-      for (unsigned int index = 0; index < result["songs"].size(); index++)
-      {
-        CFileItem item;
-        // Only needs song and album id (if we have it) set to get art
-        // Getting art is quicker if "albumid" has been fetched
-        item.GetMusicInfoTag()->SetDatabaseId(result["songs"][index]["songid"].asInteger32(), MediaTypeSong);
-        if (result["songs"][index].isMember("albumid"))
-          item.GetMusicInfoTag()->SetAlbumId(result["songs"][index]["albumid"].asInteger32());
-        else
-          item.GetMusicInfoTag()->SetAlbumId(-1);
-
-        // Could use FillDetails, but it does unnecessary serialization of empty MusiInfoTag
-        // CFileItemPtr itemptr(new CFileItem(item));
-        // FillDetails(item.GetMusicInfoTag(), itemptr, artfields, result["songs"][index], thumbLoader);
-
-        thumbLoader->FillLibraryArt(item);
-
-        if (bFetchThumb)
-        {
-          if (item.HasArt("thumb"))
-            result["songs"][index]["thumbnail"] = IMAGE_FILES::URLFromFile(item.GetArt("thumb"));
-          else
-            result["songs"][index]["thumbnail"] = "";
-        }
-        if (bFetchFanart)
-        {
-          if (item.HasArt("fanart"))
-            result["songs"][index]["fanart"] = IMAGE_FILES::URLFromFile(item.GetArt("fanart"));
-          else
-            result["songs"][index]["fanart"] = "";
-        }
-        if (bFetchArt)
-        {
-          const KODI::ART::Artwork& artMap = item.GetArt();
-          CVariant artObj(CVariant::VariantTypeObject);
-          for (const auto& artIt : artMap)
-          {
-            if (!artIt.second.empty())
-              artObj[artIt.first] = IMAGE_FILES::URLFromFile(artIt.second);
-          }
-          result["songs"][index]["art"] = artObj;
-        }
-      }
-
-      delete thumbLoader;
-    }
+    HandleSongsCursor(*songs, CListCursors::GetInstance().Add(songs), parameterObject, result);
+    return OK;
   }
 
+  if (!result.isNull())
+    FillSongArt(fields, result["songs"]);
+
   int start, end;
   HandleLimits(parameterObject, result, total, start, end);
 
@@ -1426,3 +1380,100 @@ bool CAudioLibrary::CheckForAdditionalProperties(const CVariant &properties, con
 
   return !foundProperties.empty();
 }
+
+std::set<std::string, std::less<>> CAudioLibrary::GetSongFields(const CVariant& parameterObject)
+{
+  std::set<std::string, std::less<>> fields;
+  if (parameterObject.isMember("properties") && parameterObject["properties"].isArray())
+  {
+    for (CVariant::const_iterator_array field = parameterObject["properties"].begin_array();
+         field != parameterObject["properties"].end_array(); ++field)
+      fields.insert(field->asString());
+  }
+  return fields;
+}
+
+void CAudioLibrary::FillSongArt(const std::set<std::string, std::less<>>& fields, CVariant& songs)
+{
+  bool bFetchArt = fields.contains("art");
+  bool bFetchFanart = fields.contains("fanart");
+  bool bFetchThumb = fields.contains("thumbnail");
+  if (bFetchArt || bFetchFanart || bFetchThumb)
+  {
+    CThumbLoader* thumbLoader = new CMusicThumbLoader();
+    thumbLoader->OnLoaderStart();
+
+    std::set<std::string> artfields;
+    if (bFetchArt)
+      artfields.insert("art");
+    if (bFetchFanart)
+      artfields.insert("fanart");
+    if (bFetchThumb)
+      artfields.insert("thumbnail");
+
+    for (unsigned int index = 0; index < songs.size(); index++)
+    {
+      CFileItem item;
+      // Only needs song and album id (if we have it) set to get art
+      // Getting art is quicker if "albumid" has been fetched
+      item.GetMusicInfoTag()->SetDatabaseId(songs[index]["songid"].asInteger32(), MediaTypeSong);
+      if (songs[index].isMember("albumid"))
+        item.GetMusicInfoTag()->SetAlbumId(songs[index]["albumid"].asInteger32());
+      else
+        item.GetMusicInfoTag()->SetAlbumId(-1);
+
+      // Could use FillDetails, but it does unnecessary serialization of empty MusiInfoTag
+      // CFileItemPtr itemptr(new CFileItem(item));
+      // FillDetails(item.GetMusicInfoTag(), itemptr, artfields, songs[index], thumbLoader);
+
+      thumbLoader->FillLibraryArt(item);
+
+      if (bFetchThumb)
+      {
+        if (item.HasArt("thumb"))
+          songs[index]["thumbnail"] = IMAGE_FILES::URLFromFile(item.GetArt("thumb"));
+        else
+          songs[index]["thumbnail"] = "";
+      }
+      if (bFetchFanart)
+      {
+        if (item.HasArt("fanart"))
+          songs[index]["fanart"] = IMAGE_FILES::URLFromFile(item.GetArt("fanart"));
+        else
+          songs[index]["fanart"] = "";
+      }
+      if (bFetchArt)
+      {
+        const KODI::ART::Artwork& artMap = item.GetArt();
+        CVariant artObj(CVariant::VariantTypeObject);
+        for (const auto& artIt : artMap)
+        {
+          if (!artIt.second.empty())
+            artObj[artIt.first] = IMAGE_FILES::URLFromFile(artIt.second);
+        }
+        songs[index]["art"] = artObj;
+      }
+    }
+
+    delete thumbLoader;
+  }
+}
+
+void CAudioLibrary::HandleSongsCursor(const CListCursor& cursor,
+                                      const std::string& id,
+                                      const CVariant& parameterObject,
+                                      CVariant& result)
+{
+  int start, end;
+  HandleLimits(parameterObject, result, cursor.GetTotal(), start, end);
+  result["limits"]["cursor"] = id;
+
+  // only the songs of the requested page are completed with art
+  CVariant& songs = result["songs"];
+  songs = CVariant(CVariant::VariantTypeArray);
+  songs.reserve(static_cast<size_t>(end - start));
+  for (int i = start; i < end; i++)
+    songs.push_back(cursor.GetRows()[i]);
+
+  FillSongArt(GetSongFields(cursor.GetParameters()), songs);
+}
@@ -24,6 +24,8 @@ class CVariant;
 
 namespace JSONRPC
 {
+  class CListCursor;
+
   class CAudioLibrary : public CFileItemHandler
   {
   public:
@@ -88,5 +90,12 @@ namespace JSONRPC
                                   std::shared_ptr<CFileItem>& item);
 
     static bool CheckForAdditionalProperties(const CVariant &properties, const std::set<std::string> &checkProperties, std::set<std::string> &foundProperties);
+
+    static std::set<std::string, std::less<>> GetSongFields(const CVariant& parameterObject);
+    static void FillSongArt(const std::set<std::string, std::less<>>& fields, CVariant& songs);
+    static void HandleSongsCursor(const CListCursor& cursor,
+                                  const std::string& id,
+                                  const CVariant& parameterObject,
+                                  CVariant& result);
   };
 }
@@ -11,6 +11,7 @@
 #include "AudioLibrary.h"
 #include "FileItemList.h"
 #include "FileOperations.h"
+#include "ListCursors.h"
 #include "ServiceBroker.h"
 #include "Util.h"
 #include "VideoLibrary.h"
@@ -40,6 +41,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string.h>
 
 using namespace MUSIC_INFO;
@@ -304,6 +306,73 @@ void CFileItemHandler::HandleFileItemList(const char *ID, bool allowFile, const
     end = items.Size();
   }
 
+  HandleFileItemRange(ID, allowFile, resultname, items, parameterObject, result, start, end);
+}
+
+std::string CFileItemHandler::GetCursor(const CVariant& parameterObject)
+{
+  return parameterObject["limits"]["cursor"].asString();
+}
+
+void CFileItemHandler::CreateFileItemListCursor(const std::string& method,
+                                                const char* ID,
+                                                bool allowFile,
+                                                const char* resultname,
+                                                std::shared_ptr<CFileItemList> items,
+                                                const CVariant& parameterObject,
+                                                CVariant& result,
+                                                bool sort)
+{
+  if (sort)
+    Sort(*items, parameterObject);
+
+  auto cursor = std::make_shared<CListCursor>(method, parameterObject);
+  cursor->SetItems(std::move(items));
+
+  std::unique_lock lock(cursor->GetSection());
+  const std::string id = CListCursors::GetInstance().Add(cursor);
+
+  int start, end;
+  HandleLimits(parameterObject, result, cursor->GetTotal(), start, end);
+  result["limits"]["cursor"] = id;
+
+  HandleFileItemRange(ID, allowFile, resultname, *cursor->GetItems(), cursor->GetParameters(),
+                      result, start, end);
+}
+
+JSONRPC_STATUS CFileItemHandler::HandleFileItemListCursor(const std::string& method,
+                                                          const char* ID,
+                                                          bool allowFile,
+                                                          const char* resultname,
+                                                          const CVariant& parameterObject,
+                                                          CVariant& result)
+{
+  const std::string id = GetCursor(parameterObject);
+  std::shared_ptr<CListCursor> cursor = CListCursors::GetInstance().Get(id, method);
+  if (!cursor || !cursor->GetItems())
+    return InvalidParams;
+
+  std::unique_lock lock(cursor->GetSection());
+
+  int start, end;
+  HandleLimits(parameterObject, result, cursor->GetTotal(), start, end);
+  result["limits"]["cursor"] = id;
+
+  // the items are serialized as requested when the cursor was created
+  HandleFileItemRange(ID, allowFile, resultname, *cursor->GetItems(), cursor->GetParameters(),
+                      result, start, end);
+  return OK;
+}
+
+void CFileItemHandler::HandleFileItemRange(const char* ID,
+                                           bool allowFile,
+                                           const char* resultname,
+                                           CFileItemList& items,
+                                           const CVariant& parameterObject,
+                                           CVariant& result,
+                                           int start,
+                                           int end)
+{
   CThumbLoader *thumbLoader = NULL;
   if (end - start > 0)
   {
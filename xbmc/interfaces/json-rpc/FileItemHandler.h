@@ -13,6 +13,7 @@
 
 #include <memory>
 #include <set>
+#include <string>
 
 class CFileItem;
 class CFileItemList;
@@ -52,7 +53,43 @@ namespace JSONRPC
                                CThumbLoader* thumbLoader = nullptr);
 
     static bool FillFileItemList(const CVariant &parameterObject, CFileItemList &list);
+
+    /*!
+     \brief Get the value of "limits.cursor", empty if the request doesn't use a cursor
+     */
+    static std::string GetCursor(const CVariant& parameterObject);
+    /*!
+     \brief Keep the complete result of a request as a new cursor and return its first page
+     \param items the complete (not limited) result
+     \param sort whether the items still have to be sorted as requested
+     */
+    static void CreateFileItemListCursor(const std::string& method,
+                                         const char* ID,
+                                         bool allowFile,
+                                         const char* resultname,
+                                         std::shared_ptr<CFileItemList> items,
+                                         const CVariant& parameterObject,
+                                         CVariant& result,
+                                         bool sort);
+    /*!
+     \brief Return the page requested by "limits" from an existing cursor
+     */
+    static JSONRPC_STATUS HandleFileItemListCursor(const std::string& method,
+                                                   const char* ID,
+                                                   bool allowFile,
+                                                   const char* resultname,
+                                                   const CVariant& parameterObject,
+                                                   CVariant& result);
+
   private:
+    static void HandleFileItemRange(const char* ID,
+                                    bool allowFile,
+                                    const char* resultname,
+                                    CFileItemList& items,
+                                    const CVariant& parameterObject,
+                                    CVariant& result,
+                                    int start,
+                                    int end);
     static void Sort(CFileItemList &items, const CVariant& parameterObject);
     static bool GetField(const std::string& field,
                          const CVariant& info,
@@ -11,6 +11,7 @@
 #include "AudioLibrary.h"
 #include "FileItem.h"
 #include "FileItemList.h"
+#include "ListCursors.h"
 #include "MediaSource.h"
 #include "ServiceBroker.h"
 #include "URL.h"
@@ -74,6 +75,10 @@ JSONRPC_STATUS CFileOperations::GetRootDirectory(const std::string &method, ITra
 
 JSONRPC_STATUS CFileOperations::GetDirectory(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant &parameterObject, CVariant &result)
 {
+  const std::string cursor = GetCursor(parameterObject);
+  if (!cursor.empty() && cursor != CListCursors::NEW_CURSOR)
+    return HandleFileItemListCursor(method, "id", true, "files", parameterObject, result);
+
   std::string media = parameterObject["media"].asString();
   StringUtils::ToLower(media);
 
@@ -113,7 +118,7 @@ JSONRPC_STATUS CFileOperations::GetDirectory(const std::string &method, ITranspo
         return status;
     }
 
-    CFileItemList filteredFiles;
+    auto filteredFiles = std::make_shared<CFileItemList>();
     for (unsigned int i = 0; i < (unsigned int)items.Size(); i++)
     {
       if (CUtil::ExcludeFileOrFolder(items[i]->GetPath(), regexps))
@@ -130,14 +135,14 @@ JSONRPC_STATUS CFileOperations::GetDirectory(const std::string &method, ITranspo
           (media == "picture" && items[i]->HasPictureInfoTag()) ||
            media == "files" ||
            URIUtils::IsUPnP(items.GetPath()))
-          filteredFiles.Add(items[i]);
+          filteredFiles->Add(items[i]);
       else
       {
         CFileItemPtr fileItem(new CFileItem());
         if (FillFileItem(items[i], fileItem, media, parameterObject))
-            filteredFiles.Add(fileItem);
+            filteredFiles->Add(fileItem);
         else
-            filteredFiles.Add(items[i]);
+            filteredFiles->Add(items[i]);
       }
     }
 
@@ -163,7 +168,11 @@ JSONRPC_STATUS CFileOperations::GetDirectory(const std::string &method, ITranspo
       param["properties"].append("file");
     param["properties"].append("filetype");
 
-    HandleFileItemList("id", true, "files", filteredFiles, param, result);
+    if (!cursor.empty())
+      CreateFileItemListCursor(method, "id", true, "files", std::move(filteredFiles), param, result,
+                               true);
+    else
+      HandleFileItemList("id", true, "files", *filteredFiles, param, result);
 
     return OK;
   }
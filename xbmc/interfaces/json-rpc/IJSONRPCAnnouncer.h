@@ -25,6 +25,18 @@ namespace JSONRPC
                                              const std::string& method,
                                              const CVariant& data,
                                              bool compactOutput)
+    {
+      std::string str;
+      CJSONVariantWriter::Write(AnnouncementToVariant(flag, sender, method, data), str,
+                                compactOutput);
+
+      return str;
+    }
+
+    static CVariant AnnouncementToVariant(ANNOUNCEMENT::AnnouncementFlag flag,
+                                          const std::string& sender,
+                                          const std::string& method,
+                                          const CVariant& data)
     {
       CVariant root;
       root["jsonrpc"] = "2.0";
@@ -37,10 +49,7 @@ namespace JSONRPC
       root["params"]["data"] = data;
       root["params"]["sender"] = sender;
 
-      std::string str;
-      CJSONVariantWriter::Write(root, str, compactOutput);
-
-      return str;
+      return root;
     }
   };
 }
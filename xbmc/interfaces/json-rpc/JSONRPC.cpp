@@ -27,6 +27,8 @@
 #include "playlists/SmartPlayList.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
+#include "utils/MessagePackVariantParser.h"
+#include "utils/MessagePackVariantWriter.h"
 #include "utils/StringUtils.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
@@ -239,54 +241,101 @@ JSONRPC_STATUS CJSONRPC::NotifyAll(const std::string &method, ITransportLayer *t
   return ACK;
 }
 
-std::string CJSONRPC::MethodCall(const std::string &inputString, ITransportLayer *transport, IClient *client)
+std::string CJSONRPC::MethodCall(const std::string& inputString,
+                                 ITransportLayer* transport,
+                                 IClient* client,
+                                 Encoding inputEncoding /* = Encoding::JSON */,
+                                 Encoding outputEncoding /* = Encoding::JSON */)
 {
-  CVariant inputroot, outputroot, result;
+  CVariant inputroot, outputroot;
   bool hasResponse = false;
+  bool parsed;
 
-  CLog::Log(LOGDEBUG, LOGJSONRPC, "JSONRPC: Incoming request: {}", inputString);
-
-  if (CJSONVariantParser::Parse(inputString, inputroot) && !inputroot.isNull())
+  if (inputEncoding == Encoding::MESSAGEPACK)
   {
-    if (inputroot.isArray())
-    {
-      if (inputroot.empty())
-      {
-        CLog::Log(LOGERROR, "JSONRPC: Empty batch call");
-        BuildResponse(inputroot, InvalidRequest, CVariant(), outputroot);
-        hasResponse = true;
-      }
-      else
-      {
-        for (CVariant::const_iterator_array itr = inputroot.begin_array();
-             itr != inputroot.end_array(); ++itr)
-        {
-          CVariant response;
-          if (HandleMethodCall(*itr, response, transport, client))
-          {
-            outputroot.append(response);
-            hasResponse = true;
-          }
-        }
-      }
-    }
-    else
-      hasResponse = HandleMethodCall(inputroot, outputroot, transport, client);
+    CLog::Log(LOGDEBUG, LOGJSONRPC, "JSONRPC: Incoming MessagePack request ({} bytes)",
+              inputString.size());
+    parsed = CMessagePackVariantParser::Parse(inputString, inputroot);
   }
   else
   {
-    CLog::Log(LOGERROR, "JSONRPC: Failed to parse '{}'", inputString);
+    CLog::Log(LOGDEBUG, LOGJSONRPC, "JSONRPC: Incoming request: {}", inputString);
+    parsed = CJSONVariantParser::Parse(inputString, inputroot);
+  }
+
+  if (parsed && !inputroot.isNull())
+    hasResponse = HandleRequest(inputroot, outputroot, transport, client);
+  else
+  {
+    if (inputEncoding == Encoding::MESSAGEPACK)
+      CLog::Log(LOGERROR, "JSONRPC: Failed to parse MessagePack request");
+    else
+      CLog::Log(LOGERROR, "JSONRPC: Failed to parse '{}'", inputString);
     BuildResponse(inputroot, ParseError, CVariant(), outputroot);
     hasResponse = true;
   }
 
+  if (!hasResponse)
+    return "";
+
+  return Write(outputroot, outputEncoding);
+}
+
+std::string CJSONRPC::MethodCall(const CVariant& input,
+                                 ITransportLayer* transport,
+                                 IClient* client,
+                                 Encoding outputEncoding)
+{
+  CVariant outputroot;
+  if (!HandleRequest(input, outputroot, transport, client))
+    return "";
+
+  return Write(outputroot, outputEncoding);
+}
+
+std::string CJSONRPC::Write(const CVariant& output, Encoding encoding)
+{
   std::string str;
-  if (hasResponse)
-    CJSONVariantWriter::Write(outputroot, str, CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_jsonOutputCompact);
+  if (encoding == Encoding::MESSAGEPACK)
+    CMessagePackVariantWriter::Write(output, str);
+  else
+    CJSONVariantWriter::Write(output, str, CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_jsonOutputCompact);
 
   return str;
 }
 
+bool CJSONRPC::HandleRequest(const CVariant& inputroot, CVariant& outputroot, ITransportLayer* transport, IClient* client)
+{
+  bool hasResponse = false;
+
+  if (inputroot.isArray())
+  {
+    if (inputroot.empty())
+    {
+      CLog::Log(LOGERROR, "JSONRPC: Empty batch call");
+      BuildResponse(inputroot, InvalidRequest, CVariant(), outputroot);
+      hasResponse = true;
+    }
+    else
+    {
+      for (CVariant::const_iterator_array itr = inputroot.begin_array();
+           itr != inputroot.end_array(); ++itr)
+      {
+        CVariant response;
+        if (HandleMethodCall(*itr, response, transport, client))
+        {
+          outputroot.append(response);
+          hasResponse = true;
+        }
+      }
+    }
+  }
+  else
+    hasResponse = HandleMethodCall(inputroot, outputroot, transport, client);
+
+  return hasResponse;
+}
+
 bool CJSONRPC::HandleMethodCall(const CVariant& request, CVariant& response, ITransportLayer *transport, IClient *client)
 {
   JSONRPC_STATUS errorCode = OK;
@@ -51,7 +51,29 @@ namespace JSONRPC
      in the request are checked for validity and completeness. If the request
      is valid and the requested method exists it is called and executed.
      */
-    static std::string MethodCall(const std::string &inputString, ITransportLayer *transport, IClient *client);
+    static std::string MethodCall(const std::string& inputString,
+                                  ITransportLayer* transport,
+                                  IClient* client,
+                                  Encoding inputEncoding = Encoding::JSON,
+                                  Encoding outputEncoding = Encoding::JSON);
+
+    /*
+     \brief Handles an already parsed JSON-RPC request
+     \param input received JSON-RPC request
+     \param transport Transport protocol on which the request arrived
+     \param client Client which sent the request
+     \param outputEncoding Encoding of the response
+     \return JSON-RPC response to be sent back to the client
+     */
+    static std::string MethodCall(const CVariant& input,
+                                  ITransportLayer* transport,
+                                  IClient* client,
+                                  Encoding outputEncoding);
+
+    /*
+     \brief Encode a JSON-RPC message (response or notification)
+     */
+    static std::string Write(const CVariant& output, Encoding encoding);
 
     static JSONRPC_STATUS Introspect(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant& parameterObject, CVariant &result);
     static JSONRPC_STATUS Version(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant& parameterObject, CVariant &result);
@@ -62,6 +84,7 @@ namespace JSONRPC
     static JSONRPC_STATUS NotifyAll(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant& parameterObject, CVariant &result);
 
   private:
+    static bool HandleRequest(const CVariant& inputroot, CVariant& outputroot, ITransportLayer* transport, IClient* client);
     static bool HandleMethodCall(const CVariant& request, CVariant& response, ITransportLayer *transport, IClient *client);
     static inline bool IsProperJSONRPC(const CVariant& inputroot);
 
@@ -41,6 +41,19 @@ namespace JSONRPC
     FailedToExecute = -32100
   };
 
+  /*!
+   \ingroup jsonrpc
+   \brief Encodings of JSON-RPC requests and responses on the wire
+
+   MessagePack carries the very same messages as JSON, it only
+   encodes them more compactly.
+   */
+  enum class Encoding
+  {
+    JSON,
+    MESSAGEPACK
+  };
+
   /*!
    \brief Function pointer for JSON-RPC methods
    */
@@ -0,0 +1,98 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ListCursors.h"
+
+#include "FileItemList.h"
+#include "utils/StringUtils.h"
+
+#include <mutex>
+
+using namespace JSONRPC;
+
+namespace
+{
+// every cursor holds the complete result of a query, keep only a few of them around
+constexpr size_t MAX_CURSORS = 8;
+
+// clients page through a list in quick succession, an idle cursor has been abandoned
+constexpr auto MAX_IDLE_TIME = std::chrono::seconds(60);
+} // unnamed namespace
+
+CListCursor::CListCursor(std::string method, const CVariant& parameterObject)
+  : m_method(std::move(method)), m_parameters(parameterObject)
+{
+  m_parameters.erase("limits");
+}
+
+void CListCursor::SetItems(std::shared_ptr<CFileItemList> items)
+{
+  m_items = std::move(items);
+  m_total = m_items ? m_items->Size() : 0;
+}
+
+void CListCursor::SetRows(CVariant rows)
+{
+  m_rows = std::move(rows);
+  m_total = static_cast<int>(m_rows.size());
+}
+
+CListCursors& CListCursors::GetInstance()
+{
+  static CListCursors cursors;
+  return cursors;
+}
+
+std::string CListCursors::Add(std::shared_ptr<CListCursor> cursor)
+{
+  std::string id = StringUtils::CreateUUID();
+
+  std::unique_lock lock(m_critSection);
+
+  const auto now = std::chrono::steady_clock::now();
+  Expire(now);
+
+  m_cursors.push_front({id, std::move(cursor), now});
+  while (m_cursors.size() > MAX_CURSORS)
+    m_cursors.pop_back();
+
+  return id;
+}
+
+std::shared_ptr<CListCursor> CListCursors::Get(const std::string& id, const std::string& method)
+{
+  std::unique_lock lock(m_critSection);
+
+  const auto now = std::chrono::steady_clock::now();
+  Expire(now);
+
+  for (auto it = m_cursors.begin(); it != m_cursors.end(); ++it)
+  {
+    if (it->id != id)
+      continue;
+
+    if (!StringUtils::EqualsNoCase(it->cursor->GetMethod(), method))
+      return {};
+
+    it->lastUsed = now;
+    m_cursors.splice(m_cursors.begin(), m_cursors, it);
+    return m_cursors.front().cursor;
+  }
+  return {};
+}
+
+void CListCursors::Clear()
+{
+  std::unique_lock lock(m_critSection);
+  m_cursors.clear();
+}
+
+void CListCursors::Expire(std::chrono::steady_clock::time_point now)
+{
+  m_cursors.remove_if([now](const Slot& slot) { return now - slot.lastUsed > MAX_IDLE_TIME; });
+}
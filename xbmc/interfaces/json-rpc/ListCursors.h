@@ -0,0 +1,109 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+#include "utils/Variant.h"
+
+#include <chrono>
+#include <list>
+#include <memory>
+#include <string>
+
+class CFileItemList;
+
+namespace JSONRPC
+{
+/*!
+ \brief Snapshot of a list request that is paged through with "limits.cursor".
+
+ The snapshot is taken from a single query without limits and either holds the retrieved items
+ or the already serialized rows. Pages are cut out of the snapshot, so the query is neither
+ repeated nor affected by changes made to the library in the meantime.
+ */
+class CListCursor
+{
+public:
+  CListCursor(std::string method, const CVariant& parameterObject);
+
+  const std::string& GetMethod() const { return m_method; }
+
+  /*!
+   \brief Parameters of the request the cursor was created by, without the limits
+   */
+  const CVariant& GetParameters() const { return m_parameters; }
+
+  const std::shared_ptr<CFileItemList>& GetItems() const { return m_items; }
+  void SetItems(std::shared_ptr<CFileItemList> items);
+
+  const CVariant& GetRows() const { return m_rows; }
+  void SetRows(CVariant rows);
+
+  int GetTotal() const { return m_total; }
+
+  /*!
+   \brief Lock to hold while serving a page, serialization fills in details of the items
+   */
+  CCriticalSection& GetSection() { return m_critSection; }
+
+private:
+  std::string m_method;
+  CVariant m_parameters;
+  std::shared_ptr<CFileItemList> m_items;
+  CVariant m_rows;
+  int m_total = 0;
+  CCriticalSection m_critSection;
+};
+
+/*!
+ \brief Process wide store of the open list cursors.
+
+ Cursors are identified by an opaque id handed out to the client. They expire once they were not
+ used for a while and are dropped in least recently used order once the store is full.
+ */
+class CListCursors
+{
+public:
+  static CListCursors& GetInstance();
+
+  /*!
+   \brief Value of "limits.cursor" requesting a new cursor
+   */
+  static constexpr const char* NEW_CURSOR = "new";
+
+  /*!
+   \brief Store a cursor
+   \return the id of the cursor
+   */
+  std::string Add(std::shared_ptr<CListCursor> cursor);
+
+  /*!
+   \brief Look up a cursor of the given method
+   \return the cursor, nullptr if it is unknown, expired or belongs to another method
+   */
+  std::shared_ptr<CListCursor> Get(const std::string& id, const std::string& method);
+
+  void Clear();
+
+private:
+  CListCursors() = default;
+
+  struct Slot
+  {
+    std::string id;
+    std::shared_ptr<CListCursor> cursor;
+    std::chrono::steady_clock::time_point lastUsed;
+  };
+
+  void Expire(std::chrono::steady_clock::time_point now);
+
+  CCriticalSection m_critSection;
+  std::list<Slot> m_cursors; // most recently used first
+};
+} // namespace JSONRPC
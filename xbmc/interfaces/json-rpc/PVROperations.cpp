@@ -145,10 +145,11 @@ JSONRPC_STATUS CPVROperations::GetChannels(const std::string& method,
     return InvalidParams;
 
   CFileItemList channels;
-  const auto groupMembers = channelGroup->GetMembers(CPVRChannelGroup::Include::ONLY_VISIBLE);
-  for (const auto& groupMember : groupMembers)
+  const auto groupMembers = channelGroup->GetMembersSnapshot();
+  for (const auto& groupMember : groupMembers->sorted)
   {
-    channels.Add(std::make_shared<CFileItem>(groupMember));
+    if (!groupMember->Channel()->IsHidden())
+      channels.Add(std::make_shared<CFileItem>(groupMember));
   }
 
   HandleFileItemList("channelid", false, "channels", channels, parameterObject, result, true);
@@ -407,10 +408,11 @@ void CPVROperations::FillChannelGroupDetails(
   else
   {
     CFileItemList channels;
-    const auto groupMembers{channelGroup->GetMembers(CPVRChannelGroup::Include::ONLY_VISIBLE)};
-    for (const auto& groupMember : groupMembers)
+    const auto groupMembers{channelGroup->GetMembersSnapshot()};
+    for (const auto& groupMember : groupMembers->sorted)
     {
-      channels.Add(std::make_shared<CFileItem>(groupMember));
+      if (!groupMember->Channel()->IsHidden())
+        channels.Add(std::make_shared<CFileItem>(groupMember));
     }
 
     object["channels"] = CVariant(CVariant::VariantTypeArray);
@@ -10,6 +10,7 @@
 
 #include "FileItem.h"
 #include "FileItemList.h"
+#include "ListCursors.h"
 #include "PVROperations.h"
 #include "ServiceBroker.h"
 #include "Util.h"
@@ -29,12 +30,18 @@ using namespace JSONRPC;
 
 JSONRPC_STATUS CVideoLibrary::GetMovies(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant &parameterObject, CVariant &result)
 {
+  const std::string cursor = GetCursor(parameterObject);
+  if (!cursor.empty() && cursor != CListCursors::NEW_CURSOR)
+    return HandleFileItemListCursor(method, "movieid", true, "movies", parameterObject, result);
+
   CVideoDatabase videodatabase;
   if (!videodatabase.Open())
     return InternalError;
 
   SortDescription sorting;
-  ParseLimits(parameterObject, sorting.limitStart, sorting.limitEnd);
+  // a new cursor keeps the complete result
+  if (cursor.empty())
+    ParseLimits(parameterObject, sorting.limitStart, sorting.limitEnd);
   if (!ParseSorting(parameterObject, sorting.sortBy, sorting.sortOrder, sorting.sortAttributes))
     return InvalidParams;
 
@@ -77,11 +84,18 @@ JSONRPC_STATUS CVideoLibrary::GetMovies(const std::string &method, ITransportLay
   if (setID < 0)
     setID = 0;
 
-  CFileItemList items;
-  if (!videodatabase.GetMoviesNav(videoUrl.ToString(), items, genreID, year, -1, -1, -1, -1, setID, -1, sorting, RequiresAdditionalDetails(MediaTypeMovie, parameterObject)))
+  auto items = std::make_shared<CFileItemList>();
+  if (!videodatabase.GetMoviesNav(videoUrl.ToString(), *items, genreID, year, -1, -1, -1, -1, setID, -1, sorting, RequiresAdditionalDetails(MediaTypeMovie, parameterObject)))
     return InvalidParams;
 
-  return HandleItems("movieid", "movies", items, parameterObject, result, false);
+  if (!cursor.empty())
+  {
+    CreateFileItemListCursor(method, "movieid", true, "movies", std::move(items), parameterObject,
+                             result, false);
+    return OK;
+  }
+
+  return HandleItems("movieid", "movies", *items, parameterObject, result, false);
 }
 
 JSONRPC_STATUS CVideoLibrary::GetMovieDetails(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant &parameterObject, CVariant &result)
@@ -0,0 +1,87 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "interfaces/json-rpc/ListCursors.h"
+#include "utils/Variant.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace JSONRPC;
+
+namespace
+{
+class TestListCursors : public testing::Test
+{
+protected:
+  TestListCursors() { CListCursors::GetInstance().Clear(); }
+  ~TestListCursors() override { CListCursors::GetInstance().Clear(); }
+
+  static std::shared_ptr<CListCursor> MakeCursor(const std::string& method, int rows)
+  {
+    CVariant parameters(CVariant::VariantTypeObject);
+    parameters["limits"]["start"] = 0;
+    parameters["limits"]["end"] = 10;
+    parameters["limits"]["cursor"] = CListCursors::NEW_CURSOR;
+    parameters["properties"].push_back("title");
+
+    auto cursor = std::make_shared<CListCursor>(method, parameters);
+    CVariant data(CVariant::VariantTypeArray);
+    for (int i = 0; i < rows; ++i)
+      data.push_back(i);
+    cursor->SetRows(std::move(data));
+    return cursor;
+  }
+};
+} // unnamed namespace
+
+TEST_F(TestListCursors, Snapshot)
+{
+  auto cursor = MakeCursor("AudioLibrary.GetSongs", 25);
+  EXPECT_EQ(25, cursor->GetTotal());
+  EXPECT_FALSE(cursor->GetParameters().isMember("limits"));
+  EXPECT_EQ("title", cursor->GetParameters()["properties"][0].asString());
+  EXPECT_EQ(nullptr, cursor->GetItems());
+}
+
+TEST_F(TestListCursors, AddGet)
+{
+  auto cursor = MakeCursor("AudioLibrary.GetSongs", 3);
+  const std::string id = CListCursors::GetInstance().Add(cursor);
+  EXPECT_FALSE(id.empty());
+  EXPECT_NE(CListCursors::NEW_CURSOR, id);
+
+  EXPECT_EQ(cursor, CListCursors::GetInstance().Get(id, "AudioLibrary.GetSongs"));
+  EXPECT_EQ(cursor, CListCursors::GetInstance().Get(id, "audiolibrary.getsongs"));
+
+  // a cursor is bound to the method that created it
+  EXPECT_EQ(nullptr, CListCursors::GetInstance().Get(id, "VideoLibrary.GetMovies"));
+  EXPECT_EQ(nullptr, CListCursors::GetInstance().Get("unknown", "AudioLibrary.GetSongs"));
+
+  CListCursors::GetInstance().Clear();
+  EXPECT_EQ(nullptr, CListCursors::GetInstance().Get(id, "AudioLibrary.GetSongs"));
+}
+
+TEST_F(TestListCursors, LeastRecentlyUsed)
+{
+  std::vector<std::string> ids;
+  for (int i = 0; i < 8; ++i)
+    ids.push_back(CListCursors::GetInstance().Add(MakeCursor("Files.GetDirectory", i)));
+
+  // using the oldest cursor keeps it, the next oldest one is dropped instead
+  EXPECT_NE(nullptr, CListCursors::GetInstance().Get(ids[0], "Files.GetDirectory"));
+  CListCursors::GetInstance().Add(MakeCursor("Files.GetDirectory", 1));
+
+  EXPECT_NE(nullptr, CListCursors::GetInstance().Get(ids[0], "Files.GetDirectory"));
+  EXPECT_EQ(nullptr, CListCursors::GetInstance().Get(ids[1], "Files.GetDirectory"));
+  for (size_t i = 2; i < ids.size(); ++i)
+    EXPECT_NE(nullptr, CListCursors::GetInstance().Get(ids[i], "Files.GetDirectory"));
+}
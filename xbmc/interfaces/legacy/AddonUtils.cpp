@@ -21,19 +21,26 @@ namespace XBMCAddonUtils
   GuiLock::GuiLock(XBMCAddon::LanguageHook* languageHook, bool offScreen)
     : m_languageHook(languageHook), m_offScreen(offScreen)
   {
+    // nothing is locked for offscreen objects. Giving up the interpreter lock for the call would
+    // only queue the script behind the busy scripts of other add-ons sharing the GIL to get it
+    // back, see PythonBindings::NewInterpreter() for add-ons running on a GIL of their own.
+    if (m_offScreen)
+      return;
+
     if (!m_languageHook)
       m_languageHook = XBMCAddon::LanguageHook::GetLanguageHook();
     if (m_languageHook)
       m_languageHook->DelayedCallOpen();
 
-    if (!m_offScreen)
-      g_application.LockFrameMoveGuard();
+    g_application.LockFrameMoveGuard();
   }
 
   GuiLock::~GuiLock()
   {
-    if (!m_offScreen)
-      g_application.UnlockFrameMoveGuard();
+    if (m_offScreen)
+      return;
+
+    g_application.UnlockFrameMoveGuard();
 
     if (m_languageHook)
       m_languageHook->DelayedCallClose();
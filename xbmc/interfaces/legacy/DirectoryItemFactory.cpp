@@ -0,0 +1,88 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "DirectoryItemFactory.h"
+
+#include "FileItem.h"
+#include "InfoTagVideo.h"
+#include "utils/StringUtils.h"
+#include "video/VideoInfoTag.h"
+
+#include <cstdlib>
+#include <functional>
+#include <string_view>
+#include <unordered_map>
+
+namespace
+{
+using InfoSetter = std::function<void(CVideoInfoTag*, const std::string&)>;
+
+const std::unordered_map<std::string_view, InfoSetter>& GetInfoSetters()
+{
+  using XBMCAddon::xbmc::InfoTagVideo;
+  static const std::unordered_map<std::string_view, InfoSetter> setters = {
+      {"title", InfoTagVideo::setTitleRaw},
+      {"originaltitle", InfoTagVideo::setOriginalTitleRaw},
+      {"plot", InfoTagVideo::setPlotRaw},
+      {"plotoutline", InfoTagVideo::setPlotOutlineRaw},
+      {"tagline", InfoTagVideo::setTagLineRaw},
+      {"tvshowtitle", InfoTagVideo::setTvShowTitleRaw},
+      {"mediatype", InfoTagVideo::setMediaTypeRaw},
+      {"premiered", InfoTagVideo::setPremieredRaw},
+      {"year", [](CVideoInfoTag* tag, const std::string& value)
+       { InfoTagVideo::setYearRaw(tag, std::atoi(value.c_str())); }},
+      {"duration", [](CVideoInfoTag* tag, const std::string& value)
+       { InfoTagVideo::setDurationRaw(tag, std::atoi(value.c_str())); }},
+      {"season", [](CVideoInfoTag* tag, const std::string& value)
+       { InfoTagVideo::setSeasonRaw(tag, std::atoi(value.c_str())); }},
+      {"episode", [](CVideoInfoTag* tag, const std::string& value)
+       { InfoTagVideo::setEpisodeRaw(tag, std::atoi(value.c_str())); }},
+  };
+  return setters;
+}
+} // unnamed namespace
+
+namespace XBMCAddon
+{
+  namespace xbmcplugin
+  {
+    CFileItemPtr CreateDirectoryItem(const Properties& values)
+    {
+      constexpr std::string_view ART_PREFIX = "art.";
+      constexpr std::string_view PROPERTY_PREFIX = "property.";
+      constexpr std::string_view INFO_PREFIX = "info.";
+
+      auto item = std::make_shared<CFileItem>();
+      for (const auto& [key, value] : values)
+      {
+        if (key == "path")
+          item->SetPath(value);
+        else if (key == "label")
+          item->SetLabel(value);
+        else if (key == "label2")
+          item->SetLabel2(value);
+        else if (key == "isfolder")
+          item->SetFolder(value == "1" || StringUtils::EqualsNoCase(value, "true"));
+        else if (key == "mimetype")
+          item->SetMimeType(value);
+        else if (key.starts_with(ART_PREFIX))
+          item->SetArt(StringUtils::ToLower(key.substr(ART_PREFIX.size())), value);
+        else if (key.starts_with(PROPERTY_PREFIX))
+          item->SetProperty(StringUtils::ToLower(key.substr(PROPERTY_PREFIX.size())), value);
+        else if (key.starts_with(INFO_PREFIX))
+        {
+          const auto& setters = GetInfoSetters();
+          const auto setter = setters.find(std::string_view(key).substr(INFO_PREFIX.size()));
+          if (setter != setters.end())
+            setter->second(item->GetVideoInfoTag(), value);
+        }
+      }
+      return item;
+    }
+  }
+}
@@ -0,0 +1,30 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "Dictionary.h"
+
+#include <memory>
+
+class CFileItem;
+
+namespace XBMCAddon
+{
+  namespace xbmcplugin
+  {
+    /**
+     * Build the item of a plugin listing from the plain values passed to
+     * addDirectoryItemsBulk(). Keys are path, label, label2, isfolder ("1" or
+     * "true"), mimetype, art.<type>, property.<name> and info.<field> for the
+     * supported video info fields, numbers given as strings. Unknown keys are
+     * ignored.
+     */
+    std::shared_ptr<CFileItem> CreateDirectoryItem(const Properties& values);
+  }
+}
@@ -8,8 +8,10 @@
 
 #include "ModuleXbmcplugin.h"
 
+#include "DirectoryItemFactory.h"
 #include "FileItem.h"
 #include "FileItemList.h"
+#include "LanguageHook.h"
 #include "SortFileItem.h"
 #include "filesystem/PluginDirectory.h"
 
@@ -50,6 +52,18 @@ namespace XBMCAddon
       return XFILE::CPluginDirectory::AddItems(handle, &fitems, totalItems);
     }
 
+    bool addDirectoryItemsBulk(int handle, const std::vector<Properties>& items, int totalItems)
+    {
+      // the items are only reachable from here, build them with the interpreter released
+      DelayedCallGuard dg;
+      CFileItemList fitems;
+      fitems.Reserve(items.size());
+      for (const auto& values : items)
+        fitems.Add(CreateDirectoryItem(values));
+
+      return XFILE::CPluginDirectory::MoveItems(handle, fitems, totalItems);
+    }
+
     void endOfDirectory(int handle, bool succeeded, bool updateListing,
                         bool cacheToDisc)
     {
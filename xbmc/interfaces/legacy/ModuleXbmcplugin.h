@@ -9,6 +9,7 @@
 #pragma once
 
 #include "AddonString.h"
+#include "Dictionary.h"
 #include "ListItem.h"
 #include "SortFileItem.h"
 #include "Tuple.h"
@@ -105,6 +106,67 @@ namespace XBMCAddon
                            int totalItems = 0);
 #endif
 
+#ifdef DOXYGEN_SHOULD_USE_THIS
+    ///
+    /// \ingroup python_xbmcplugin
+    /// @brief \python_func{ xbmcplugin.addDirectoryItemsBulk(handle, items[, totalItems]) }
+    /// Callback function to pass directory contents back to Kodi as a list of
+    /// dictionaries, without creating a ListItem per entry.
+    ///
+    /// @param handle               integer - handle the plugin was started
+    ///                             with.
+    /// @param items                List - list of dictionaries, one per item.
+    /// @param totalItems           [opt] integer - total number of items
+    ///                             that will be passed.(used for progressbar)
+    /// @return                     Returns a bool for successful completion.
+    ///
+    /// The items are built in one go, so large listings of simple items are
+    /// passed back considerably faster than with addDirectoryItems().
+    /// Values are strings, the following keys are known:
+    /// | Key               | Description
+    /// |------------------:|:-----------------------------------------------
+    /// | path              | url of the item
+    /// | label             | label of the item
+    /// | label2            | second label of the item
+    /// | isfolder          | "1" if the item is a folder
+    /// | mimetype          | mime type of the item
+    /// | art.*             | artwork of the type after the dot, e.g. art.thumb
+    /// | property.*        | property of the key after the dot
+    /// | info.title        | video title
+    /// | info.originaltitle | video original title
+    /// | info.plot         | video plot
+    /// | info.plotoutline  | video plot outline
+    /// | info.tagline      | video tagline
+    /// | info.tvshowtitle  | video tv show title
+    /// | info.mediatype    | video media type, see InfoTagVideo.setMediaType()
+    /// | info.premiered    | video premiere date (YYYY-MM-DD)
+    /// | info.year         | video year
+    /// | info.duration     | video duration in seconds
+    /// | info.season       | video season
+    /// | info.episode      | video episode
+    ///
+    /// @remark Items needing more than this are added with addDirectoryItems().
+    /// You may call this more than once to add items in chunks.
+    ///
+    ///
+    /// ------------------------------------------------------------------------
+    /// @python_v22 New function added.
+    ///
+    /// **Example:**
+    /// ~~~~~~~~~~~~~{.py}
+    /// ..
+    /// items = [{'path': url, 'label': title, 'info.mediatype': 'movie', 'art.thumb': thumb}]
+    /// if not xbmcplugin.addDirectoryItemsBulk(int(sys.argv[1]), items): raise
+    /// ..
+    /// ~~~~~~~~~~~~~
+    ///
+    addDirectoryItemsBulk(...);
+#else
+    bool addDirectoryItemsBulk(int handle,
+                               const std::vector<Properties>& items,
+                               int totalItems = 0);
+#endif
+
 #ifdef DOXYGEN_SHOULD_USE_THIS
     ///
     /// \ingroup python_xbmcplugin
@@ -0,0 +1,166 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileItem.h"
+#include "interfaces/legacy/DirectoryItemFactory.h"
+#include "interfaces/legacy/InfoTagVideo.h"
+#include "interfaces/legacy/ListItem.h"
+#include "utils/Variant.h"
+#include "video/VideoInfoTag.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace XBMCAddon;
+
+namespace
+{
+Properties GetValues(int index)
+{
+  const std::string number = std::to_string(index);
+  Properties values;
+  values["path"] = "plugin://plugin.video.test/?item=" + number;
+  values["label"] = "Item " + number;
+  values["label2"] = number;
+  values["isfolder"] = "true";
+  values["art.thumb"] = "special://home/thumb" + number + ".png";
+  values["property.id"] = number;
+  values["info.title"] = "Title " + number;
+  return values;
+}
+} // unnamed namespace
+
+TEST(TestDirectoryItemFactory, Labels)
+{
+  Properties values;
+  values["path"] = "plugin://plugin.video.test/";
+  values["label"] = "Label";
+  values["label2"] = "Label2";
+  values["mimetype"] = "video/mp4";
+
+  const CFileItemPtr item = xbmcplugin::CreateDirectoryItem(values);
+  ASSERT_NE(nullptr, item);
+  EXPECT_EQ("plugin://plugin.video.test/", item->GetPath());
+  EXPECT_EQ("Label", item->GetLabel());
+  EXPECT_EQ("Label2", item->GetLabel2());
+  EXPECT_EQ("video/mp4", item->GetMimeType());
+  EXPECT_FALSE(item->IsFolder());
+}
+
+TEST(TestDirectoryItemFactory, IsFolder)
+{
+  Properties values;
+  values["isfolder"] = "1";
+  EXPECT_TRUE(xbmcplugin::CreateDirectoryItem(values)->IsFolder());
+  values["isfolder"] = "TRUE";
+  EXPECT_TRUE(xbmcplugin::CreateDirectoryItem(values)->IsFolder());
+  values["isfolder"] = "0";
+  EXPECT_FALSE(xbmcplugin::CreateDirectoryItem(values)->IsFolder());
+  values["isfolder"] = "yes";
+  EXPECT_FALSE(xbmcplugin::CreateDirectoryItem(values)->IsFolder());
+}
+
+TEST(TestDirectoryItemFactory, ArtAndProperties)
+{
+  Properties values;
+  values["art.Thumb"] = "thumb.png";
+  values["art.fanart"] = "fanart.jpg";
+  values["property.IsPlayable"] = "true";
+  values["property.TotalTime"] = "120";
+
+  const CFileItemPtr item = xbmcplugin::CreateDirectoryItem(values);
+  EXPECT_EQ("thumb.png", item->GetArt("thumb"));
+  EXPECT_EQ("fanart.jpg", item->GetArt("fanart"));
+  EXPECT_EQ("true", item->GetProperty("isplayable").asString());
+  EXPECT_EQ("120", item->GetProperty("totaltime").asString());
+}
+
+TEST(TestDirectoryItemFactory, VideoInfo)
+{
+  Properties values;
+  values["info.title"] = "Title";
+  values["info.plot"] = "Plot";
+  values["info.year"] = "1999";
+  values["info.season"] = "2";
+  values["info.episode"] = "11";
+  values["info.duration"] = "3600";
+
+  const CFileItemPtr item = xbmcplugin::CreateDirectoryItem(values);
+  ASSERT_TRUE(item->HasVideoInfoTag());
+  const CVideoInfoTag* tag = item->GetVideoInfoTag();
+  EXPECT_EQ("Title", tag->m_strTitle);
+  EXPECT_EQ("Plot", tag->m_strPlot);
+  EXPECT_EQ(1999, tag->GetYear());
+  EXPECT_EQ(2, tag->m_iSeason);
+  EXPECT_EQ(11, tag->m_iEpisode);
+  EXPECT_EQ(3600u, tag->GetDuration());
+
+  values.clear();
+  values["info.year"] = "unknown";
+  EXPECT_EQ(0, xbmcplugin::CreateDirectoryItem(values)->GetVideoInfoTag()->GetYear());
+}
+
+TEST(TestDirectoryItemFactory, UnknownKeys)
+{
+  Properties values;
+  values["label"] = "Label";
+  values["thumb"] = "thumb.png";
+  values["info.unknown"] = "value";
+
+  const CFileItemPtr item = xbmcplugin::CreateDirectoryItem(values);
+  EXPECT_EQ("Label", item->GetLabel());
+  EXPECT_TRUE(item->GetArt().empty());
+  EXPECT_FALSE(item->HasVideoInfoTag());
+}
+
+// Benchmark, run with --gtest_also_run_disabled_tests. Builds plugin items from plain values and
+// the same items through the offscreen ListItem setters an add-on calls per item. Only the C++
+// side is timed: the Python bindings converting the arguments of every call are not involved, so
+// this does not show the speedup an add-on sees from addDirectoryItemsBulk().
+TEST(TestDirectoryItemFactory, DISABLED_CreateBenchmark)
+{
+  constexpr int ITEMS = 10000;
+
+  std::vector<Properties> items;
+  items.reserve(ITEMS);
+  for (int i = 0; i < ITEMS; ++i)
+    items.emplace_back(GetValues(i));
+
+  std::vector<CFileItemPtr> created;
+  created.reserve(ITEMS);
+  auto start = std::chrono::steady_clock::now();
+  for (const Properties& values : items)
+    created.emplace_back(xbmcplugin::CreateDirectoryItem(values));
+  const auto factoryTime = std::chrono::steady_clock::now() - start;
+  ASSERT_EQ(static_cast<size_t>(ITEMS), created.size());
+
+  created.clear();
+  start = std::chrono::steady_clock::now();
+  for (const Properties& values : items)
+  {
+    AddonClass::Ref<xbmcgui::ListItem> listItem(
+        new xbmcgui::ListItem(values.at("label"), values.at("label2"), values.at("path"), true));
+    Properties art;
+    art["thumb"] = values.at("art.thumb");
+    listItem->setArt(art);
+    listItem->setProperty("id", values.at("property.id"));
+    listItem->setIsFolder(true);
+    AddonClass::Ref<xbmc::InfoTagVideo> infoTag(listItem->getVideoInfoTag());
+    infoTag->setTitle(values.at("info.title"));
+    created.emplace_back(listItem->item);
+  }
+  const auto listItemTime = std::chrono::steady_clock::now() - start;
+  ASSERT_EQ(static_cast<size_t>(ITEMS), created.size());
+
+  using std::chrono::duration_cast, std::chrono::milliseconds;
+  RecordProperty("factory_ms", std::to_string(duration_cast<milliseconds>(factoryTime).count()));
+  RecordProperty("listitem_ms", std::to_string(duration_cast<milliseconds>(listItemTime).count()));
+}
@@ -106,3 +106,11 @@ const char* CAddonPythonInvoker::getInitializationScript() const
 {
   return RUNSCRIPT_COMPLIANT;
 }
+
+std::vector<std::string> CAddonPythonInvoker::getModules() const
+{
+  std::vector<std::string> modules;
+  for (const _inittab* module = PythonModules; module->name != nullptr; ++module)
+    modules.emplace_back(module->name);
+  return modules;
+}
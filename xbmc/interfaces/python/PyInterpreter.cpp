@@ -0,0 +1,110 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+// python.h should always be included first before any other includes
+#include <Python.h>
+
+#include "PyInterpreter.h"
+
+#include "threads/CriticalSection.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <mutex>
+#include <set>
+
+namespace
+{
+CCriticalSection refusedLock;
+// modules that failed to load into an interpreter with its own GIL
+std::set<std::string> refusedModules;
+} // unnamed namespace
+
+namespace PythonBindings
+{
+bool SupportsOwnGil()
+{
+#if PY_VERSION_HEX >= 0x030C0000
+  // the library loaded may be older than the headers built against
+  return Py_Version >= 0x030C0000;
+#else
+  return false;
+#endif
+}
+
+PyThreadState* NewInterpreter(PyThreadState* mainState,
+                              bool& ownGil,
+                              const std::vector<std::string>& modules)
+{
+#if PY_VERSION_HEX >= 0x030C0000
+  const auto isRefused = [](const std::string& module)
+  {
+    std::unique_lock lock(refusedLock);
+    return refusedModules.contains(module);
+  };
+
+  if (ownGil && SupportsOwnGil() && std::none_of(modules.begin(), modules.end(), isRefused))
+  {
+    // same as the legacy configuration of Py_NewInterpreter() apart from the GIL and what it
+    // requires, an allocator of its own and extension modules checked for support
+    const PyInterpreterConfig config{
+        .use_main_obmalloc = 0,
+        .allow_fork = 1,
+        .allow_exec = 1,
+        .allow_threads = 1,
+        .allow_daemon_threads = 1,
+        .check_multi_interp_extensions = 1,
+        .gil = PyInterpreterConfig_OWN_GIL,
+    };
+
+    PyThreadState* state = nullptr;
+    const PyStatus status = Py_NewInterpreterFromConfig(&state, &config);
+    if (PyStatus_Exception(status) || !state)
+    {
+      // the main interpreter's thread state is current again
+      CLog::Log(LOGWARNING, "PythonBindings: unable to create an interpreter with its own GIL: {}",
+                status.err_msg ? status.err_msg : "unknown error");
+    }
+    else
+    {
+      std::string refused;
+      for (const auto& module : modules)
+      {
+        PyObject* pyModule = PyImport_ImportModule(module.c_str());
+        if (!pyModule)
+        {
+          PyErr_Clear();
+          refused = module;
+          break;
+        }
+        Py_DECREF(pyModule);
+      }
+
+      if (refused.empty())
+        return state;
+
+      CLog::Log(LOGINFO,
+                "PythonBindings: module {} does not support interpreters with their own GIL, "
+                "using the shared GIL",
+                refused);
+      {
+        std::unique_lock lock(refusedLock);
+        refusedModules.insert(refused);
+      }
+
+      // leaves no thread state current and the main interpreter's GIL released
+      Py_EndInterpreter(state);
+      PyEval_RestoreThread(mainState);
+    }
+  }
+#endif
+
+  ownGil = false;
+  return Py_NewInterpreter();
+}
+} // namespace PythonBindings
@@ -0,0 +1,45 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+typedef struct _ts PyThreadState;
+
+namespace PythonBindings
+{
+/*!
+ * \brief Whether the Python Kodi is built and running with supports sub-interpreters with a GIL
+ * of their own (PEP 684, Python 3.12 and newer).
+ */
+bool SupportsOwnGil();
+
+/*!
+ * \brief Create a sub-interpreter, with a GIL of its own if requested and possible.
+ *
+ * Must be called holding the GIL through the given thread state of the main interpreter. Returns
+ * holding the GIL of the new interpreter, the main interpreter's GIL is released if the new one
+ * got a GIL of its own.
+ *
+ * An interpreter with its own GIL only loads extension modules that declare support for it, so
+ * \p modules is imported into it first. If one of them fails to load, or the Python in use has no
+ * support, the interpreter shares the main interpreter's GIL instead. Once a module failed to
+ * load, interpreters requiring it share the GIL right away.
+ *
+ * \param mainState thread state of the main interpreter, held by the calling thread
+ * \param ownGil [in] whether to try a GIL of its own, [out] whether the interpreter got one
+ * \param modules modules the interpreter must be able to import
+ * \return the thread state of the new interpreter, nullptr on failure with the main interpreter's
+ *         GIL still held
+ */
+PyThreadState* NewInterpreter(PyThreadState* mainState,
+                              bool& ownGil,
+                              const std::vector<std::string>& modules);
+} // namespace PythonBindings
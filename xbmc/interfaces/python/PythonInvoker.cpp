@@ -24,9 +24,12 @@
 #include "guilib/GUIWindowManager.h"
 #include "guilib/LocalizeStrings.h"
 #include "interfaces/python/PyContext.h"
+#include "interfaces/python/PyInterpreter.h"
 #include "interfaces/python/pythreadstate.h"
 #include "interfaces/python/swig.h"
 #include "messaging/ApplicationMessenger.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
 #include "threads/SingleLock.h"
 #include "threads/SystemClock.h"
 #include "utils/CharsetConverter.h"
@@ -43,6 +46,7 @@
 #include <osdefs.h>
 // clang-format on
 
+#include <algorithm>
 #include <cassert>
 #include <iterator>
 
@@ -158,19 +162,27 @@ bool CPythonInvoker::execute(const std::string& script, std::vector<std::wstring
       // this is a TOTAL hack. We need the GIL but we need to borrow a PyThreadState in order to get it
       // as of Python 3.2 since PyEval_AcquireLock is deprecated
       extern PyThreadState* savestate;
-      PyEval_RestoreThread(savestate);
+      PyThreadState* ts = savestate;
 #else
       PyThreadState* ts = PyInterpreterState_ThreadHead(PyInterpreterState_Main());
-      PyEval_RestoreThread(ts);
 #endif
-      l_threadState = Py_NewInterpreter();
-      PyEval_ReleaseThread(l_threadState);
+      PyEval_RestoreThread(ts);
+
+      // add-ons on the allow-list run on a GIL of their own if Python and the modules allow it
+      bool ownGil = m_addon && IsOwnGilAllowed(m_addon->ID());
+      l_threadState = PythonBindings::NewInterpreter(ts, ownGil, getModules());
       if (l_threadState == NULL)
       {
+        PyEval_ReleaseThread(ts);
         CLog::Log(LOGERROR, "CPythonInvoker({}, {}): FAILED to get thread m_threadState!", GetId(),
                   m_sourceFile);
         return false;
       }
+      PyEval_ReleaseThread(l_threadState);
+      if (ownGil)
+        CLog::Log(LOGDEBUG, "CPythonInvoker({}, {}): running with its own GIL", GetId(),
+                  m_sourceFile);
+      m_ownGil = ownGil;
       newInterp = true;
     }
     else
@@ -254,9 +266,24 @@ bool CPythonInvoker::execute(const std::string& script, std::vector<std::wstring
     }
   }
   else
+  {
     // swap in my thread m_threadState
     PyThreadState_Swap(m_threadState);
 
+    // the imported modules stay loaded in a reused interpreter, the globals of the previous run
+    // of the script must not leak into this one
+    PyObject* mainDict = PyModule_GetDict(PyImport_AddModule("__main__"));
+    PyObject* builtins = PyDict_GetItemString(mainDict, "__builtins__");
+    Py_XINCREF(builtins);
+    PyDict_Clear(mainDict);
+    PyDict_SetItemString(mainDict, "__name__", PyObjectPtr(PyUnicode_FromString("__main__")).get());
+    if (builtins)
+    {
+      PyDict_SetItemString(mainDict, "__builtins__", builtins);
+      Py_DECREF(builtins);
+    }
+  }
+
   PyObject* sysArgv = PyList_New(0);
 
   if (arguments.empty())
@@ -586,8 +613,12 @@ void CPythonInvoker::onExecutionDone()
 #if PY_VERSION_HEX < 0x03070000
     PyEval_ReleaseLock();
 #else
-    PyThreadState_Swap(PyInterpreterState_ThreadHead(PyInterpreterState_Main()));
-    PyEval_SaveThread();
+    // a GIL of its own ended with the interpreter, the shared one is still held
+    if (!m_ownGil)
+    {
+      PyThreadState_Swap(PyInterpreterState_ThreadHead(PyInterpreterState_Main()));
+      PyEval_SaveThread();
+    }
 #endif
 
     // set stopped event - this allows ::stop to run and kill remaining threads
@@ -699,6 +730,13 @@ void CPythonInvoker::getAddonModuleDeps(const ADDON::AddonPtr& addon, std::set<s
   }
 }
 
+bool CPythonInvoker::IsOwnGilAllowed(const std::string& addonId)
+{
+  const auto& addons =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_pythonOwnGilAddons;
+  return std::find(addons.begin(), addons.end(), addonId) != addons.end();
+}
+
 void CPythonInvoker::PyObjectDeleter::operator()(PyObject* p) const
 {
   assert(Py_REFCNT(p) == 2);
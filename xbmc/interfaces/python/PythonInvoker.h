@@ -41,6 +41,8 @@ protected:
 
   // custom virtual methods
   virtual const char* getInitializationScript() const = 0;
+  // modules an interpreter with its own GIL must be able to load, it shares the GIL otherwise
+  virtual std::vector<std::string> getModules() const { return {}; }
   virtual void onInitialization();
   // actually a PyObject* but don't wanna draw Python.h include into the header
   virtual void onPythonModuleInitialization(void* moduleDict);
@@ -57,10 +59,12 @@ protected:
 
 private:
   void getAddonModuleDeps(const ADDON::AddonPtr& addon, std::set<std::string>& paths);
+  static bool IsOwnGilAllowed(const std::string& addonId);
   bool execute(const std::string& script, std::vector<std::wstring>& arguments);
   FILE* PyFile_AsFileWithMode(PyObject* py_file, const char* mode);
 
   PyThreadState* m_threadState;
+  bool m_ownGil = false;
   bool m_stop = false;
   CEvent m_stoppedEvent;
 
@@ -0,0 +1,125 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+// python.h should always be included first before any other includes
+#include <Python.h>
+
+#include "interfaces/python/PyInterpreter.h"
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace PythonBindings;
+
+namespace
+{
+// the main interpreter's thread state, not held by any thread between the tests
+PyThreadState* mainState = nullptr;
+
+// run on its own thread like a script in CPythonInvoker
+bool RunScript(const std::string& script, bool ownGil, const std::vector<std::string>& modules)
+{
+  PyEval_RestoreThread(mainState);
+  const bool wanted = ownGil;
+  PyThreadState* state = NewInterpreter(mainState, ownGil, modules);
+  if (!state)
+  {
+    PyEval_SaveThread();
+    return false;
+  }
+  PyEval_ReleaseThread(state);
+
+  PyEval_RestoreThread(state);
+  const bool success = PyRun_SimpleString(script.c_str()) == 0;
+  Py_EndInterpreter(state);
+  if (!ownGil)
+  {
+    PyThreadState_Swap(mainState);
+    PyEval_SaveThread();
+  }
+  return success && ownGil == (wanted && SupportsOwnGil());
+}
+} // unnamed namespace
+
+class TestPyInterpreter : public testing::Test
+{
+protected:
+  static void SetUpTestSuite()
+  {
+    if (!Py_IsInitialized())
+    {
+      Py_InitializeEx(0);
+      mainState = PyEval_SaveThread();
+    }
+    else
+      mainState = PyInterpreterState_ThreadHead(PyInterpreterState_Main());
+  }
+};
+
+TEST_F(TestPyInterpreter, OwnGil)
+{
+  EXPECT_TRUE(RunScript("import math\nassert math.sqrt(4) == 2", true, {"math"}));
+  EXPECT_TRUE(RunScript("import math\nassert math.sqrt(4) == 2", false, {"math"}));
+}
+
+TEST_F(TestPyInterpreter, SharedGilIfModuleRefused)
+{
+  PyEval_RestoreThread(mainState);
+  bool ownGil = true;
+  PyThreadState* state = NewInterpreter(mainState, ownGil, {"kodi_test_missing_module"});
+  ASSERT_NE(nullptr, state);
+  EXPECT_FALSE(ownGil);
+  EXPECT_NE(PyInterpreterState_Main(), state->interp);
+  Py_EndInterpreter(state);
+  PyThreadState_Swap(mainState);
+  PyEval_SaveThread();
+
+  // no further attempt with the module refused
+  EXPECT_TRUE(RunScript("pass", false, {"kodi_test_missing_module"}));
+}
+
+// Benchmark, run with --gtest_also_run_disabled_tests. Runs as many CPU-bound scripts at once as
+// there are cores, up to 8, each in an interpreter of its own, once sharing the GIL and once with
+// a GIL per interpreter.
+TEST_F(TestPyInterpreter, DISABLED_ConcurrentScriptsBenchmark)
+{
+  if (!SupportsOwnGil())
+    GTEST_SKIP() << "Python has no support for a GIL per interpreter";
+
+  const unsigned int scripts = std::clamp(std::thread::hardware_concurrency(), 2u, 8u);
+  const std::string script = "total = 0\n"
+                             "for i in range(3000000):\n"
+                             "  total += i * i\n";
+
+  const auto run = [&](const std::string& property, bool ownGil)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    std::vector<char> results(scripts, false);
+    for (unsigned int i = 0; i < scripts; ++i)
+      threads.emplace_back([&, i] { results[i] = RunScript(script, ownGil, {}); });
+    for (auto& thread : threads)
+      thread.join();
+    const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                        std::chrono::steady_clock::now() - start)
+                        .count();
+    EXPECT_TRUE(std::all_of(results.begin(), results.end(), [](char result) { return result; }));
+    RecordProperty(property + "_ms", std::to_string(ms));
+    return ms;
+  };
+
+  RecordProperty("scripts", std::to_string(scripts));
+  const auto shared = run("shared_gil", false);
+  const auto own = run("own_gil", true);
+  RecordProperty("speedup_percent", std::to_string(shared * 100 / std::max<long long>(own, 1)));
+}
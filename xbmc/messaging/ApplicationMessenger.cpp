@@ -16,6 +16,7 @@
 
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <utility>
 
 namespace KODI
@@ -58,28 +59,24 @@ CApplicationMessenger::~CApplicationMessenger()
 
 void CApplicationMessenger::Cleanup()
 {
-  std::unique_lock lock(m_critSection);
-
-  while (!m_vecMessages.empty())
-  {
-    ThreadMessage* pMsg = m_vecMessages.front();
-
-    if (pMsg->waitEvent)
-      pMsg->waitEvent->Set();
+  ClearQueue(m_vecMessages, m_messagesSection);
+  ClearQueue(m_vecWindowMessages, m_windowMessagesSection);
+}
 
-    delete pMsg;
-    m_vecMessages.pop();
-  }
+void CApplicationMessenger::ClearQueue(std::queue<ThreadMessage*>& queue,
+                                       CCriticalSection& queueSection)
+{
+  std::unique_lock lock(queueSection);
 
-  while (!m_vecWindowMessages.empty())
+  while (!queue.empty())
   {
-    ThreadMessage* pMsg = m_vecWindowMessages.front();
+    ThreadMessage* pMsg = queue.front();
 
     if (pMsg->waitEvent)
       pMsg->waitEvent->Set();
 
     delete pMsg;
-    m_vecWindowMessages.pop();
+    queue.pop();
   }
 }
 
@@ -115,9 +112,15 @@ int CApplicationMessenger::SendMsg(ThreadMessage&& message, bool wait)
 
   ThreadMessage* msg = new ThreadMessage(std::move(message));
 
-  std::unique_lock lock(m_critSection);
+  if (m_latencyTracing)
+    msg->enqueueTime = std::chrono::steady_clock::now();
+
+  // window messages get their own queue and lock so that producers of regular messages are not
+  // held up behind a GUI thread busy with (slow) window messages and vice versa
+  const bool isWindowMessage = msg->dwMessage == TMSG_GUI_MESSAGE;
+  std::unique_lock lock(isWindowMessage ? m_windowMessagesSection : m_messagesSection);
 
-  if (msg->dwMessage == TMSG_GUI_MESSAGE)
+  if (isWindowMessage)
     m_vecWindowMessages.push(msg);
   else
     m_vecMessages.push(msg);
@@ -201,12 +204,18 @@ void CApplicationMessenger::PostMsg(uint32_t messageId, int param1, int param2,
 void CApplicationMessenger::ProcessMessages()
 {
   // process threadmessages
-  std::unique_lock lock(m_critSection);
-  while (!m_vecMessages.empty())
+  ProcessQueue(m_vecMessages, m_messagesSection);
+}
+
+void CApplicationMessenger::ProcessQueue(std::queue<ThreadMessage*>& queue,
+                                         CCriticalSection& queueSection)
+{
+  std::unique_lock lock(queueSection);
+  while (!queue.empty())
   {
-    ThreadMessage* pMsg = m_vecMessages.front();
+    ThreadMessage* pMsg = queue.front();
     //first remove the message from the queue, else the message could be processed more then once
-    m_vecMessages.pop();
+    queue.pop();
 
     //Leave here as the message might make another
     //thread call processmessages or sendmessage
@@ -214,8 +223,16 @@ void CApplicationMessenger::ProcessMessages()
     std::shared_ptr<CEvent> waitEvent = pMsg->waitEvent;
     lock.unlock(); // <- see the large comment in SendMessage ^
 
+    const bool trace = m_latencyTracing && pMsg->enqueueTime.time_since_epoch().count() != 0;
+    const auto dispatchTime = trace ? std::chrono::steady_clock::now()
+                                    : std::chrono::steady_clock::time_point{};
+
     ProcessMessage(pMsg);
 
+    if (trace)
+      m_latencyTracer.Record(pMsg->dwMessage, dispatchTime - pMsg->enqueueTime,
+                             std::chrono::steady_clock::now() - dispatchTime);
+
     if (waitEvent)
       waitEvent->Set();
     delete pMsg;
@@ -234,41 +251,26 @@ void CApplicationMessenger::ProcessMessage(ThreadMessage *pMsg)
     return;
   }
 
-  std::unique_lock lock(m_critSection);
   int mask = pMsg->dwMessage & TMSG_MASK_MESSAGE;
 
-  const auto it = m_mapTargets.find(mask);
-  if (it != m_mapTargets.end())
+  IMessageTarget* target = nullptr;
   {
-    CSingleExit exit(m_critSection);
-    it->second->OnApplicationMessage(pMsg);
+    std::shared_lock lock(m_targetsSection);
+    const auto it = m_mapTargets.find(mask);
+    if (it != m_mapTargets.end())
+      target = it->second;
   }
+
+  if (target)
+    target->OnApplicationMessage(pMsg);
   else
     CLog::LogF(LOGERROR, "receiver {} is not defined", mask);
 }
 
 void CApplicationMessenger::ProcessWindowMessages()
 {
-  std::unique_lock lock(m_critSection);
   //message type is window, process window messages
-  while (!m_vecWindowMessages.empty())
-  {
-    ThreadMessage* pMsg = m_vecWindowMessages.front();
-    //first remove the message from the queue, else the message could be processed more then once
-    m_vecWindowMessages.pop();
-
-    // leave here in case we make more thread messages from this one
-
-    std::shared_ptr<CEvent> waitEvent = pMsg->waitEvent;
-    lock.unlock(); // <- see the large comment in SendMessage ^
-
-    ProcessMessage(pMsg);
-    if (waitEvent)
-      waitEvent->Set();
-    delete pMsg;
-
-    lock.lock();
-  }
+  ProcessQueue(m_vecWindowMessages, m_windowMessagesSection);
 }
 
 void CApplicationMessenger::SendGUIMessage(const CGUIMessage &message, int windowID, bool waitResult)
@@ -281,10 +283,26 @@ void CApplicationMessenger::SendGUIMessage(const CGUIMessage &message, int windo
 
 void CApplicationMessenger::RegisterReceiver(IMessageTarget* target)
 {
-  std::unique_lock lock(m_critSection);
+  std::unique_lock lock(m_targetsSection);
   m_mapTargets.insert(std::make_pair(target->GetMessageMask(), target));
 }
 
+void CApplicationMessenger::SetLatencyTracing(bool enable)
+{
+  if (m_latencyTracing == enable)
+    return;
+
+  if (enable)
+  {
+    m_latencyTracer.Reset();
+    CLog::Log(LOGINFO, "CApplicationMessenger: message latency tracing enabled");
+  }
+  else
+    m_latencyTracer.Log();
+
+  m_latencyTracing = enable;
+}
+
 bool CApplicationMessenger::IsProcessThread() const
 {
   return m_processThreadId == CThread::GetCurrentThreadId();
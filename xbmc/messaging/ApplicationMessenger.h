@@ -9,9 +9,12 @@
 #pragma once
 
 #include "guilib/WindowIDs.h"
+#include "messaging/MessageLatencyTracer.h"
 #include "messaging/ThreadMessage.h"
+#include "threads/SharedSection.h"
 #include "threads/Thread.h"
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <queue>
@@ -424,20 +427,39 @@ public:
   //! \brief Returns true if this is the process / app loop thread.
   bool IsProcessThread() const;
 
+  /*!
+   * \brief Enable or disable recording of enqueue to dispatch and dispatch to completion
+   * latencies for every message. Disabling the trace writes the collected histograms to the log.
+   * \param enable whether to record latencies
+   */
+  void SetLatencyTracing(bool enable);
+
+  //! \brief Returns true if message latencies are being recorded.
+  bool IsLatencyTracing() const { return m_latencyTracing; }
+
+  //! \brief Returns the latency histograms collected while tracing was enabled.
+  const CMessageLatencyTracer& GetLatencyTracer() const { return m_latencyTracer; }
+
 private:
   CApplicationMessenger(const CApplicationMessenger&) = delete;
   CApplicationMessenger const& operator=(CApplicationMessenger const&) = delete;
 
   int SendMsg(ThreadMessage&& msg, bool wait);
   void ProcessMessage(ThreadMessage *pMsg);
+  void ProcessQueue(std::queue<ThreadMessage*>& queue, CCriticalSection& queueSection);
+  void ClearQueue(std::queue<ThreadMessage*>& queue, CCriticalSection& queueSection);
 
   std::queue<ThreadMessage*> m_vecMessages; /*!< queue for regular messages */
   std::queue<ThreadMessage*> m_vecWindowMessages; /*!< queue for UI messages */
   std::map<int, IMessageTarget*> m_mapTargets; /*!< a map of registered receivers indexed on the message mask*/
-  CCriticalSection m_critSection;
+  CCriticalSection m_messagesSection; /*!< guards m_vecMessages */
+  CCriticalSection m_windowMessagesSection; /*!< guards m_vecWindowMessages */
+  mutable CSharedSection m_targetsSection; /*!< guards m_mapTargets */
   std::thread::id m_guiThreadId;
   std::thread::id m_processThreadId;
   bool m_bStop{ false };
+  std::atomic<bool> m_latencyTracing{false};
+  CMessageLatencyTracer m_latencyTracer;
 };
 }
 }
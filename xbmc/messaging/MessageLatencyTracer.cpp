@@ -0,0 +1,145 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "MessageLatencyTracer.h"
+
+#include "utils/StringUtils.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <mutex>
+
+using namespace KODI::MESSAGING;
+using namespace std::chrono;
+
+namespace
+{
+size_t GetBucket(CMessageLatencyTracer::Duration latency)
+{
+  const auto us = duration_cast<microseconds>(latency).count();
+  size_t bucket = 0;
+  // bucket n holds latencies up to 2^n us
+  while (bucket < CMessageLatencyTracer::BUCKETS - 1 && (int64_t{1} << bucket) < us)
+    bucket++;
+  return bucket;
+}
+
+CMessageLatencyTracer::Duration GetBucketBound(size_t bucket)
+{
+  return microseconds(int64_t{1} << bucket);
+}
+
+int64_t ToMicroseconds(CMessageLatencyTracer::Duration latency)
+{
+  return duration_cast<microseconds>(latency).count();
+}
+} // unnamed namespace
+
+void CMessageLatencyTracer::CHistogram::Add(Duration latency)
+{
+  if (latency < Duration::zero())
+    latency = Duration::zero();
+
+  m_buckets[GetBucket(latency)]++;
+  m_count++;
+  m_total += latency;
+  if (latency > m_max)
+    m_max = latency;
+}
+
+CMessageLatencyTracer::Duration CMessageLatencyTracer::CHistogram::GetMean() const
+{
+  if (m_count == 0)
+    return Duration::zero();
+
+  return m_total / static_cast<Duration::rep>(m_count);
+}
+
+CMessageLatencyTracer::Duration CMessageLatencyTracer::CHistogram::GetPercentile(
+    double percentile) const
+{
+  if (m_count == 0)
+    return Duration::zero();
+
+  const auto rank = static_cast<uint64_t>(percentile / 100.0 * static_cast<double>(m_count));
+  uint64_t seen = 0;
+  for (size_t i = 0; i < BUCKETS; ++i)
+  {
+    seen += m_buckets[i];
+    if (seen > rank || seen == m_count)
+      return std::min(GetBucketBound(i), m_max);
+  }
+  return m_max;
+}
+
+std::string CMessageLatencyTracer::CHistogram::ToString() const
+{
+  std::string result;
+  for (size_t i = 0; i < BUCKETS; ++i)
+  {
+    if (m_buckets[i] == 0)
+      continue;
+
+    if (!result.empty())
+      result += " ";
+    result += StringUtils::Format("<={}us:{}", ToMicroseconds(GetBucketBound(i)), m_buckets[i]);
+  }
+  return result;
+}
+
+void CMessageLatencyTracer::Record(uint32_t messageId, Duration queued, Duration dispatched)
+{
+  std::unique_lock lock(m_critSection);
+
+  Histograms& histograms = m_histograms[messageId];
+  histograms.queued.Add(queued);
+  histograms.dispatched.Add(dispatched);
+  m_total.queued.Add(queued);
+  m_total.dispatched.Add(dispatched);
+}
+
+std::map<uint32_t, CMessageLatencyTracer::Histograms> CMessageLatencyTracer::GetHistograms() const
+{
+  std::unique_lock lock(m_critSection);
+  return m_histograms;
+}
+
+std::string CMessageLatencyTracer::GetSummary() const
+{
+  std::unique_lock lock(m_critSection);
+  return StringUtils::Format(
+      "MSG: {} - queue p50/p99/max: {}/{}/{} us - dispatch p50/p99/max: {}/{}/{} us",
+      m_total.queued.GetCount(), ToMicroseconds(m_total.queued.GetPercentile(50)),
+      ToMicroseconds(m_total.queued.GetPercentile(99)), ToMicroseconds(m_total.queued.GetMax()),
+      ToMicroseconds(m_total.dispatched.GetPercentile(50)),
+      ToMicroseconds(m_total.dispatched.GetPercentile(99)),
+      ToMicroseconds(m_total.dispatched.GetMax()));
+}
+
+void CMessageLatencyTracer::Log() const
+{
+  std::unique_lock lock(m_critSection);
+
+  CLog::Log(LOGINFO, "CMessageLatencyTracer: {}", GetSummary());
+  for (const auto& [messageId, histograms] : m_histograms)
+  {
+    CLog::Log(LOGINFO,
+              "CMessageLatencyTracer: message {:#x} count {} queue mean {} us [{}] dispatch mean "
+              "{} us [{}]",
+              messageId, histograms.queued.GetCount(),
+              ToMicroseconds(histograms.queued.GetMean()), histograms.queued.ToString(),
+              ToMicroseconds(histograms.dispatched.GetMean()), histograms.dispatched.ToString());
+  }
+}
+
+void CMessageLatencyTracer::Reset()
+{
+  std::unique_lock lock(m_critSection);
+  m_histograms.clear();
+  m_total = {};
+}
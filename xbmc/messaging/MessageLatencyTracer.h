@@ -0,0 +1,108 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace KODI
+{
+namespace MESSAGING
+{
+
+/*!
+ * \brief Collects per message id latency histograms for the application messenger.
+ *
+ * Two latencies are tracked for every dispatched message: the time it spent waiting in the
+ * queue (enqueue to dispatch) and the time the receiver needed to handle it (dispatch to
+ * completion). Samples are bucketed by powers of two of microseconds, so recording is cheap and
+ * memory use is independent of the number of messages.
+ */
+class CMessageLatencyTracer
+{
+public:
+  using Duration = std::chrono::steady_clock::duration;
+
+  static constexpr size_t BUCKETS = 32;
+
+  class CHistogram
+  {
+  public:
+    void Add(Duration latency);
+
+    uint64_t GetCount() const { return m_count; }
+    Duration GetMax() const { return m_max; }
+    Duration GetMean() const;
+
+    /*!
+     * \brief Get an upper bound for the given percentile
+     * \param percentile the percentile in the range [0, 100]
+     * \return the upper bound of the bucket holding the percentile
+     */
+    Duration GetPercentile(double percentile) const;
+
+    /*!
+     * \brief Format the non-empty buckets as "<=bound:count" pairs
+     */
+    std::string ToString() const;
+
+  private:
+    std::array<uint64_t, BUCKETS> m_buckets{};
+    uint64_t m_count{0};
+    Duration m_total{0};
+    Duration m_max{0};
+  };
+
+  struct Histograms
+  {
+    CHistogram queued; /*!< enqueue to dispatch */
+    CHistogram dispatched; /*!< dispatch to completion */
+  };
+
+  /*!
+   * \brief Record the latencies of a processed message
+   * \param messageId the id of the message
+   * \param queued time between enqueue and dispatch
+   * \param dispatched time the receiver needed to process the message
+   */
+  void Record(uint32_t messageId, Duration queued, Duration dispatched);
+
+  /*!
+   * \brief Get a snapshot of the histograms of all recorded message ids
+   */
+  std::map<uint32_t, Histograms> GetHistograms() const;
+
+  /*!
+   * \brief Get a short summary over all message ids, suitable for an on screen overlay
+   */
+  std::string GetSummary() const;
+
+  /*!
+   * \brief Write the histograms of all recorded message ids to the log
+   */
+  void Log() const;
+
+  /*!
+   * \brief Drop all recorded samples
+   */
+  void Reset();
+
+private:
+  mutable CCriticalSection m_critSection;
+  std::map<uint32_t, Histograms> m_histograms;
+  Histograms m_total;
+};
+
+} // namespace MESSAGING
+} // namespace KODI
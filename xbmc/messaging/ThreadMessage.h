@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -78,7 +79,8 @@ public:
       strParam(std::move(other.strParam)),
       params(std::move(other.params)),
       waitEvent(std::move(other.waitEvent)),
-      result(std::move(other.result))
+      result(std::move(other.result)),
+      enqueueTime(other.enqueueTime)
   {
   }
 
@@ -95,6 +97,7 @@ public:
     params = other.params;
     waitEvent = other.waitEvent;
     result = other.result;
+    enqueueTime = other.enqueueTime;
     return *this;
   }
 
@@ -111,6 +114,7 @@ public:
     params = std::move(other.params);
     waitEvent = std::move(other.waitEvent);
     result = std::move(other.result);
+    enqueueTime = other.enqueueTime;
     return *this;
   }
 
@@ -138,6 +142,7 @@ public:
 protected:
   std::shared_ptr<CEvent> waitEvent;
   std::shared_ptr<int> result;
+  std::chrono::steady_clock::time_point enqueueTime; /*!< only set while latency tracing */
 };
 }
 }
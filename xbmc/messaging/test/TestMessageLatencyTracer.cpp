@@ -0,0 +1,56 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "messaging/MessageLatencyTracer.h"
+
+#include <gtest/gtest.h>
+
+using namespace KODI::MESSAGING;
+using namespace std::chrono_literals;
+
+TEST(TestMessageLatencyTracer, Empty)
+{
+  CMessageLatencyTracer::CHistogram histogram;
+  EXPECT_EQ(0u, histogram.GetCount());
+  EXPECT_EQ(CMessageLatencyTracer::Duration::zero(), histogram.GetMean());
+  EXPECT_EQ(CMessageLatencyTracer::Duration::zero(), histogram.GetPercentile(99));
+  EXPECT_TRUE(histogram.ToString().empty());
+}
+
+TEST(TestMessageLatencyTracer, Histogram)
+{
+  CMessageLatencyTracer::CHistogram histogram;
+  for (int i = 0; i < 99; ++i)
+    histogram.Add(3us);
+  histogram.Add(1000us);
+
+  EXPECT_EQ(100u, histogram.GetCount());
+  EXPECT_EQ(CMessageLatencyTracer::Duration(1000us), histogram.GetMax());
+  // 3us falls into the (2us, 4us] bucket
+  EXPECT_EQ(CMessageLatencyTracer::Duration(4us), histogram.GetPercentile(50));
+  EXPECT_EQ(CMessageLatencyTracer::Duration(1000us), histogram.GetPercentile(100));
+  EXPECT_EQ("<=4us:99 <=1024us:1", histogram.ToString());
+}
+
+TEST(TestMessageLatencyTracer, RecordPerMessage)
+{
+  CMessageLatencyTracer tracer;
+  tracer.Record(1, 10us, 100us);
+  tracer.Record(1, 20us, 200us);
+  tracer.Record(2, 1ms, 1ms);
+
+  auto histograms = tracer.GetHistograms();
+  ASSERT_EQ(2u, histograms.size());
+  EXPECT_EQ(2u, histograms[1].queued.GetCount());
+  EXPECT_EQ(CMessageLatencyTracer::Duration(15us), histograms[1].queued.GetMean());
+  EXPECT_EQ(CMessageLatencyTracer::Duration(200us), histograms[1].dispatched.GetMax());
+  EXPECT_EQ(1u, histograms[2].dispatched.GetCount());
+
+  tracer.Reset();
+  EXPECT_TRUE(tracer.GetHistograms().empty());
+}
@@ -427,6 +427,47 @@ void CMusicDatabase::CreateRemovedLinkTriggers()
               " END");
 }
 
+std::vector<std::string> CMusicDatabase::GetDeferrableAnalytics() const
+{
+  // Indices not used when adding items, and the triggers run for every inserted row. Unique
+  // idxAlbumArtist_2 and idxSongGenre_2 are covered by their _1 counterparts.
+  return {"idxSong",
+          "idxSong1",
+          "idxSong2",
+          "idxSongArtist_4",
+          "idxAlbum_1",
+          "idxAlbum_3",
+          "idxArtist_2",
+          "idxAlbumArtist_2",
+          "idxSongGenre_2",
+          "tgrInsertSong",
+          "tgrInsertAlbum",
+          "tgrInsertArtist",
+          "tgrInsertSongArtist",
+          "tgrInsertAlbumArtist"};
+}
+
+void CMusicDatabase::UpdateDeferredAnalytics()
+{
+  // Rows inserted without the triggers have no dateModified, nor a dateNew unless reusing an id
+  for (const char* table : {"song", "album", "artist"})
+  {
+    m_pDS->exec(
+        PrepareSQL("UPDATE %s SET dateNew = DATETIME('now') WHERE dateNew IS NULL", table));
+    m_pDS->exec(PrepareSQL(
+        "UPDATE %s SET dateModified = DATETIME('now') WHERE dateModified IS NULL", table));
+  }
+
+  // Links added again are no longer removed
+  m_pDS->exec("DELETE FROM removed_link WHERE EXISTS (SELECT 1 FROM song_artist "
+              "WHERE song_artist.idArtist = removed_link.idArtist "
+              "AND song_artist.idSong = removed_link.idMedia "
+              "AND song_artist.idRole = removed_link.idRole)");
+  m_pDS->exec("DELETE FROM removed_link WHERE idRole = -1 AND EXISTS (SELECT 1 FROM album_artist "
+              "WHERE album_artist.idArtist = removed_link.idArtist "
+              "AND album_artist.idAlbum = removed_link.idMedia)");
+}
+
 
 void CMusicDatabase::CreateViews()
 {
@@ -12356,7 +12397,8 @@ void CMusicDatabase::ImportFromXML(const std::string& xmlFile, CGUIDialogProgres
       entry = entry->NextSiblingElement();
     }
 
-    BeginTransaction();
+    // a single transaction, so that canceling rolls the whole import back
+    BeginBulkImport(0);
     entry = root->FirstChildElement();
     while (entry)
     {
@@ -12380,6 +12422,7 @@ void CMusicDatabase::ImportFromXML(const std::string& xmlFile, CGUIDialogProgres
           CLog::LogF(LOGDEBUG, "Not import additional artist data as {} not found",
                      importedArtist.strArtist);
         current++;
+        BulkImportItemDone();
       }
       else if (StringUtils::CompareNoCase(entry->Value(), "album", 5) == 0)
       {
@@ -12400,6 +12443,7 @@ void CMusicDatabase::ImportFromXML(const std::string& xmlFile, CGUIDialogProgres
                      importedAlbum.strAlbum);
 
         current++;
+        BulkImportItemDone();
       }
       entry = entry->NextSiblingElement();
       if (progressDialog && total)
@@ -12409,12 +12453,12 @@ void CMusicDatabase::ImportFromXML(const std::string& xmlFile, CGUIDialogProgres
         progressDialog->Progress();
         if (progressDialog->IsCanceled())
         {
-          RollbackTransaction();
+          RollbackBulkImport();
           return;
         }
       }
     }
-    CommitTransaction();
+    CommitBulkImport();
 
     // Import song playback history <song> entries found
     if (songtotal > 0)
@@ -12428,7 +12472,10 @@ void CMusicDatabase::ImportFromXML(const std::string& xmlFile, CGUIDialogProgres
   catch (...)
   {
     CLog::LogF(LOGERROR, "failed");
-    RollbackTransaction();
+    if (InBulkImport())
+      RollbackBulkImport();
+    else
+      RollbackTransaction();
   }
   if (progressDialog)
     progressDialog->Close();
@@ -877,6 +877,9 @@ protected:
 
   const char* GetBaseDBName() const override { return "MyMusic"; }
 
+  std::vector<std::string> GetDeferrableAnalytics() const override;
+  void UpdateDeferredAnalytics() override;
+
 private:
   /*! \brief (Re)Create the generic database views for songs and albums
    */
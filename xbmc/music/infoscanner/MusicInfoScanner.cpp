@@ -14,6 +14,7 @@
 #include "GUIUserMessages.h"
 #include "MusicAlbumInfo.h"
 #include "MusicInfoScraper.h"
+#include "MusicTagReader.h"
 #include "NfoFile.h"
 #include "ServiceBroker.h"
 #include "TextureCache.h"
@@ -118,6 +119,19 @@ void CMusicInfoScanner::Process()
       // Reset progress vars
       m_currentItem=0;
       m_itemCount=-1;
+      m_scanStart = std::chrono::steady_clock::now();
+      m_foldersScanned = 0;
+      m_songsAdded = 0;
+
+      // Tags are read concurrently while the folders are enumerated, unless disabled
+      const auto& advancedSettings = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+      if (advancedSettings->m_iMusicLibraryTagReaderThreads > 0)
+      {
+        m_tagReader = std::make_unique<CMusicTagReader>(
+            static_cast<unsigned int>(advancedSettings->m_iMusicLibraryTagReaderThreads));
+        m_maxPendingFolders =
+            static_cast<size_t>(std::max(advancedSettings->m_iMusicLibraryPendingFolders, 1));
+      }
 
       // Create the thread to count all files to be scanned
       if (m_handle)
@@ -129,6 +143,11 @@ void CMusicInfoScanner::Process()
       m_bCanInterrupt = false;
       m_needsCleanup = false;
 
+      // Dropped for the whole scan, which writes each folder in a transaction of its own. If the
+      // scan is interrupted they are created again at the next start.
+      const bool deferIndices =
+          advancedSettings->m_bMusicLibraryDeferIndices && m_musicDatabase.DeferAnalytics();
+
       bool commit = true;
       for (const auto& it : m_pathsToScan)
       {
@@ -149,6 +168,7 @@ void CMusicInfoScanner::Process()
         // Clear list of albums added by this scan
         m_albumsAdded.clear();
         bool scancomplete = DoScan(it);
+        scancomplete = CommitFolders(true) && scancomplete;
         if (scancomplete)
         {
           if (!m_albumsAdded.empty())
@@ -173,8 +193,12 @@ void CMusicInfoScanner::Process()
         }
       }
 
+      if (deferIndices)
+        m_musicDatabase.RestoreDeferredAnalytics();
+
       if (commit)
       {
+        CommitChangeJournal("music");
         CServiceBroker::GetGUI()->GetInfoManager().GetInfoProviders().GetLibraryInfoProvider().ResetLibraryBools();
 
         if (m_needsCleanup)
@@ -196,14 +220,15 @@ void CMusicInfoScanner::Process()
       }
 
       m_fileCountReader.StopThread();
+      m_tagReader.reset();
 
       m_musicDatabase.EmptyCache();
 
       auto elapsed =
           std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - tick);
       CLog::Log(LOGINFO,
-                "My Music: Scanning for music info using worker thread, operation took {}s",
-                elapsed.count());
+                "My Music: Scanning for music info using worker thread, operation took {}s ({})",
+                elapsed.count(), GetThroughput());
     }
     if (m_scanType == 1) // load album info
     {
@@ -319,7 +344,14 @@ void CMusicInfoScanner::Start(const std::string& strDirectory, int flags)
   }
   m_musicDatabase.Close();
 
-  m_bClean = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_bMusicLibraryCleanOnUpdate;
+  const auto advancedSettings = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+  m_bClean = advancedSettings->m_bMusicLibraryCleanOnUpdate;
+
+  // only updates of the whole library can rely on the changes journaled since the last one
+  m_journaledPaths.clear();
+  if (strDirectory.empty() && !(m_flags & SCAN_RESCAN) &&
+      advancedSettings->m_bMusicLibraryUseChangeJournal)
+    ApplyChangeJournal("music", false);
 
   m_scanType = 0;
   m_bRunning = true;
@@ -477,7 +509,10 @@ bool CMusicInfoScanner::DoScan(const std::string& strDirectory)
   if (m_handle)
   {
     m_handle->SetTitle(g_localizeStrings.Get(506)); //"Checking media files..."
-    m_handle->SetText(Prettify(strDirectory));
+    if (m_tagReader)
+      m_handle->SetText(Prettify(strDirectory) + " - " + GetThroughput());
+    else
+      m_handle->SetText(Prettify(strDirectory));
   }
 
   std::set<std::string>::const_iterator it = m_seenPaths.find(strDirectory);
@@ -505,6 +540,7 @@ bool CMusicInfoScanner::DoScan(const std::string& strDirectory)
   items.Sort(SortByLabel, SortOrderAscending);
   std::string hash;
   GetPathHash(items, hash);
+  m_foldersScanned++;
 
   // check whether we need to rescan or not
   std::string dbHash;
@@ -524,15 +560,23 @@ bool CMusicInfoScanner::DoScan(const std::string& strDirectory)
     items.FilterCueItems();
     items.Sort(SortByLabel, SortOrderAscending);
 
-    // and then scan in the new information from tags
-    if (RetrieveMusicInfo(strDirectory, items) > 0)
+    if (m_tagReader)
     {
-      if (m_handle)
-        OnDirectoryScanned(strDirectory);
+      // the tags are read in the background, the folder is added once they are complete
+      QueueFolder(strDirectory, hash, items);
     }
+    else
+    {
+      // scan in the new information from tags
+      if (RetrieveMusicInfo(strDirectory, items) > 0)
+      {
+        if (m_handle)
+          OnDirectoryScanned(strDirectory);
+      }
 
-    // save information about this folder
-    m_musicDatabase.SetPathHash(strDirectory, hash);
+      // save information about this folder
+      m_musicDatabase.SetPathHash(strDirectory, hash);
+    }
   }
   else
   { // path is the same - no need to rescan
@@ -569,8 +613,86 @@ bool CMusicInfoScanner::DoScan(const std::string& strDirectory)
   return !m_bStop;
 }
 
+void CMusicInfoScanner::QueueFolder(const std::string& strDirectory,
+                                    const std::string& hash,
+                                    const CFileItemList& items)
+{
+  const std::vector<std::string>& regexps =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_audioExcludeFromScanRegExps;
+
+  auto folder = std::make_unique<PendingFolder>();
+  folder->path = strDirectory;
+  folder->hash = hash;
+  folder->items.SetPath(items.GetPath());
+  folder->items.Append(items);
+
+  // only the files ScanTags() loads a tag for
+  std::vector<CFileItemPtr> files;
+  for (const auto& item : items)
+  {
+    if (item->IsFolder() || PLAYLIST::IsPlayList(*item) || item->IsPicture() ||
+        MUSIC::IsLyrics(*item) || CUtil::ExcludeFileOrFolder(item->GetPath(), regexps))
+      continue;
+    files.push_back(item);
+  }
+  folder->tags = m_tagReader->Read(files);
+
+  m_pendingFolders.push_back(std::move(folder));
+
+  // add what is complete already, waiting for the oldest folder once enough are in flight
+  CommitFolders(false);
+}
+
+bool CMusicInfoScanner::CommitFolders(bool wait)
+{
+  while (!m_pendingFolders.empty())
+  {
+    PendingFolder& folder = *m_pendingFolders.front();
+    if (!folder.tags->IsDone())
+    {
+      if (!wait && m_pendingFolders.size() < m_maxPendingFolders)
+        return true;
+
+      while (!m_bStop && !folder.tags->Wait(std::chrono::milliseconds(100)))
+        ;
+    }
+
+    if (m_bStop)
+    {
+      // nothing of the dropped folders was written, they are scanned again next time
+      m_tagReader->Cancel();
+      m_pendingFolders.clear();
+      return false;
+    }
+
+    if (RetrieveMusicInfo(folder.path, folder.items, true) > 0)
+    {
+      if (m_handle)
+        OnDirectoryScanned(folder.path);
+    }
+
+    // save information about this folder
+    m_musicDatabase.SetPathHash(folder.path, folder.hash);
+
+    m_pendingFolders.pop_front();
+  }
+  return !m_bStop;
+}
+
+std::string CMusicInfoScanner::GetThroughput() const
+{
+  const float seconds = std::max(
+      std::chrono::duration<float>(std::chrono::steady_clock::now() - m_scanStart).count(), 1.0f);
+  const unsigned int filesRead = m_tagReader ? m_tagReader->GetFilesRead() : 0;
+
+  return StringUtils::Format("{:.0f} folders/s, {:.0f} files/s, {:.0f} songs/s",
+                             m_foldersScanned / seconds, filesRead / seconds,
+                             m_songsAdded / seconds);
+}
+
 CInfoScanner::InfoRet CMusicInfoScanner::ScanTags(const CFileItemList& items,
-                                                  CFileItemList& scannedItems)
+                                                  CFileItemList& scannedItems,
+                                                  bool tagsRead /* = false */)
 {
   std::vector<std::string> regexps = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_audioExcludeFromScanRegExps;
 
@@ -591,7 +713,7 @@ CInfoScanner::InfoRet CMusicInfoScanner::ScanTags(const CFileItemList& items,
     m_currentItem++;
 
     CMusicInfoTag& tag = *pItem->GetMusicInfoTag();
-    if (!tag.Loaded())
+    if (!tag.Loaded() && !tagsRead)
     {
       std::unique_ptr<IMusicInfoTagLoader> pLoader (CMusicInfoTagLoaderFactory::CreateLoader(*pItem));
       if (nullptr != pLoader)
@@ -916,7 +1038,9 @@ CInfoScanner::InfoRet CMusicInfoScanner::UpdateArtistInfo(CArtist& artist,
   return result;
 }
 
-int CMusicInfoScanner::RetrieveMusicInfo(const std::string& strDirectory, CFileItemList& items)
+int CMusicInfoScanner::RetrieveMusicInfo(const std::string& strDirectory,
+                                         CFileItemList& items,
+                                         bool tagsRead /* = false */)
 {
   MAPSONGS songsMap;
 
@@ -925,7 +1049,7 @@ int CMusicInfoScanner::RetrieveMusicInfo(const std::string& strDirectory, CFileI
     m_needsCleanup = true;
 
   CFileItemList scannedItems;
-  if (ScanTags(items, scannedItems) == InfoRet::CANCELLED || scannedItems.Size() == 0)
+  if (ScanTags(items, scannedItems, tagsRead) == InfoRet::CANCELLED || scannedItems.Size() == 0)
     return 0;
 
   VECALBUMS albums;
@@ -964,7 +1088,10 @@ int CMusicInfoScanner::RetrieveMusicInfo(const std::string& strDirectory, CFileI
 
   int numAdded = 0;
 
-  // Add all albums to the library, and hence any new song or album artists or other contributors
+  // Add all albums to the library, and hence any new song or album artists or other contributors.
+  // The transactions of AddAlbum() become savepoints of a single one for the folder, which is only
+  // open while writing, so that other writers are not held off while tags and art are read.
+  m_musicDatabase.BeginBulkImport(0);
   for (auto& album : albums)
   {
     if (m_bStop)
@@ -980,6 +1107,8 @@ int CMusicInfoScanner::RetrieveMusicInfo(const std::string& strDirectory, CFileI
 
     numAdded += static_cast<int>(album.songs.size());
   }
+  m_musicDatabase.CommitBulkImport();
+  m_songsAdded += numAdded;
   return numAdded;
 }
 
@@ -8,14 +8,20 @@
 
 #pragma once
 
+#include "FileItemList.h"
 #include "InfoScanner.h"
 #include "MusicAlbumInfo.h"
 #include "MusicInfoScraper.h"
+#include "MusicTagReader.h"
 #include "music/MusicDatabase.h"
 #include "threads/IRunnable.h"
 #include "threads/Thread.h"
 #include "utils/ScraperUrl.h"
 
+#include <chrono>
+#include <deque>
+#include <memory>
+
 class CAlbum;
 class CArtist;
 class CGUIDialogProgressBarHandle;
@@ -238,9 +244,12 @@ protected:
    Add album to library, populate a list of album ids added for possible scraping later.
    Any files which couldn't be scanned (no/bad tags) are discarded in the process.
    \param items [in] list of FileItems to scan
-   \param scannedItems [in] list to populate with the scannedItems
+   \param tagsRead [in] the tags were already loaded by the tag reader, files without a tag have none
+   \return number of songs added
    */
-  int RetrieveMusicInfo(const std::string& strDirectory, CFileItemList& items);
+  int RetrieveMusicInfo(const std::string& strDirectory,
+                        CFileItemList& items,
+                        bool tagsRead = false);
 
   void RetrieveLocalArt();
   void ScrapeInfoAddedAlbums();
@@ -251,8 +260,9 @@ protected:
    Any files which couldn't be scanned (no/bad tags) are discarded in the process.
    \param items [in] list of FileItems to scan
    \param scannedItems [in] list to populate with the scannedItems
+   \param tagsRead [in] the tags were already loaded by the tag reader, files without a tag have none
    */
-  InfoRet ScanTags(const CFileItemList& items, CFileItemList& scannedItems);
+  InfoRet ScanTags(const CFileItemList& items, CFileItemList& scannedItems, bool tagsRead = false);
   int GetPathHash(const CFileItemList &items, std::string &hash);
 
   void Run() override;
@@ -270,6 +280,36 @@ protected:
 
   void ScannerWait(unsigned int milliseconds);
 
+  /*! \brief Folder whose tags are being read by the tag reader, waiting to be added to the library
+   */
+  struct PendingFolder
+  {
+    std::string path;
+    std::string hash;
+    CFileItemList items;
+    std::shared_ptr<CMusicTagReader::CBatch> tags;
+  };
+
+  /*! \brief Hand the files of a changed folder over to the tag reader
+   The folder is added to the library by CommitFolders() once all its tags were read. When the
+   maximum number of pending folders is reached the oldest one is waited for and added first.
+   \param strDirectory [in] path of the folder
+   \param hash [in] hash of the folder, stored once it was added
+   \param items [in] the items of the folder, cue sheets already filtered
+   */
+  void QueueFolder(const std::string& strDirectory, const std::string& hash, const CFileItemList& items);
+
+  /*! \brief Add the pending folders to the library in the order they were queued
+   Folders are added by the scanner thread only, so the database is written by a single thread.
+   \param wait [in] wait for all pending folders, otherwise stop at the first one not read yet
+   \return false if the scan was stopped, the remaining folders are dropped then
+   */
+  bool CommitFolders(bool wait);
+
+  /*! \brief Throughput of the scan stages, folders enumerated, files read and songs added per second
+   */
+  std::string GetThroughput() const;
+
   int m_currentItem;
   int m_itemCount;
   bool m_bStop;
@@ -283,5 +323,12 @@ protected:
   std::set<std::string> m_seenPaths;
   int m_flags;
   CThread m_fileCountReader;
+
+  std::unique_ptr<CMusicTagReader> m_tagReader;
+  std::deque<std::unique_ptr<PendingFolder>> m_pendingFolders;
+  size_t m_maxPendingFolders = 0;
+  std::chrono::steady_clock::time_point m_scanStart;
+  unsigned int m_foldersScanned = 0;
+  unsigned int m_songsAdded = 0;
 };
 }
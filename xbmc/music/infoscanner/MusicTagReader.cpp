@@ -0,0 +1,126 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "MusicTagReader.h"
+
+#include "FileItem.h"
+#include "music/tags/MusicInfoTag.h"
+#include "music/tags/MusicInfoTagLoaderFactory.h"
+#include "threads/Thread.h"
+
+#include <algorithm>
+#include <mutex>
+
+using namespace MUSIC_INFO;
+
+CMusicTagReader::CBatch::CBatch(int files) : m_pending(files)
+{
+  if (files == 0)
+    m_done.Set();
+}
+
+bool CMusicTagReader::CBatch::Wait(std::chrono::milliseconds timeout)
+{
+  return m_done.Wait(timeout);
+}
+
+void CMusicTagReader::CBatch::FileDone()
+{
+  if (--m_pending == 0)
+    m_done.Set();
+}
+
+CMusicTagReader::CMusicTagReader(unsigned int threads)
+{
+  for (unsigned int i = 0; i < std::max(threads, 1u); ++i)
+  {
+    m_threads.emplace_back(std::make_unique<CThread>(this, "MusicTagReader"));
+    m_threads.back()->Create();
+  }
+}
+
+CMusicTagReader::~CMusicTagReader()
+{
+  Cancel();
+  m_stop = true;
+  for (auto& thread : m_threads)
+  {
+    m_queued.Set();
+    thread->StopThread();
+  }
+}
+
+std::shared_ptr<CMusicTagReader::CBatch> CMusicTagReader::Read(
+    const std::vector<std::shared_ptr<CFileItem>>& items)
+{
+  std::vector<std::shared_ptr<CFileItem>> files;
+  for (const auto& item : items)
+  {
+    if (!item->GetMusicInfoTag()->Loaded())
+      files.push_back(item);
+  }
+
+  auto batch = std::make_shared<CBatch>(static_cast<int>(files.size()));
+  if (files.empty())
+    return batch;
+
+  {
+    std::unique_lock lock(m_critSection);
+    for (auto& file : files)
+      m_tasks.push_back({std::move(file), batch});
+  }
+  m_queued.Set();
+
+  return batch;
+}
+
+void CMusicTagReader::Cancel()
+{
+  std::deque<Task> tasks;
+  {
+    std::unique_lock lock(m_critSection);
+    tasks.swap(m_tasks);
+  }
+
+  for (const auto& task : tasks)
+    task.batch->FileDone();
+}
+
+void CMusicTagReader::Run()
+{
+  while (!m_stop)
+  {
+    Task task;
+    {
+      std::unique_lock lock(m_critSection);
+      if (!m_tasks.empty())
+      {
+        task = std::move(m_tasks.front());
+        m_tasks.pop_front();
+        // more work is waiting, pass the wake-up on to another thread
+        if (!m_tasks.empty())
+          m_queued.Set();
+      }
+    }
+
+    if (!task.item)
+    {
+      m_queued.Wait(std::chrono::milliseconds(100));
+      continue;
+    }
+
+    CMusicInfoTag& tag = *task.item->GetMusicInfoTag();
+    std::unique_ptr<IMusicInfoTagLoader> loader(
+        CMusicInfoTagLoaderFactory::CreateLoader(*task.item));
+    if (loader)
+      loader->Load(task.item->GetPath(), tag);
+
+    ++m_filesRead;
+    task.batch->FileDone();
+  }
+}
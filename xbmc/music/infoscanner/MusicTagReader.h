@@ -0,0 +1,100 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+#include "threads/Event.h"
+#include "threads/IRunnable.h"
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <vector>
+
+class CFileItem;
+class CThread;
+
+namespace MUSIC_INFO
+{
+
+/*!
+ \brief Pool of threads loading the tags of music files.
+
+ Reading tags is dominated by the latency of the file system, which is considerable for network
+ shares. The music scanner hands over the files of a folder as a batch and keeps enumerating
+ folders while the tags are loaded, so that several files are in flight at any time. The tags are
+ loaded into the music info tags of the items, nothing else of the items is touched.
+ */
+class CMusicTagReader : public IRunnable
+{
+public:
+  /*!
+   \brief Files of one folder, done once the tags of all of them were loaded
+   */
+  class CBatch
+  {
+  public:
+    explicit CBatch(int files);
+
+    bool IsDone() const { return m_pending == 0; }
+
+    /*!
+     \brief Wait until the tags of all files were loaded
+     \return true if the batch is done, false on timeout
+     */
+    bool Wait(std::chrono::milliseconds timeout);
+
+  private:
+    friend class CMusicTagReader;
+
+    void FileDone();
+
+    std::atomic<int> m_pending;
+    CEvent m_done{true};
+  };
+
+  explicit CMusicTagReader(unsigned int threads);
+  ~CMusicTagReader() override;
+
+  /*!
+   \brief Queue the files for loading their tags
+   \param items the files, items with a loaded tag are skipped
+   \return the batch tracking the files
+   */
+  std::shared_ptr<CBatch> Read(const std::vector<std::shared_ptr<CFileItem>>& items);
+
+  /*!
+   \brief Drop all queued files, their batches are done without loading the tags
+   */
+  void Cancel();
+
+  /*!
+   \brief Number of files whose tags were loaded since the reader was created
+   */
+  unsigned int GetFilesRead() const { return m_filesRead; }
+
+private:
+  void Run() override;
+
+  struct Task
+  {
+    std::shared_ptr<CFileItem> item;
+    std::shared_ptr<CBatch> batch;
+  };
+
+  CCriticalSection m_critSection;
+  std::deque<Task> m_tasks;
+  CEvent m_queued;
+  std::atomic<bool> m_stop{false};
+  std::atomic<unsigned int> m_filesRead{0};
+  std::vector<std::unique_ptr<CThread>> m_threads;
+};
+
+} // namespace MUSIC_INFO
@@ -8,7 +8,9 @@
 #include "TagLibVFSStream.h"
 
 #include "filesystem/File.h"
+#include "utils/log.h"
 
+#include <algorithm>
 #include <limits>
 
 #include <taglib/taglib.h>
@@ -37,6 +39,21 @@ TagLibVFSStream::TagLibVFSStream(const std::string& strFileName, bool readOnly)
   }
   m_strFileName = strFileName;
   m_bIsReadOnly = readOnly || !m_bIsOpen;
+
+  // tag parsers seek and read in small steps, which means a round trip each on network shares.
+  // Streams of unknown length are read directly, the cache needs to know where the file ends.
+  const int64_t fileLength = m_bIsOpen ? m_file.GetLength() : 0;
+  if (readOnly && fileLength > 0)
+  {
+    m_cache = std::make_unique<CTagReadCache>(
+        [this](int64_t offset, uint8_t* buffer, size_t size) -> ssize_t
+        {
+          if (m_file.GetPosition() != offset && m_file.Seek(offset, SEEK_SET) != offset)
+            return -1;
+          return m_file.Read(buffer, size);
+        },
+        fileLength);
+  }
 }
 
 /*!
@@ -44,6 +61,9 @@ TagLibVFSStream::TagLibVFSStream(const std::string& strFileName, bool readOnly)
  */
 TagLibVFSStream::~TagLibVFSStream()
 {
+  if (m_cache)
+    CLog::LogFC(LOGDEBUG, LOGAUDIO, "{} reads for tags of {}", m_cache->GetSourceReads(),
+                m_strFileName);
   m_file.Close();
 }
 
@@ -64,6 +84,19 @@ ByteVector TagLibVFSStream::readBlock(size_t length)
 ByteVector TagLibVFSStream::readBlock(TagLib::ulong length)
 #endif
 {
+  if (m_cache)
+  {
+    // don't trust lengths read from broken tags, the file ends where it ends
+    const size_t available =
+        static_cast<size_t>(std::max<int64_t>(m_cache->GetLength() - m_position, 0));
+    ByteVector byteVector(static_cast<unsigned int>(std::min<size_t>(length, available)));
+    const size_t read = m_cache->Read(m_position, reinterpret_cast<uint8_t*>(byteVector.data()),
+                                      byteVector.size());
+    byteVector.resize(static_cast<unsigned int>(read));
+    m_position += static_cast<int64_t>(read);
+    return byteVector;
+  }
+
 #if (TAGLIB_MAJOR_VERSION >= 2)
   ByteVector byteVector(static_cast<unsigned int>(length));
 #else
@@ -288,6 +321,23 @@ void TagLibVFSStream::seek(TagLib::offset_t offset, Position p)
 void TagLibVFSStream::seek(long offset, Position p)
 #endif
 {
+  if (m_cache)
+  {
+    int64_t startPos;
+    if (p == Beginning)
+      startPos = 0;
+    else if (p == Current)
+      startPos = m_position;
+    else if (p == End)
+      startPos = m_cache->GetLength();
+    else
+      return; // wrong Position value
+
+    // same as below, taglib must not end up beyond the end of the file
+    m_position = std::clamp<int64_t>(startPos + offset, 0, m_cache->GetLength());
+    return;
+  }
+
   const long fileLen = length();
   if (m_bIsReadOnly && fileLen > 0)
   {
@@ -347,7 +397,7 @@ void TagLibVFSStream::clear()
 #if (TAGLIB_MAJOR_VERSION >= 2)
 TagLib::offset_t TagLibVFSStream::tell() const
 {
-  int64_t pos = m_file.GetPosition();
+  int64_t pos = m_cache ? m_position : m_file.GetPosition();
   if (pos > std::numeric_limits<TagLib::offset_t>::max())
     return -1;
   else
@@ -356,7 +406,7 @@ TagLib::offset_t TagLibVFSStream::tell() const
 #else
 long TagLibVFSStream::tell() const
 {
-  int64_t pos = m_file.GetPosition();
+  int64_t pos = m_cache ? m_position : m_file.GetPosition();
   if (pos > std::numeric_limits<long>::max())
     return -1;
   else
@@ -370,11 +420,15 @@ long TagLibVFSStream::tell() const
 #if (TAGLIB_MAJOR_VERSION >= 2)
 TagLib::offset_t TagLibVFSStream::length()
 {
+  if (m_cache)
+    return static_cast<TagLib::offset_t>(m_cache->GetLength());
   return static_cast<TagLib::offset_t>(m_file.GetLength());
 }
 #else
 long TagLibVFSStream::length()
 {
+  if (m_cache)
+    return static_cast<long>(m_cache->GetLength());
   return static_cast<long>(m_file.GetLength());
 }
 #endif
@@ -390,3 +444,12 @@ void TagLibVFSStream::truncate(long length)
 {
   m_file.Truncate(length);
 }
+
+/*!
+ * Fetch the end of the file ahead of parsing.
+ */
+void TagLibVFSStream::PrefetchTail()
+{
+  if (m_cache)
+    m_cache->PrefetchTail();
+}
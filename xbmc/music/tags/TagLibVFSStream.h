@@ -8,8 +8,11 @@
 
 #pragma once
 
+#include "TagReadCache.h"
 #include "filesystem/File.h"
 
+#include <memory>
+
 #include <taglib/taglib.h>
 #include <taglib/tiostream.h>
 
@@ -137,6 +140,12 @@ namespace MUSIC_INFO
     void truncate(long length) override;
 #endif
 
+    /*!
+     * Fetch the end of the file ahead of parsing, for formats with tags at the
+     * end of the file.  Only read only streams are cached.
+     */
+    void PrefetchTail();
+
   protected:
     /*!
      * Returns the buffer size that is used for internal buffering.
@@ -152,6 +161,10 @@ namespace MUSIC_INFO
     XFILE::CFile  m_file;
     bool          m_bIsReadOnly;
     bool          m_bIsOpen;
+
+    // read only streams are served from the cache, the position is tracked here
+    std::unique_ptr<CTagReadCache> m_cache;
+    int64_t       m_position = 0;
   };
 }
 
@@ -1281,6 +1281,13 @@ bool CTagLoaderTagLib::Load(const std::string& strFileName, CMusicInfoTag& tag,
     return false; // and quit without attempting to read non-existent tags
   }
 
+  // APE, ID3v1 and Lyrics3 tags sit at the end of the file, as does the moov atom of many MP4
+  // files, so fetch the tail together rather than piece by piece while parsing
+  if (strExtension == "ape" || strExtension == "mpc" || strExtension == "wv" ||
+      strExtension == "tta" || strExtension == "mp3" || strExtension == "aac" ||
+      strExtension == "mp4" || strExtension == "m4a" || strExtension == "m4b")
+    stream->PrefetchTail();
+
   TagLib::File*              file = nullptr;
   TagLib::APE::File*         apeFile = nullptr;
   TagLib::ASF::File*         asfFile = nullptr;
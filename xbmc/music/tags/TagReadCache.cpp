@@ -0,0 +1,182 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "TagReadCache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+using namespace MUSIC_INFO;
+
+namespace
+{
+constexpr int64_t BLOCK_LENGTH = static_cast<int64_t>(CTagReadCache::BLOCK_SIZE);
+constexpr int64_t WINDOW_BLOCKS = static_cast<int64_t>(CTagReadCache::WINDOW_SIZE) / BLOCK_LENGTH;
+
+// reads missing more blocks than this bypass the cache
+constexpr int64_t MAX_CACHED_READ_BLOCKS = static_cast<int64_t>(CTagReadCache::MAX_BLOCKS) / 2;
+} // unnamed namespace
+
+CTagReadCache::CTagReadCache(Reader reader, int64_t length)
+  : m_reader(std::move(reader)),
+    m_length(std::max<int64_t>(length, 0)),
+    m_blockCount((m_length + BLOCK_LENGTH - 1) / BLOCK_LENGTH)
+{
+  m_headEnd = std::min(WINDOW_BLOCKS, m_blockCount);
+  m_tailBegin = std::max<int64_t>(m_blockCount - WINDOW_BLOCKS, 0);
+}
+
+size_t CTagReadCache::Read(int64_t offset, uint8_t* buffer, size_t size)
+{
+  if (offset < 0 || offset >= m_length || size == 0)
+    return 0;
+
+  size = static_cast<size_t>(std::min<int64_t>(static_cast<int64_t>(size), m_length - offset));
+
+  size_t done = 0;
+  while (done < size)
+  {
+    const int64_t position = offset + static_cast<int64_t>(done);
+    const int64_t index = position / BLOCK_LENGTH;
+
+    const Block* block = Find(index);
+    if (!block)
+    {
+      // missing blocks up to the end of the request are fetched together
+      const int64_t last = (offset + static_cast<int64_t>(size) - 1) / BLOCK_LENGTH;
+      int64_t end = index + 1;
+      while (end <= last && !Contains(end))
+        ++end;
+
+      if (end - index > MAX_CACHED_READ_BLOCKS)
+      {
+        const int64_t directEnd = std::min(offset + static_cast<int64_t>(size), end * BLOCK_LENGTH);
+        const size_t wanted = static_cast<size_t>(directEnd - position);
+        const size_t read = ReadSource(position, buffer + done, wanted);
+        done += read;
+        if (read < wanted)
+          break;
+        continue;
+      }
+
+      // a window is always fetched as a whole
+      int64_t first = index;
+      if (index < m_headEnd || index >= m_tailBegin)
+      {
+        const int64_t windowBegin = index < m_headEnd ? 0 : m_tailBegin;
+        const int64_t windowEnd = index < m_headEnd ? m_headEnd : m_blockCount;
+        while (first > windowBegin && !Contains(first - 1))
+          --first;
+        while (end < windowEnd && !Contains(end))
+          ++end;
+      }
+
+      if (!Load(first, end))
+        break;
+
+      block = Find(index);
+      if (!block)
+        break;
+    }
+
+    const size_t blockOffset = static_cast<size_t>(position - index * BLOCK_LENGTH);
+    if (blockOffset >= block->data.size())
+      break; // short block, the file ended early
+
+    const size_t count = std::min(block->data.size() - blockOffset, size - done);
+    std::memcpy(buffer + done, block->data.data() + blockOffset, count);
+    done += count;
+  }
+  return done;
+}
+
+void CTagReadCache::PrefetchTail()
+{
+  int64_t first = m_tailBegin;
+  while (first < m_blockCount && Contains(first))
+    ++first;
+
+  if (first < m_blockCount)
+    Load(first, m_blockCount);
+}
+
+bool CTagReadCache::IsPinned(int64_t index) const
+{
+  return index < m_headEnd || index >= m_tailBegin;
+}
+
+bool CTagReadCache::Contains(int64_t index) const
+{
+  return std::any_of(m_blocks.begin(), m_blocks.end(),
+                     [index](const Block& block) { return block.index == index; });
+}
+
+const CTagReadCache::Block* CTagReadCache::Find(int64_t index)
+{
+  for (auto it = m_blocks.begin(); it != m_blocks.end(); ++it)
+  {
+    if (it->index != index)
+      continue;
+
+    m_blocks.splice(m_blocks.begin(), m_blocks, it);
+    return &m_blocks.front();
+  }
+  return nullptr;
+}
+
+bool CTagReadCache::Load(int64_t first, int64_t end)
+{
+  const int64_t begin = first * BLOCK_LENGTH;
+  const size_t size = static_cast<size_t>(std::min(end * BLOCK_LENGTH, m_length) - begin);
+
+  std::vector<uint8_t> data(size);
+  const size_t read = ReadSource(begin, data.data(), size);
+  if (read == 0)
+    return false;
+
+  for (int64_t index = first; index < end; ++index)
+  {
+    const size_t blockBegin = static_cast<size_t>((index - first) * BLOCK_LENGTH);
+    if (blockBegin >= read)
+      break;
+
+    const size_t blockEnd = std::min(blockBegin + BLOCK_SIZE, read);
+    m_blocks.push_front({index, std::vector<uint8_t>(data.begin() + blockBegin,
+                                                     data.begin() + blockEnd)});
+  }
+
+  // drop the least recently used blocks outside of the windows
+  size_t unpinned = std::count_if(m_blocks.begin(), m_blocks.end(),
+                                  [this](const Block& block) { return !IsPinned(block.index); });
+  for (auto it = m_blocks.end(); unpinned > MAX_BLOCKS && it != m_blocks.begin();)
+  {
+    --it;
+    if (IsPinned(it->index))
+      continue;
+
+    it = m_blocks.erase(it);
+    --unpinned;
+  }
+  return true;
+}
+
+size_t CTagReadCache::ReadSource(int64_t offset, uint8_t* buffer, size_t size)
+{
+  // network file systems may return less than requested, read until done
+  size_t done = 0;
+  while (done < size)
+  {
+    m_sourceReads++;
+    const ssize_t read = m_reader(offset + static_cast<int64_t>(done), buffer + done, size - done);
+    if (read <= 0)
+      break;
+    done += static_cast<size_t>(read);
+  }
+  return done;
+}
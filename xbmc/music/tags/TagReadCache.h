@@ -0,0 +1,86 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "PlatformDefs.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <vector>
+
+namespace MUSIC_INFO
+{
+
+/*!
+ \brief Block cache for reading tags from files with a high access latency.
+
+ Tag parsers issue many small reads and seeks, mostly near the start and the end of a file. The
+ cache reads whole blocks, fetching consecutive missing blocks with a single read of the
+ underlying file. The head and the tail window of the file are always fetched as a whole and kept,
+ other blocks are kept in least recently used order. Reads spanning many blocks, like embedded
+ artwork, go to the file directly so they don't push the windows and the recent blocks out.
+ */
+class CTagReadCache
+{
+public:
+  /*!
+   \brief Read from the underlying file
+   \return number of bytes read, may be short, 0 at the end of the file or -1 on error
+   */
+  using Reader = std::function<ssize_t(int64_t offset, uint8_t* buffer, size_t size)>;
+
+  static constexpr size_t BLOCK_SIZE = 16 * 1024;
+  static constexpr size_t WINDOW_SIZE = 64 * 1024;
+  static constexpr size_t MAX_BLOCKS = 16;
+
+  CTagReadCache(Reader reader, int64_t length);
+
+  /*!
+   \brief Read from the cache, fetching missing blocks
+   \return number of bytes read, short at the end of the file or on error
+   */
+  size_t Read(int64_t offset, uint8_t* buffer, size_t size);
+
+  /*!
+   \brief Fetch the tail window ahead of parsing, for formats with tags at the end of the file
+   */
+  void PrefetchTail();
+
+  int64_t GetLength() const { return m_length; }
+
+  /*!
+   \brief Number of reads issued to the underlying file
+   */
+  unsigned int GetSourceReads() const { return m_sourceReads; }
+
+private:
+  struct Block
+  {
+    int64_t index;
+    std::vector<uint8_t> data;
+  };
+
+  bool IsPinned(int64_t index) const;
+  bool Contains(int64_t index) const;
+  const Block* Find(int64_t index);
+  bool Load(int64_t first, int64_t end);
+  size_t ReadSource(int64_t offset, uint8_t* buffer, size_t size);
+
+  Reader m_reader;
+  int64_t m_length;
+  int64_t m_headEnd; // first block after the head window
+  int64_t m_tailBegin; // first block of the tail window
+  int64_t m_blockCount;
+  std::list<Block> m_blocks; // most recently used first
+  unsigned int m_sourceReads = 0;
+};
+
+} // namespace MUSIC_INFO
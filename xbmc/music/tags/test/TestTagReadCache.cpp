@@ -0,0 +1,176 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "music/tags/TagReadCache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace MUSIC_INFO;
+
+namespace
+{
+/*!
+ * File served in small pieces like a slow network share, counting the round trips
+ */
+class CThrottledSource
+{
+public:
+  CThrottledSource(size_t length, size_t maxRead) : m_data(length), m_maxRead(maxRead)
+  {
+    for (size_t i = 0; i < length; ++i)
+      m_data[i] = static_cast<uint8_t>(i * 31 + i / 251);
+  }
+
+  CTagReadCache::Reader GetReader()
+  {
+    return [this](int64_t offset, uint8_t* buffer, size_t size) -> ssize_t
+    {
+      m_reads++;
+      if (offset < 0 || static_cast<size_t>(offset) >= m_data.size())
+        return 0;
+      const size_t count =
+          std::min({size, m_maxRead, m_data.size() - static_cast<size_t>(offset)});
+      std::memcpy(buffer, m_data.data() + offset, count);
+      return static_cast<ssize_t>(count);
+    };
+  }
+
+  bool Matches(int64_t offset, const uint8_t* buffer, size_t size) const
+  {
+    return std::memcmp(m_data.data() + offset, buffer, size) == 0;
+  }
+
+  int64_t GetLength() const { return static_cast<int64_t>(m_data.size()); }
+
+  unsigned int m_reads = 0;
+
+private:
+  std::vector<uint8_t> m_data;
+  size_t m_maxRead;
+};
+
+constexpr size_t FILE_SIZE = 4 * 1024 * 1024;
+} // unnamed namespace
+
+TEST(TestTagReadCache, SmallReadsInHead)
+{
+  CThrottledSource source(FILE_SIZE, FILE_SIZE);
+  CTagReadCache cache(source.GetReader(), source.GetLength());
+
+  // an ID3v2 parser reading the header and frame after frame
+  uint8_t buffer[64];
+  for (int64_t offset = 0; offset < 60000; offset += 37)
+  {
+    ASSERT_EQ(sizeof(buffer), cache.Read(offset, buffer, sizeof(buffer)));
+    ASSERT_TRUE(source.Matches(offset, buffer, sizeof(buffer)));
+  }
+
+  // the head window is fetched at once
+  EXPECT_EQ(1u, source.m_reads);
+  EXPECT_EQ(source.m_reads, cache.GetSourceReads());
+}
+
+TEST(TestTagReadCache, PrefetchTail)
+{
+  CThrottledSource source(FILE_SIZE, FILE_SIZE);
+  CTagReadCache cache(source.GetReader(), source.GetLength());
+  cache.PrefetchTail();
+  EXPECT_EQ(1u, source.m_reads);
+
+  // ID3v1, APE footer and Lyrics3 lookups near the end
+  uint8_t buffer[128];
+  const int64_t length = source.GetLength();
+  for (int64_t offset : {length - 128, length - 160, length - 32, length - 15 - 128, length - 9000})
+  {
+    ASSERT_EQ(sizeof(buffer) > static_cast<size_t>(length - offset)
+                  ? static_cast<size_t>(length - offset)
+                  : sizeof(buffer),
+              cache.Read(offset, buffer, sizeof(buffer)));
+    ASSERT_TRUE(source.Matches(offset, buffer, std::min<size_t>(sizeof(buffer), length - offset)));
+  }
+  EXPECT_EQ(1u, source.m_reads);
+}
+
+TEST(TestTagReadCache, ShortReads)
+{
+  // a share returning at most 4 KiB per read
+  CThrottledSource source(FILE_SIZE, 4096);
+  CTagReadCache cache(source.GetReader(), source.GetLength());
+
+  std::vector<uint8_t> buffer(1000);
+  EXPECT_EQ(buffer.size(), cache.Read(100, buffer.data(), buffer.size()));
+  EXPECT_TRUE(source.Matches(100, buffer.data(), buffer.size()));
+  EXPECT_EQ(CTagReadCache::WINDOW_SIZE / 4096, source.m_reads);
+}
+
+TEST(TestTagReadCache, LargeReadBypassesCache)
+{
+  CThrottledSource source(FILE_SIZE, FILE_SIZE);
+  CTagReadCache cache(source.GetReader(), source.GetLength());
+
+  uint8_t small[16];
+  cache.Read(0, small, sizeof(small));
+  EXPECT_EQ(1u, source.m_reads);
+
+  // embedded artwork
+  std::vector<uint8_t> art(1024 * 1024);
+  const int64_t offset = 100000;
+  EXPECT_EQ(art.size(), cache.Read(offset, art.data(), art.size()));
+  EXPECT_TRUE(source.Matches(offset, art.data(), art.size()));
+  EXPECT_EQ(2u, source.m_reads);
+
+  // the head is still cached
+  cache.Read(10, small, sizeof(small));
+  EXPECT_TRUE(source.Matches(10, small, sizeof(small)));
+  EXPECT_EQ(2u, source.m_reads);
+}
+
+TEST(TestTagReadCache, LeastRecentlyUsedBlocks)
+{
+  CThrottledSource source(FILE_SIZE, FILE_SIZE);
+  CTagReadCache cache(source.GetReader(), source.GetLength());
+
+  // MP4 atom headers spread over the file, one block each
+  const int64_t stride = 3 * CTagReadCache::BLOCK_SIZE;
+  const int64_t first = 2 * CTagReadCache::WINDOW_SIZE;
+  uint8_t header[8];
+  for (size_t i = 0; i < CTagReadCache::MAX_BLOCKS; ++i)
+    cache.Read(first + i * stride, header, sizeof(header));
+  EXPECT_EQ(CTagReadCache::MAX_BLOCKS, source.m_reads);
+
+  // revisiting is free while the blocks fit
+  for (size_t i = 0; i < CTagReadCache::MAX_BLOCKS; ++i)
+  {
+    cache.Read(first + i * stride, header, sizeof(header));
+    EXPECT_TRUE(source.Matches(first + i * stride, header, sizeof(header)));
+  }
+  EXPECT_EQ(CTagReadCache::MAX_BLOCKS, source.m_reads);
+
+  // one more block drops the least recently used one
+  cache.Read(first + CTagReadCache::MAX_BLOCKS * stride, header, sizeof(header));
+  cache.Read(first, header, sizeof(header));
+  EXPECT_EQ(CTagReadCache::MAX_BLOCKS + 2, source.m_reads);
+  cache.Read(first + (CTagReadCache::MAX_BLOCKS - 1) * stride, header, sizeof(header));
+  EXPECT_EQ(CTagReadCache::MAX_BLOCKS + 2, source.m_reads);
+}
+
+TEST(TestTagReadCache, EndOfFile)
+{
+  CThrottledSource source(1000, 1000);
+  CTagReadCache cache(source.GetReader(), source.GetLength());
+
+  uint8_t buffer[64];
+  EXPECT_EQ(40u, cache.Read(960, buffer, sizeof(buffer)));
+  EXPECT_TRUE(source.Matches(960, buffer, 40));
+  EXPECT_EQ(0u, cache.Read(1000, buffer, sizeof(buffer)));
+  EXPECT_EQ(0u, cache.Read(-5, buffer, sizeof(buffer)));
+}
@@ -0,0 +1,220 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "EventRing.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <ctime>
+#include <new>
+
+#include <unistd.h>
+
+using namespace EVENTSERVER;
+
+namespace
+{
+constexpr size_t Align(size_t size)
+{
+  return (size + RING_ALIGNMENT - 1) & ~(RING_ALIGNMENT - 1);
+}
+
+void Write(uint8_t* data, uint32_t capacity, uint64_t pos, const uint8_t* src, size_t size)
+{
+  const size_t offset = pos & (capacity - 1);
+  const size_t first = std::min<size_t>(size, capacity - offset);
+  std::memcpy(data + offset, src, first);
+  std::memcpy(data, src + first, size - first);
+}
+
+void Read(const uint8_t* data, uint32_t capacity, uint64_t pos, uint8_t* dst, size_t size)
+{
+  const size_t offset = pos & (capacity - 1);
+  const size_t first = std::min<size_t>(size, capacity - offset);
+  std::memcpy(dst, data + offset, first);
+  std::memcpy(dst + first, data, size - first);
+}
+} // unnamed namespace
+
+size_t CEventRing::GetRingSize(uint32_t ringCapacity)
+{
+  return Align(sizeof(EventRing)) + Align(ringCapacity);
+}
+
+size_t CEventRing::GetSegmentSize(uint32_t ringCount, uint32_t ringCapacity)
+{
+  return Align(sizeof(EventRingSegment)) + ringCount * GetRingSize(ringCapacity);
+}
+
+uint8_t* CEventRing::GetData(EventRing* ring)
+{
+  return reinterpret_cast<uint8_t*>(ring) + Align(sizeof(EventRing));
+}
+
+bool CEventRing::IsStale(const void* memory, size_t size)
+{
+  if (size < sizeof(EventRingSegment))
+    return false;
+
+  const EventRingSegment* segment = static_cast<const EventRingSegment*>(memory);
+  return std::memcmp(segment->magic, EventRingSegment::MAGIC, sizeof(segment->magic)) == 0 &&
+         segment->version == EventRingSegment::VERSION && segment->serverPid > 0 &&
+         kill(segment->serverPid, 0) != 0 && errno == ESRCH;
+}
+
+EventRing* CEventRing::GetRing(uint32_t index) const
+{
+  if (index >= m_ringCount)
+    return nullptr;
+
+  uint8_t* rings = reinterpret_cast<uint8_t*>(m_segment) + Align(sizeof(EventRingSegment));
+  return reinterpret_cast<EventRing*>(rings + index * GetRingSize(m_ringCapacity));
+}
+
+bool CEventRing::Create(void* memory, uint32_t ringCount, uint32_t ringCapacity)
+{
+  // power of two capacity, large enough to hold at least a couple of full packets
+  if (ringCount == 0 || ringCapacity < 4096 || (ringCapacity & (ringCapacity - 1)) != 0)
+    return false;
+
+  EventRingSegment* segment = new (memory) EventRingSegment;
+  std::memcpy(segment->magic, EventRingSegment::MAGIC, sizeof(segment->magic));
+  segment->version = EventRingSegment::VERSION;
+  segment->ringCount = ringCount;
+  segment->ringCapacity = ringCapacity;
+  segment->serverPid = getpid();
+  if (sem_init(&segment->wakeup, 1, 0) != 0)
+  {
+    segment->~EventRingSegment();
+    return false;
+  }
+
+  m_segment = segment;
+  m_ringCount = ringCount;
+  m_ringCapacity = ringCapacity;
+
+  for (uint32_t i = 0; i < ringCount; ++i)
+  {
+    EventRing* ring = new (GetRing(i)) EventRing;
+    ring->owner = 0;
+    ring->head = 0;
+    ring->tail = 0;
+  }
+
+  return true;
+}
+
+bool CEventRing::Attach(void* memory, size_t size)
+{
+  if (size < sizeof(EventRingSegment))
+    return false;
+
+  EventRingSegment* segment = static_cast<EventRingSegment*>(memory);
+  const uint32_t ringCount = segment->ringCount;
+  const uint32_t ringCapacity = segment->ringCapacity;
+  if (std::memcmp(segment->magic, EventRingSegment::MAGIC, sizeof(segment->magic)) != 0 ||
+      segment->version != EventRingSegment::VERSION || ringCapacity == 0 ||
+      (ringCapacity & (ringCapacity - 1)) != 0 ||
+      GetSegmentSize(ringCount, ringCapacity) > size)
+    return false;
+
+  m_segment = segment;
+  m_ringCount = ringCount;
+  m_ringCapacity = ringCapacity;
+  return true;
+}
+
+void CEventRing::Destroy()
+{
+  if (!m_segment)
+    return;
+
+  for (uint32_t i = 0; i < m_ringCount; ++i)
+    GetRing(i)->~EventRing();
+
+  sem_destroy(&m_segment->wakeup);
+  m_segment->~EventRingSegment();
+  m_segment = nullptr;
+  m_ringCount = 0;
+  m_ringCapacity = 0;
+}
+
+bool CEventRing::Push(EventRing* ring, const uint8_t* data, uint16_t size) const
+{
+  const uint32_t capacity = m_ringCapacity;
+  const uint64_t head = ring->head.load(std::memory_order_relaxed);
+  const uint64_t tail = ring->tail.load(std::memory_order_acquire);
+  if (capacity - (head - tail) < RECORD_HEADER_SIZE + size)
+    return false;
+
+  Write(GetData(ring), capacity, head, reinterpret_cast<const uint8_t*>(&size),
+        RECORD_HEADER_SIZE);
+  Write(GetData(ring), capacity, head + RECORD_HEADER_SIZE, data, size);
+  ring->head.store(head + RECORD_HEADER_SIZE + size, std::memory_order_release);
+  return true;
+}
+
+int CEventRing::Pop(EventRing* ring, uint8_t* buffer, size_t bufferSize) const
+{
+  const uint32_t capacity = m_ringCapacity;
+  const uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+  const uint64_t head = ring->head.load(std::memory_order_acquire);
+  if (head == tail)
+    return 0;
+
+  if (head - tail < RECORD_HEADER_SIZE || head - tail > capacity)
+    return -1;
+
+  uint16_t size;
+  Read(GetData(ring), capacity, tail, reinterpret_cast<uint8_t*>(&size), RECORD_HEADER_SIZE);
+  if (head - tail < RECORD_HEADER_SIZE + size || size > bufferSize)
+    return -1;
+
+  Read(GetData(ring), capacity, tail + RECORD_HEADER_SIZE, buffer, size);
+  ring->tail.store(tail + RECORD_HEADER_SIZE + size, std::memory_order_release);
+  return size;
+}
+
+void CEventRing::Reset(EventRing* ring)
+{
+  ring->tail.store(ring->head.load(std::memory_order_acquire), std::memory_order_release);
+  ring->owner = 0;
+}
+
+void CEventRing::Notify() const
+{
+  sem_post(&m_segment->wakeup);
+}
+
+bool CEventRing::Wait(unsigned int timeoutMs) const
+{
+  timespec ts;
+  clock_gettime(CLOCK_REALTIME, &ts);
+  ts.tv_sec += timeoutMs / 1000;
+  ts.tv_nsec += (timeoutMs % 1000) * 1000000L;
+  if (ts.tv_nsec >= 1000000000L)
+  {
+    ts.tv_sec++;
+    ts.tv_nsec -= 1000000000L;
+  }
+
+  int ret;
+  while ((ret = sem_timedwait(&m_segment->wakeup, &ts)) != 0 && errno == EINTR)
+    ;
+
+  if (ret != 0)
+    return false;
+
+  // coalesce the wakeups of all batches pushed meanwhile, one drain handles them all
+  while (sem_trywait(&m_segment->wakeup) == 0)
+    ;
+
+  return true;
+}
@@ -0,0 +1,158 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <semaphore.h>
+
+namespace EVENTSERVER
+{
+
+/************************************************************************/
+/*                                                                      */
+/* Shared memory segment used by local event clients instead of UDP.    */
+/*                                                                      */
+/* - the segment starts with EventRingSegment, followed by ringCount    */
+/*   single producer / single consumer rings of RING_ALIGNMENT aligned  */
+/*   EventRing headers plus ringCapacity data bytes each                */
+/* - a client claims a ring by swapping its pid into owner (0 = free)   */
+/* - serverPid identifies the server, a segment whose server process is */
+/*   gone is left over from a crash and may be replaced                 */
+/* - every record is a 2 byte (host order) length followed by one       */
+/*   complete event packet in the regular UDP wire format               */
+/* - the producer owns head, the consumer owns tail, both only ever     */
+/*   grow, positions are taken modulo ringCapacity                      */
+/* - producers post the segment semaphore once per batch of records,    */
+/*   the consumer drains every ring on each wakeup                      */
+/*                                                                      */
+/* The layout is mirrored in tools/EventClients/lib/c++/xbmcclient_shm.h */
+/* and must be kept in sync (bump VERSION on any change).               */
+/*                                                                      */
+/************************************************************************/
+
+constexpr size_t RING_ALIGNMENT = 64;
+
+struct EventRingSegment
+{
+  static constexpr char MAGIC[4] = {'X', 'B', 'E', 'R'};
+  static constexpr uint32_t VERSION = 2;
+
+  char magic[4];
+  uint32_t version;
+  uint32_t ringCount;
+  uint32_t ringCapacity;
+  int32_t serverPid;
+  sem_t wakeup;
+};
+
+struct EventRing
+{
+  std::atomic<int32_t> owner;
+  alignas(RING_ALIGNMENT) std::atomic<uint64_t> head;
+  alignas(RING_ALIGNMENT) std::atomic<uint64_t> tail;
+};
+
+/*!
+ * \brief Access to a segment of event rings
+ *
+ * The ring count and capacity are taken once by Create() or Attach() and kept in this object,
+ * they are never read from the shared memory again. A client overwriting them cannot make the
+ * server access memory outside of the segment.
+ */
+class CEventRing
+{
+public:
+  static constexpr size_t RECORD_HEADER_SIZE = sizeof(uint16_t);
+
+  /*!
+   * \brief Size of the shared memory needed for the given rings
+   */
+  static size_t GetSegmentSize(uint32_t ringCount, uint32_t ringCapacity);
+
+  /*!
+   * \brief Check whether the memory holds a segment of a server process that is gone
+   * \param memory the mapped memory
+   * \param size the size of the mapping
+   */
+  static bool IsStale(const void* memory, size_t size);
+
+  /*!
+   * \brief Initialize a new segment in the given memory, as done by the server
+   * \param memory the memory to use, at least GetSegmentSize() bytes, RING_ALIGNMENT aligned
+   * \param ringCount the number of rings (clients)
+   * \param ringCapacity the number of data bytes per ring, must be a power of two
+   * \return false if the parameters are invalid
+   */
+  bool Create(void* memory, uint32_t ringCount, uint32_t ringCapacity);
+
+  /*!
+   * \brief Validate and use an existing segment, as done by a client
+   * \param memory the mapped memory
+   * \param size the size of the mapping
+   * \return false if the memory does not hold a compatible segment
+   */
+  bool Attach(void* memory, size_t size);
+
+  /*!
+   * \brief Destroy a segment initialized with Create()
+   */
+  void Destroy();
+
+  EventRingSegment* GetSegment() const { return m_segment; }
+  uint32_t GetRingCount() const { return m_ringCount; }
+
+  /*!
+   * \brief Get the ring with the given index
+   */
+  EventRing* GetRing(uint32_t index) const;
+
+  /*!
+   * \brief Append a record (producer side), without waking up the consumer
+   * \return false if the record does not fit in the free space of the ring
+   */
+  bool Push(EventRing* ring, const uint8_t* data, uint16_t size) const;
+
+  /*!
+   * \brief Take the oldest record (consumer side)
+   * \param buffer receives the record
+   * \param bufferSize the size of buffer
+   * \return the size of the record, 0 if the ring is empty or -1 if the ring is corrupt
+   */
+  int Pop(EventRing* ring, uint8_t* buffer, size_t bufferSize) const;
+
+  /*!
+   * \brief Drop all pending records and release the producer slot (consumer side)
+   */
+  static void Reset(EventRing* ring);
+
+  /*!
+   * \brief Wake up the consumer after one or more records were pushed
+   */
+  void Notify() const;
+
+  /*!
+   * \brief Wait for a producer to notify new records
+   * \param timeoutMs the maximum time to wait
+   * \return true if notified, false on timeout
+   */
+  bool Wait(unsigned int timeoutMs) const;
+
+private:
+  static size_t GetRingSize(uint32_t ringCapacity);
+  static uint8_t* GetData(EventRing* ring);
+
+  EventRingSegment* m_segment = nullptr;
+  uint32_t m_ringCount = 0;
+  uint32_t m_ringCapacity = 0;
+};
+
+} // namespace EVENTSERVER
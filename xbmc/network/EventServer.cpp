@@ -22,6 +22,10 @@
 #include "utils/SystemInfo.h"
 #include "utils/log.h"
 
+#if defined(TARGET_LINUX)
+#include "EventServerLocal.h"
+#endif
+
 #include <cassert>
 #include <map>
 #include <mutex>
@@ -34,6 +38,12 @@ using namespace EVENTCLIENT;
 using namespace SOCKETS;
 using namespace std::chrono_literals;
 
+namespace
+{
+// client token for local clients that don't send one, combined with the ring index
+constexpr unsigned int LOCAL_CLIENT_TOKEN = 0xFFFFFF00;
+} // unnamed namespace
+
 /************************************************************************/
 /* CEventServer                                                         */
 /************************************************************************/
@@ -48,6 +58,8 @@ CEventServer::CEventServer() : CThread("EventServer")
   m_iListenTimeout = 1000;
 }
 
+CEventServer::~CEventServer() = default;
+
 void CEventServer::RemoveInstance()
 {
   m_pInstance.reset();
@@ -157,6 +169,13 @@ void CEventServer::Run()
   // add our socket to the 'select' listener
   listener.AddSocket(m_pSocket.get());
 
+#if defined(TARGET_LINUX)
+  // local clients bypass the socket and deliver packets through shared memory
+  m_localServer = std::make_unique<CEventServerLocal>(*this);
+  if (!m_localServer->Start())
+    m_localServer.reset();
+#endif
+
   m_bRunning = true;
 
   while (!m_bStop)
@@ -169,7 +188,7 @@ void CEventServer::Run()
         CAddress addr;
         if ((packetSize = m_pSocket->Read(addr, PACKET_SIZE, m_pPacketBuffer.data())) > -1)
         {
-          ProcessPacket(addr, packetSize);
+          ProcessPacket(addr, m_pPacketBuffer.data(), packetSize, addr.ULong());
         }
       }
     }
@@ -189,16 +208,28 @@ void CEventServer::Run()
     // BroadcastBeacon();
   }
 
+#if defined(TARGET_LINUX)
+  m_localServer.reset();
+#endif
+
   CLog::Log(LOGINFO, "ES: UDP Event server stopped");
   m_bRunning = false;
   Cleanup();
 }
 
-void CEventServer::ProcessPacket(CAddress& addr, int pSize)
+void CEventServer::ProcessLocalPacket(unsigned int ring, const uint8_t* data, int packetSize)
+{
+  CAddress addr("127.0.0.1");
+  ProcessPacket(addr, data, packetSize, LOCAL_CLIENT_TOKEN | ring);
+}
+
+void CEventServer::ProcessPacket(CAddress& addr,
+                                 const uint8_t* data,
+                                 int pSize,
+                                 unsigned int fallbackToken)
 {
   // check packet validity
-  std::unique_ptr<CEventPacket> packet =
-      std::make_unique<CEventPacket>(pSize, m_pPacketBuffer.data());
+  std::unique_ptr<CEventPacket> packet = std::make_unique<CEventPacket>(pSize, data);
   if (!packet)
   {
     CLog::Log(LOGERROR, "ES: Out of memory, cannot accept packet");
@@ -215,7 +246,7 @@ void CEventServer::ProcessPacket(CAddress& addr, int pSize)
 
   clientToken = packet->ClientToken();
   if (!clientToken)
-    clientToken = addr.ULong(); // use IP if packet doesn't have a token
+    clientToken = fallbackToken; // use IP (or ring) if packet doesn't have a token
 
   std::unique_lock lock(m_critSection);
 
@@ -21,6 +21,7 @@
 
 namespace EVENTSERVER
 {
+  class CEventServerLocal;
 
   /**********************************************************************/
   /* UDP Event Server Class                                             */
@@ -32,7 +33,7 @@ namespace EVENTSERVER
     static CEventServer* GetInstance();
 
     CEventServer();
-    ~CEventServer() override = default;
+    ~CEventServer() override;
 
     // IRunnable entry point for thread
     void  Process() override;
@@ -58,16 +59,25 @@ namespace EVENTSERVER
     bool GetMousePos(float &x, float &y);
     int GetNumberOfClients();
 
+    // process a packet received through the local (shared memory) transport
+    void ProcessLocalPacket(unsigned int ring, const uint8_t* data, int packetSize);
+    void ProcessEvents();
+
   protected:
     void Cleanup();
     void Run();
-    void ProcessPacket(SOCKETS::CAddress& addr, int packetSize);
-    void ProcessEvents();
+    void ProcessPacket(SOCKETS::CAddress& addr,
+                       const uint8_t* data,
+                       int packetSize,
+                       unsigned int fallbackToken);
     void RefreshClients();
 
     std::map<unsigned long, std::unique_ptr<EVENTCLIENT::CEventClient>> m_clients;
     static std::unique_ptr<CEventServer> m_pInstance;
     std::unique_ptr<SOCKETS::CUDPSocket> m_pSocket;
+#if defined(TARGET_LINUX)
+    std::unique_ptr<CEventServerLocal> m_localServer;
+#endif
     int              m_iPort;
     int              m_iListenTimeout;
     int              m_iMaxClients;
@@ -0,0 +1,186 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "EventServerLocal.h"
+
+#include "EventPacket.h"
+#include "EventRing.h"
+#include "EventServer.h"
+#include "utils/log.h"
+
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace EVENTSERVER;
+
+namespace
+{
+// wakeup interval to check for stop requests and dead clients
+constexpr unsigned int WAIT_TIMEOUT_MS = 500;
+} // unnamed namespace
+
+CEventServerLocal::CEventServerLocal(CEventServer& server)
+  : CThread("EventServerLocal"), m_server(server)
+{
+}
+
+CEventServerLocal::~CEventServerLocal()
+{
+  Stop();
+}
+
+bool CEventServerLocal::Start()
+{
+  if (m_rings.GetSegment())
+    return true;
+
+  // a previous instance may have crashed without cleaning up
+  int fd = shm_open(SEGMENT_NAME, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+  if (fd < 0 && errno == EEXIST && RemoveStaleSegment())
+    fd = shm_open(SEGMENT_NAME, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+  if (fd < 0)
+  {
+    // the segment of another running instance is left alone, UDP still works
+    CLog::Log(LOGERROR, "ES: Could not create shared memory segment {} ({})", SEGMENT_NAME,
+              strerror(errno));
+    return false;
+  }
+
+  m_size = CEventRing::GetSegmentSize(RING_COUNT, RING_CAPACITY);
+  if (ftruncate(fd, m_size) != 0)
+  {
+    CLog::Log(LOGERROR, "ES: Could not size shared memory segment {} ({})", SEGMENT_NAME,
+              strerror(errno));
+    close(fd);
+    shm_unlink(SEGMENT_NAME);
+    return false;
+  }
+
+  m_memory = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (m_memory == MAP_FAILED)
+  {
+    CLog::Log(LOGERROR, "ES: Could not map shared memory segment {} ({})", SEGMENT_NAME,
+              strerror(errno));
+    m_memory = nullptr;
+    shm_unlink(SEGMENT_NAME);
+    return false;
+  }
+
+  if (!m_rings.Create(m_memory, RING_COUNT, RING_CAPACITY))
+  {
+    CLog::Log(LOGERROR, "ES: Could not initialize shared memory segment {}", SEGMENT_NAME);
+    Close();
+    return false;
+  }
+
+  m_packetBuffer.resize(EVENTPACKET::PACKET_SIZE);
+
+  CLog::Log(LOGINFO, "ES: Starting local Event server on {} ({} clients)", SEGMENT_NAME,
+            RING_COUNT);
+  CThread::Create();
+  return true;
+}
+
+bool CEventServerLocal::RemoveStaleSegment()
+{
+  const int fd = shm_open(SEGMENT_NAME, O_RDONLY, 0);
+  if (fd < 0)
+    return errno == ENOENT;
+
+  struct stat st;
+  bool stale = false;
+  if (fstat(fd, &st) == 0 && st.st_size > 0)
+  {
+    void* memory = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (memory != MAP_FAILED)
+    {
+      stale = CEventRing::IsStale(memory, st.st_size);
+      munmap(memory, st.st_size);
+    }
+  }
+  close(fd);
+
+  if (!stale)
+    return false;
+
+  CLog::Log(LOGINFO, "ES: Removing shared memory segment {} left behind by a previous instance",
+            SEGMENT_NAME);
+  return shm_unlink(SEGMENT_NAME) == 0;
+}
+
+void CEventServerLocal::Stop()
+{
+  StopThread(true);
+  Close();
+}
+
+void CEventServerLocal::Close()
+{
+  m_rings.Destroy();
+
+  if (m_memory)
+  {
+    munmap(m_memory, m_size);
+    m_memory = nullptr;
+    shm_unlink(SEGMENT_NAME);
+  }
+}
+
+void CEventServerLocal::Process()
+{
+  while (!m_bStop)
+  {
+    m_rings.Wait(WAIT_TIMEOUT_MS);
+
+    // a single wakeup usually covers a whole batch of events, let the clients
+    // translate all of them before the input manager polls for button codes
+    if (DrainRings())
+      m_server.ProcessEvents();
+  }
+}
+
+bool CEventServerLocal::DrainRings()
+{
+  bool received = false;
+
+  for (uint32_t i = 0; i < RING_COUNT; ++i)
+  {
+    EventRing* ring = m_rings.GetRing(i);
+    const int32_t owner = ring->owner;
+    if (owner == 0)
+      continue;
+
+    int size;
+    while ((size = m_rings.Pop(ring, m_packetBuffer.data(), m_packetBuffer.size())) > 0)
+    {
+      m_server.ProcessLocalPacket(i, m_packetBuffer.data(), size);
+      received = true;
+    }
+
+    if (size < 0)
+    {
+      CLog::Log(LOGERROR, "ES: Dropping corrupt local event ring {} of process {}", i, owner);
+      CEventRing::Reset(ring);
+    }
+    else if (kill(owner, 0) != 0 && errno == ESRCH)
+    {
+      CLog::Log(LOGINFO, "ES: Local event client process {} is gone, releasing ring {}", owner,
+                i);
+      CEventRing::Reset(ring);
+    }
+  }
+
+  return received;
+}
@@ -0,0 +1,58 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "EventRing.h"
+#include "threads/Thread.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace EVENTSERVER
+{
+
+class CEventServer;
+
+/**********************************************************************/
+/* Shared memory transport for event clients on the same host         */
+/**********************************************************************/
+// - publishes a shared memory segment named SEGMENT_NAME holding
+//   RING_COUNT rings, each of them serving one attached client
+// - clients push regular event packets and wake us up once per batch,
+//   which avoids the socket round trip and per packet wakeups of UDP
+// - packets are handed to the event server exactly like UDP packets
+class CEventServerLocal : private CThread
+{
+public:
+  static constexpr const char* SEGMENT_NAME = "/kodi-eventserver";
+  static constexpr uint32_t RING_COUNT = 4;
+  static constexpr uint32_t RING_CAPACITY = 64 * 1024;
+
+  explicit CEventServerLocal(CEventServer& server);
+  ~CEventServerLocal() override;
+
+  bool Start();
+  void Stop();
+
+protected:
+  void Process() override;
+
+private:
+  void Close();
+  bool RemoveStaleSegment();
+  bool DrainRings();
+
+  CEventServer& m_server;
+  void* m_memory = nullptr;
+  size_t m_size = 0;
+  CEventRing m_rings;
+  std::vector<uint8_t> m_packetBuffer;
+};
+
+} // namespace EVENTSERVER
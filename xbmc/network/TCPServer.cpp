@@ -14,6 +14,7 @@
 #include "network/Network.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
+#include "utils/MessagePackVariantParser.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
 #include "websocket/WebSocketManager.h"
@@ -58,7 +59,14 @@ using namespace JSONRPC;
 namespace
 {
 constexpr size_t maxBufferLength = 64 * 1024;
+
+bool IsMessagePackRequest(char c)
+{
+  // a request is either a map or, for batch calls, an array
+  const auto marker = static_cast<uint8_t>(c);
+  return (marker >= 0x80 && marker <= 0x9F) || (marker >= 0xDC && marker <= 0xDF);
 }
+} // unnamed namespace
 
 CTCPServer *CTCPServer::ServerInstance = NULL;
 
@@ -240,16 +248,25 @@ void CTCPServer::Announce(ANNOUNCEMENT::AnnouncementFlag flag,
   if (m_connections.empty())
     return;
 
-  std::string str = IJSONRPCAnnouncer::AnnouncementToJSONRPC(flag, sender, message, data, CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_jsonOutputCompact);
+  const CVariant announcement =
+      IJSONRPCAnnouncer::AnnouncementToVariant(flag, sender, message, data);
+  std::string json, messagePack;
 
   for (unsigned int i = 0; i < m_connections.size(); i++)
   {
+    Encoding encoding;
     {
       std::unique_lock lock(m_connections[i]->m_critSection);
       if ((m_connections[i]->GetAnnouncementFlags() & flag) == 0)
         continue;
+      encoding = m_connections[i]->GetEncoding();
     }
 
+    // encode once per encoding in use
+    std::string& str = encoding == Encoding::MESSAGEPACK ? messagePack : json;
+    if (str.empty())
+      str = CJSONRPC::Write(announcement, encoding);
+
     m_connections[i]->Send(str.c_str(), str.size());
   }
 }
@@ -504,6 +521,7 @@ void CTCPServer::Deinitialize()
 CTCPServer::CTCPClient::CTCPClient()
 {
   m_new = true;
+  m_encoding = Encoding::JSON;
   m_announcementflags = ANNOUNCEMENT::ANNOUNCE_ALL;
   m_socket = INVALID_SOCKET;
   m_beginBrackets = 0;
@@ -554,6 +572,10 @@ void CTCPServer::CTCPClient::Send(const char *data, unsigned int size)
 void CTCPServer::CTCPClient::PushBuffer(CTCPServer *host, const char *buffer, int length)
 {
   m_new = false;
+
+  if (m_encoding == Encoding::MESSAGEPACK)
+    return PushMessagePack(host, buffer, length);
+
   bool inObject = false;
   bool inString = false;
   bool escapeNext = false;
@@ -562,6 +584,16 @@ void CTCPServer::CTCPClient::PushBuffer(CTCPServer *host, const char *buffer, in
   {
     char c = buffer[i];
 
+    if (m_beginChar == 0 && IsMessagePackRequest(c))
+    {
+      // the client talks MessagePack, stick to it for the rest of the connection
+      {
+        std::unique_lock lock(m_critSection);
+        m_encoding = Encoding::MESSAGEPACK;
+      }
+      return PushMessagePack(host, buffer + i, length - i);
+    }
+
     if (m_beginChar == 0 && c == '{')
     {
       m_beginChar = '{';
@@ -623,6 +655,50 @@ void CTCPServer::CTCPClient::PushBuffer(CTCPServer *host, const char *buffer, in
   }
 }
 
+void CTCPServer::CTCPClient::PushMessagePack(CTCPServer* host, const char* buffer, int length)
+{
+  if (m_buffer.size() + length > maxBufferLength)
+  {
+    CLog::Log(LOGINFO, "JSONRPC Server: client buffer size {} exceeded", maxBufferLength);
+    m_buffer.clear();
+    return;
+  }
+
+  m_buffer.append(buffer, length);
+
+  // MessagePack values carry their own length, every complete one is a request
+  size_t offset = 0;
+  while (offset < m_buffer.size())
+  {
+    CVariant request;
+    size_t requestLength = 0;
+    CMessagePackVariantParser::Result result = CMessagePackVariantParser::Parse(
+        m_buffer.data() + offset, m_buffer.size() - offset, request, requestLength);
+    if (result == CMessagePackVariantParser::Result::INCOMPLETE)
+      break;
+
+    std::string response;
+    if (result == CMessagePackVariantParser::Result::INVALID)
+    {
+      // there's no way to find the start of the next request, answer with a parse error and
+      // drop everything received so far
+      response = CJSONRPC::MethodCall(m_buffer.substr(offset), host, this, Encoding::MESSAGEPACK,
+                                      Encoding::MESSAGEPACK);
+      offset = m_buffer.size();
+    }
+    else
+    {
+      response = CJSONRPC::MethodCall(request, host, this, Encoding::MESSAGEPACK);
+      offset += requestLength;
+    }
+
+    if (!response.empty())
+      Send(response.c_str(), response.size());
+  }
+
+  m_buffer.erase(0, offset);
+}
+
 void CTCPServer::CTCPClient::Disconnect()
 {
   if (m_socket > 0)
@@ -637,6 +713,7 @@ void CTCPServer::CTCPClient::Disconnect()
 void CTCPServer::CTCPClient::Copy(const CTCPClient& client)
 {
   m_new               = client.m_new;
+  m_encoding          = client.m_encoding;
   m_socket            = client.m_socket;
   m_cliaddr           = client.m_cliaddr;
   m_addrlen           = client.m_addrlen;
@@ -686,7 +763,9 @@ CTCPServer::CWebSocketClient& CTCPServer::CWebSocketClient::operator=(const CWeb
 
 void CTCPServer::CWebSocketClient::Send(const char *data, unsigned int size)
 {
-  const CWebSocketMessage *msg = m_websocket->Send(WebSocketTextFrame, data, size);
+  const CWebSocketMessage* msg = m_websocket->Send(
+      GetEncoding() == Encoding::MESSAGEPACK ? WebSocketBinaryFrame : WebSocketTextFrame, data,
+      size);
   if (msg == NULL || !msg->IsComplete())
     return;
 
@@ -11,6 +11,7 @@
 #include "interfaces/json-rpc/IClient.h"
 #include "interfaces/json-rpc/IJSONRPCAnnouncer.h"
 #include "interfaces/json-rpc/ITransportLayer.h"
+#include "interfaces/json-rpc/JSONRPCUtils.h"
 #include "threads/CriticalSection.h"
 #include "threads/Thread.h"
 #include "websocket/WebSocket.h"
@@ -71,6 +72,11 @@ namespace JSONRPC
       virtual bool IsNew() const { return m_new; }
       virtual bool Closing() const { return false; }
 
+      /*!
+       \brief Encoding the client uses, detected from its first request
+       */
+      Encoding GetEncoding() const { return m_encoding; }
+
       SOCKET m_socket;
       sockaddr_storage m_cliaddr;
       socklen_t m_addrlen;
@@ -79,7 +85,10 @@ namespace JSONRPC
     protected:
       void Copy(const CTCPClient& client);
     private:
+      void PushMessagePack(CTCPServer* host, const char* buffer, int length);
+
       bool m_new;
+      Encoding m_encoding;
       int m_announcementflags;
       int m_beginBrackets, m_endBrackets;
       char m_beginChar, m_endChar;
@@ -20,6 +20,14 @@
 
 #define MAX_HTTP_POST_SIZE 65536
 
+namespace
+{
+bool IsMessagePackContentType(const std::string& contentType)
+{
+  return contentType == "application/msgpack" || contentType == "application/x-msgpack";
+}
+} // unnamed namespace
+
 bool CHTTPJsonRpcHandler::CanHandleRequest(const HTTPRequest &request) const
 {
   return (request.pathUrl.compare("/jsonrpc") == 0);
@@ -30,6 +38,7 @@ MHD_RESULT CHTTPJsonRpcHandler::HandleRequest()
   CHTTPClient client(m_request.method);
   bool isRequest = false;
   std::string jsonpCallback;
+  JSONRPC::Encoding requestEncoding = JSONRPC::Encoding::JSON;
 
   // get all query arguments
   std::map<std::string, std::string> arguments;
@@ -40,8 +49,12 @@ MHD_RESULT CHTTPJsonRpcHandler::HandleRequest()
     std::string contentType = HTTPRequestHandlerUtils::GetRequestHeaderValue(m_request.connection, MHD_HEADER_KIND, MHD_HTTP_HEADER_CONTENT_TYPE);
     // If the content-type of the m_request was specified, it must be application/json-rpc, application/json, or application/jsonrequest
     // http://www.jsonrpc.org/historical/json-rpc-over-http.html
-    if (!contentType.empty() && contentType.compare("application/json-rpc") != 0 &&
-        contentType.compare("application/json") != 0 && contentType.compare("application/jsonrequest") != 0)
+    // or application/msgpack for the same request encoded as MessagePack
+    if (IsMessagePackContentType(contentType))
+      requestEncoding = JSONRPC::Encoding::MESSAGEPACK;
+    else if (!contentType.empty() && contentType.compare("application/json-rpc") != 0 &&
+             contentType.compare("application/json") != 0 &&
+             contentType.compare("application/jsonrequest") != 0)
     {
       m_response.type = HTTPError;
       m_response.status = MHD_HTTP_UNSUPPORTED_MEDIA_TYPE;
@@ -70,9 +83,20 @@ MHD_RESULT CHTTPJsonRpcHandler::HandleRequest()
       jsonpCallback = argument->second;
   }
 
+  // MessagePack requests are answered in MessagePack, JSON ones if the client accepts it
+  JSONRPC::Encoding responseEncoding = requestEncoding;
+  const std::string accept = HTTPRequestHandlerUtils::GetRequestHeaderValue(
+      m_request.connection, MHD_HEADER_KIND, MHD_HTTP_HEADER_ACCEPT);
+  if (accept.find("application/msgpack") != std::string::npos ||
+      accept.find("application/x-msgpack") != std::string::npos)
+    responseEncoding = JSONRPC::Encoding::MESSAGEPACK;
+  if (!jsonpCallback.empty())
+    responseEncoding = JSONRPC::Encoding::JSON;
+
   if (isRequest)
   {
-    m_responseData = JSONRPC::CJSONRPC::MethodCall(m_requestData, &m_transportLayer, &client);
+    m_responseData = JSONRPC::CJSONRPC::MethodCall(m_requestData, &m_transportLayer, &client,
+                                                   requestEncoding, responseEncoding);
 
     if (!jsonpCallback.empty())
       m_responseData = jsonpCallback + "(" + m_responseData + ");";
@@ -82,7 +106,9 @@ MHD_RESULT CHTTPJsonRpcHandler::HandleRequest()
     // get the whole output of JSONRPC.Introspect
     CVariant result;
     JSONRPC::CJSONServiceDescription::Print(result, &m_transportLayer, &client);
-    if (!CJSONVariantWriter::Write(result, m_responseData, false))
+    if (responseEncoding == JSONRPC::Encoding::MESSAGEPACK)
+      m_responseData = JSONRPC::CJSONRPC::Write(result, responseEncoding);
+    else if (!CJSONVariantWriter::Write(result, m_responseData, false))
     {
       m_response.type = HTTPError;
       m_response.status = MHD_HTTP_INTERNAL_SERVER_ERROR;
@@ -104,7 +130,8 @@ MHD_RESULT CHTTPJsonRpcHandler::HandleRequest()
 
   m_response.type = HTTPMemoryDownloadNoFreeCopy;
   m_response.status = MHD_HTTP_OK;
-  m_response.contentType = "application/json";
+  m_response.contentType =
+      responseEncoding == JSONRPC::Encoding::MESSAGEPACK ? "application/msgpack" : "application/json";
   m_response.totalLength = m_responseData.size();
 
   return MHD_YES;
@@ -311,6 +311,14 @@ const char* CHTTPPythonWsgiInvoker::getInitializationScript() const
   return RUNSCRIPT;
 }
 
+std::vector<std::string> CHTTPPythonWsgiInvoker::getModules() const
+{
+  std::vector<std::string> modules;
+  for (const _inittab* module = PythonModules; module->name != nullptr; ++module)
+    modules.emplace_back(module->name);
+  return modules;
+}
+
 std::map<std::string, std::string> CHTTPPythonWsgiInvoker::createCgiEnvironment(
     const HTTPPythonRequest* httpRequest, const ADDON::AddonPtr& addon)
 {
@@ -38,6 +38,7 @@ protected:
   // overrides of CPythonInvoker
   void executeScript(FILE* fp, const std::string& script, PyObject* moduleDict) override;
   const char* getInitializationScript() const override;
+  std::vector<std::string> getModules() const override;
 
 private:
   static std::map<std::string, std::string> createCgiEnvironment(
@@ -0,0 +1,193 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "network/EventRing.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+using namespace EVENTSERVER;
+
+namespace
+{
+constexpr uint32_t RING_COUNT = 2;
+constexpr uint32_t RING_CAPACITY = 4096;
+
+class TestEventRing : public testing::Test
+{
+protected:
+  TestEventRing()
+  {
+    m_memory = std::aligned_alloc(RING_ALIGNMENT,
+                                  CEventRing::GetSegmentSize(RING_COUNT, RING_CAPACITY));
+    m_created = m_rings.Create(m_memory, RING_COUNT, RING_CAPACITY);
+  }
+
+  ~TestEventRing() override
+  {
+    m_rings.Destroy();
+    std::free(m_memory);
+  }
+
+  void* m_memory;
+  CEventRing m_rings;
+  bool m_created;
+};
+} // unnamed namespace
+
+TEST_F(TestEventRing, Create)
+{
+  ASSERT_TRUE(m_created);
+  CEventRing client;
+  EXPECT_TRUE(client.Attach(m_memory, CEventRing::GetSegmentSize(RING_COUNT, RING_CAPACITY)));
+  EXPECT_EQ(m_rings.GetRing(1), client.GetRing(1));
+  EXPECT_FALSE(CEventRing().Attach(m_memory, sizeof(EventRingSegment)));
+  EXPECT_NE(nullptr, m_rings.GetRing(RING_COUNT - 1));
+  EXPECT_EQ(nullptr, m_rings.GetRing(RING_COUNT));
+
+  std::vector<uint8_t> memory(CEventRing::GetSegmentSize(1, 1000));
+  EXPECT_FALSE(CEventRing().Create(memory.data(), 1, 1000));
+}
+
+TEST_F(TestEventRing, PushPop)
+{
+  ASSERT_TRUE(m_created);
+  EventRing* ring = m_rings.GetRing(0);
+  std::vector<uint8_t> buffer(1024);
+
+  EXPECT_EQ(0, m_rings.Pop(ring, buffer.data(), buffer.size()));
+
+  const uint8_t first[] = {1, 2, 3};
+  const uint8_t second[] = {4, 5};
+  EXPECT_TRUE(m_rings.Push(ring, first, sizeof(first)));
+  EXPECT_TRUE(m_rings.Push(ring, second, sizeof(second)));
+
+  ASSERT_EQ(3, m_rings.Pop(ring, buffer.data(), buffer.size()));
+  EXPECT_EQ(3, buffer[2]);
+  ASSERT_EQ(2, m_rings.Pop(ring, buffer.data(), buffer.size()));
+  EXPECT_EQ(5, buffer[1]);
+  EXPECT_EQ(0, m_rings.Pop(ring, buffer.data(), buffer.size()));
+
+  // the other ring is untouched
+  EXPECT_EQ(0, m_rings.Pop(m_rings.GetRing(1), buffer.data(), buffer.size()));
+}
+
+TEST_F(TestEventRing, FullAndWrapAround)
+{
+  ASSERT_TRUE(m_created);
+  EventRing* ring = m_rings.GetRing(0);
+  std::vector<uint8_t> packet(1000);
+  std::vector<uint8_t> buffer(1024);
+
+  // four records of 1002 bytes fit, a fifth does not
+  for (int i = 0; i < 4; ++i)
+    EXPECT_TRUE(m_rings.Push(ring, packet.data(), packet.size()));
+  EXPECT_FALSE(m_rings.Push(ring, packet.data(), packet.size()));
+
+  // records crossing the end of the buffer come back intact
+  for (uint8_t round = 0; round < 20; ++round)
+  {
+    ASSERT_EQ(1000, m_rings.Pop(ring, buffer.data(), buffer.size()));
+    packet.assign(packet.size(), round);
+    EXPECT_TRUE(m_rings.Push(ring, packet.data(), packet.size()));
+  }
+  for (int i = 0; i < 3; ++i)
+    ASSERT_EQ(1000, m_rings.Pop(ring, buffer.data(), buffer.size()));
+  ASSERT_EQ(1000, m_rings.Pop(ring, buffer.data(), buffer.size()));
+  EXPECT_EQ(19, buffer[0]);
+  EXPECT_EQ(19, buffer[999]);
+}
+
+TEST_F(TestEventRing, Reset)
+{
+  ASSERT_TRUE(m_created);
+  EventRing* ring = m_rings.GetRing(0);
+  std::vector<uint8_t> buffer(1024);
+
+  ring->owner = 1234;
+  const uint8_t data[] = {1};
+  EXPECT_TRUE(m_rings.Push(ring, data, sizeof(data)));
+  CEventRing::Reset(ring);
+  EXPECT_EQ(0, ring->owner);
+  EXPECT_EQ(0, m_rings.Pop(ring, buffer.data(), buffer.size()));
+}
+
+TEST_F(TestEventRing, GeometryNotReadFromSegment)
+{
+  ASSERT_TRUE(m_created);
+  EventRing* ring = m_rings.GetRing(0);
+  std::vector<uint8_t> buffer(1024);
+
+  // a client overwriting the shared copies changes nothing for the server
+  EventRingSegment* segment = m_rings.GetSegment();
+  segment->ringCount = 1000;
+  segment->ringCapacity = 1u << 30;
+  EXPECT_EQ(nullptr, m_rings.GetRing(RING_COUNT));
+  EXPECT_EQ(ring, m_rings.GetRing(0));
+
+  const uint8_t data[] = {1, 2};
+  EXPECT_TRUE(m_rings.Push(ring, data, sizeof(data)));
+  ring->head.fetch_add(RING_CAPACITY);
+  EXPECT_EQ(-1, m_rings.Pop(ring, buffer.data(), buffer.size()));
+}
+
+TEST_F(TestEventRing, Stale)
+{
+  ASSERT_TRUE(m_created);
+  const size_t size = CEventRing::GetSegmentSize(RING_COUNT, RING_CAPACITY);
+  EventRingSegment* segment = m_rings.GetSegment();
+
+  // created by this process
+  EXPECT_FALSE(CEventRing::IsStale(m_memory, size));
+
+  const pid_t child = fork();
+  ASSERT_NE(-1, child);
+  if (child == 0)
+    _exit(0);
+  ASSERT_EQ(child, waitpid(child, nullptr, 0));
+  segment->serverPid = child;
+  EXPECT_TRUE(CEventRing::IsStale(m_memory, size));
+  EXPECT_FALSE(CEventRing::IsStale(m_memory, sizeof(EventRingSegment) - 1));
+
+  // segments of other versions are never taken for stale ones
+  segment->version = EventRingSegment::VERSION + 1;
+  EXPECT_FALSE(CEventRing::IsStale(m_memory, size));
+}
+
+TEST_F(TestEventRing, NotifyBatch)
+{
+  ASSERT_TRUE(m_created);
+  EventRing* ring = m_rings.GetRing(0);
+
+  EXPECT_FALSE(m_rings.Wait(10));
+
+  std::thread producer([this, ring]() {
+    const uint8_t data[] = {42};
+    for (int i = 0; i < 100; ++i)
+      m_rings.Push(ring, data, sizeof(data));
+    m_rings.Notify();
+  });
+
+  EXPECT_TRUE(m_rings.Wait(5000));
+  producer.join();
+
+  // one wakeup delivers the whole batch
+  std::vector<uint8_t> buffer(1024);
+  int count = 0;
+  while (m_rings.Pop(ring, buffer.data(), buffer.size()) > 0)
+    count++;
+  EXPECT_EQ(100, count);
+  EXPECT_FALSE(m_rings.Wait(10));
+}
@@ -0,0 +1,141 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "UPnPBrowseCache.h"
+
+#include "FileItemList.h"
+#include "utils/StringUtils.h"
+#include "utils/URIUtils.h"
+
+#include <mutex>
+
+using namespace UPNP;
+
+namespace
+{
+// number of containers kept, each one holds the complete item list of a container
+constexpr size_t MAX_ENTRIES = 16;
+
+// library containers are invalidated by announcements, everything else (files, playlists,
+// sources) only expires
+constexpr auto LIBRARY_MAX_AGE = std::chrono::minutes(30);
+constexpr auto OTHER_MAX_AGE = std::chrono::minutes(2);
+} // unnamed namespace
+
+CUPnPBrowseCache::CEntry::CEntry(std::shared_ptr<CFileItemList> items, Scope scope)
+  : m_items(std::move(items)),
+    m_scope(scope),
+    m_created(std::chrono::steady_clock::now()),
+    m_fragments(m_items->Size()),
+    m_states(m_items->Size(), State::NONE)
+{
+}
+
+const std::string* CUPnPBrowseCache::CEntry::GetFragment(size_t index, bool& skipped) const
+{
+  skipped = false;
+  if (index >= m_states.size())
+    return nullptr;
+
+  switch (m_states[index])
+  {
+    case State::RENDERED:
+      return &m_fragments[index];
+    case State::SKIPPED:
+      skipped = true;
+      return nullptr;
+    default:
+      return nullptr;
+  }
+}
+
+void CUPnPBrowseCache::CEntry::SetFragment(size_t index, std::string fragment)
+{
+  if (index >= m_states.size())
+    return;
+
+  m_fragments[index] = std::move(fragment);
+  m_states[index] = State::RENDERED;
+}
+
+void CUPnPBrowseCache::CEntry::SetSkipped(size_t index)
+{
+  if (index < m_states.size())
+    m_states[index] = State::SKIPPED;
+}
+
+bool CUPnPBrowseCache::CEntry::IsExpired(std::chrono::steady_clock::time_point now) const
+{
+  return now - m_created > (m_scope == Scope::OTHER ? OTHER_MAX_AGE : LIBRARY_MAX_AGE);
+}
+
+std::string CUPnPBrowseCache::MakeKey(const std::string& objectId,
+                                      const std::string& filter,
+                                      const std::string& sortCriteria,
+                                      const std::string& clientContext)
+{
+  return objectId + '\n' + filter + '\n' + sortCriteria + '\n' + clientContext;
+}
+
+CUPnPBrowseCache::Scope CUPnPBrowseCache::GetScope(const std::string& path)
+{
+  if (URIUtils::IsVideoDb(path) || StringUtils::StartsWithNoCase(path, "library://video"))
+    return Scope::VIDEO_LIBRARY;
+  if (URIUtils::IsMusicDb(path))
+    return Scope::MUSIC_LIBRARY;
+  return Scope::OTHER;
+}
+
+std::shared_ptr<CUPnPBrowseCache::CEntry> CUPnPBrowseCache::Get(const std::string& key)
+{
+  std::unique_lock lock(m_critSection);
+
+  const auto now = std::chrono::steady_clock::now();
+  for (auto it = m_entries.begin(); it != m_entries.end(); ++it)
+  {
+    if (it->key != key)
+      continue;
+
+    if (it->entry->IsExpired(now))
+    {
+      m_entries.erase(it);
+      return {};
+    }
+
+    m_entries.splice(m_entries.begin(), m_entries, it);
+    return m_entries.front().entry;
+  }
+  return {};
+}
+
+std::shared_ptr<CUPnPBrowseCache::CEntry> CUPnPBrowseCache::Add(
+    const std::string& key, std::shared_ptr<CFileItemList> items, Scope scope)
+{
+  auto entry = std::make_shared<CEntry>(std::move(items), scope);
+
+  std::unique_lock lock(m_critSection);
+
+  m_entries.remove_if([&key](const Slot& slot) { return slot.key == key; });
+  m_entries.push_front({key, entry});
+  while (m_entries.size() > MAX_ENTRIES)
+    m_entries.pop_back();
+
+  return entry;
+}
+
+void CUPnPBrowseCache::Invalidate(Scope scope)
+{
+  std::unique_lock lock(m_critSection);
+  m_entries.remove_if([scope](const Slot& slot) { return slot.entry->GetScope() == scope; });
+}
+
+void CUPnPBrowseCache::Clear()
+{
+  std::unique_lock lock(m_critSection);
+  m_entries.clear();
+}
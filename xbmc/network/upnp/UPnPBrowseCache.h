@@ -0,0 +1,123 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+class CFileItemList;
+
+namespace UPNP
+{
+
+/*!
+ * \brief In-memory cache of browsed containers for the UPnP media server.
+ *
+ * Renderers page through large containers with one Browse request per page. Without a cache
+ * every page retrieves the whole directory from the databases again and converts the requested
+ * items to DIDL-Lite. An entry keeps the retrieved item list together with the DIDL-Lite
+ * fragment of every item already rendered, so subsequent pages are served without touching the
+ * databases and revisited pages are served without rendering.
+ *
+ * Entries are dropped when the library they belong to changes, after a maximum age and in least
+ * recently used order once the cache is full.
+ */
+class CUPnPBrowseCache
+{
+public:
+  enum class Scope
+  {
+    VIDEO_LIBRARY,
+    MUSIC_LIBRARY,
+    OTHER
+  };
+
+  class CEntry
+  {
+  public:
+    CEntry(std::shared_ptr<CFileItemList> items, Scope scope);
+
+    const std::shared_ptr<CFileItemList>& GetItems() const { return m_items; }
+    Scope GetScope() const { return m_scope; }
+
+    /*!
+     * \brief Lock to hold while building or reading fragments, items are modified while building
+     */
+    CCriticalSection& GetSection() { return m_critSection; }
+
+    /*!
+     * \brief Get the rendered DIDL-Lite fragment of an item
+     * \param index the index of the item
+     * \param[out] skipped set if the item can't be represented and must be hidden from clients
+     * \return the fragment, nullptr if the item was not rendered yet
+     */
+    const std::string* GetFragment(size_t index, bool& skipped) const;
+    void SetFragment(size_t index, std::string fragment);
+    void SetSkipped(size_t index);
+
+    bool IsExpired(std::chrono::steady_clock::time_point now) const;
+
+  private:
+    enum class State : uint8_t
+    {
+      NONE,
+      RENDERED,
+      SKIPPED
+    };
+
+    std::shared_ptr<CFileItemList> m_items;
+    Scope m_scope;
+    std::chrono::steady_clock::time_point m_created;
+    std::vector<std::string> m_fragments;
+    std::vector<State> m_states;
+    CCriticalSection m_critSection;
+  };
+
+  /*!
+   * \brief Build the cache key of a browse request
+   */
+  static std::string MakeKey(const std::string& objectId,
+                             const std::string& filter,
+                             const std::string& sortCriteria,
+                             const std::string& clientContext);
+
+  /*!
+   * \brief Determine the invalidation scope of a browsed path
+   */
+  static Scope GetScope(const std::string& path);
+
+  std::shared_ptr<CEntry> Get(const std::string& key);
+  std::shared_ptr<CEntry> Add(const std::string& key,
+                              std::shared_ptr<CFileItemList> items,
+                              Scope scope);
+
+  /*!
+   * \brief Drop all entries of the given scope
+   */
+  void Invalidate(Scope scope);
+  void Clear();
+
+private:
+  struct Slot
+  {
+    std::string key;
+    std::shared_ptr<CEntry> entry;
+  };
+
+  CCriticalSection m_critSection;
+  std::list<Slot> m_entries; // most recently used first
+};
+
+} // namespace UPNP
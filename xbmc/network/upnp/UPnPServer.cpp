@@ -52,6 +52,7 @@
 #include "view/GUIViewState.h"
 
 #include <memory>
+#include <mutex>
 
 #include <Platinum/Source/Platinum/Platinum.h>
 
@@ -520,6 +521,15 @@ void CUPnPServer::Announce(AnnouncementFlag flag,
       message != "OnScanFinished")
     return;
 
+  // any change to a library makes the browse results of its containers stale
+  if (message != "OnScanStarted")
+  {
+    if (flag == VideoLibrary)
+      m_BrowseCache.Invalidate(CUPnPBrowseCache::Scope::VIDEO_LIBRARY);
+    else if (flag == AudioLibrary)
+      m_BrowseCache.Invalidate(CUPnPBrowseCache::Scope::MUSIC_LIBRARY);
+  }
+
   if (data.isNull())
   {
     if (message == "OnScanStarted" || message == "OnCleanStarted")
@@ -640,6 +650,41 @@ NPT_Result ObjectIDValidate(const NPT_String& id)
   return NPT_ERROR_NO_SUCH_FILE;
 }
 
+/*----------------------------------------------------------------------
+|   RemoveAddonNodes
++---------------------------------------------------------------------*/
+static void RemoveAddonNodes(CFileItemList& items)
+{
+  // this isn't pretty but needed to properly hide the addons node from clients
+  if (!StringUtils::StartsWith(items.GetPath(), "library"))
+    return;
+
+  for (int i = items.Size() - 1; i >= 0; i--)
+  {
+    if (StringUtils::StartsWith(items[i]->GetPath(), "addons") ||
+        StringUtils::EndsWith(items[i]->GetPath(), "/addons.xml/"))
+      items.Remove(i);
+  }
+}
+
+/*----------------------------------------------------------------------
+|   GetClientContext
++---------------------------------------------------------------------*/
+static std::string GetClientContext(const PLT_HttpRequestContext& context,
+                                    const NPT_String& action_name)
+{
+  // the rendered didl depends on the interface the request came in on (resource
+  // uris) and on the quirks of the client, which are derived from these headers
+  const NPT_HttpHeaders& headers = context.GetRequest().GetHeaders();
+  const NPT_String* user_agent = headers.GetHeaderValue(NPT_HTTP_HEADER_USER_AGENT);
+  const NPT_String* server = headers.GetHeaderValue(NPT_HTTP_HEADER_SERVER);
+
+  return StringUtils::Format("{}|{}|{}|{}", action_name.GetChars(),
+                             context.GetLocalAddress().GetIpAddress().ToString().GetChars(),
+                             user_agent ? user_agent->GetChars() : "",
+                             server ? server->GetChars() : "");
+}
+
 /*----------------------------------------------------------------------
 |   CUPnPServer::OnBrowseMetadata
 +---------------------------------------------------------------------*/
@@ -778,7 +823,6 @@ NPT_Result CUPnPServer::OnBrowseDirectChildren(PLT_ActionReference& action,
                                                const char* sort_criteria,
                                                const PLT_HttpRequestContext& context)
 {
-  CFileItemList items;
   const NPT_String decodedObjectId = DecodeObjectId(object_id);
   m_logger->info("Received Browse DirectChildren request for encoded object '{}' (plain value: "
                  "'{}'), with sort criteria {}",
@@ -792,6 +836,28 @@ NPT_Result CUPnPServer::OnBrowseDirectChildren(PLT_ActionReference& action,
     return NPT_FAILURE;
   }
 
+  // Don't pass parent_id if action is Search not BrowseDirectChildren, as
+  // we want the engine to determine the best parent id, not necessarily the one
+  // passed
+  NPT_String action_name = action->GetActionDesc().GetName();
+  const char* response_parent_id =
+      (action_name.Compare("Search", true) == 0) ? NULL : parent_id.GetChars();
+
+  // clients page through containers with one request per page, serve the
+  // following pages from the items (and didl) retrieved for the first one
+  const std::string cache_key = CUPnPBrowseCache::MakeKey(
+      parent_id.GetChars(), filter ? filter : "", sort_criteria ? sort_criteria : "",
+      GetClientContext(context, action_name));
+  std::shared_ptr<CUPnPBrowseCache::CEntry> cache_entry = m_BrowseCache.Get(cache_key);
+  if (cache_entry)
+  {
+    m_logger->debug("Serving '{}' from the browse cache", parent_id.GetChars());
+    return BuildResponse(action, *cache_entry->GetItems(), filter, starting_index, requested_count,
+                         sort_criteria, context, response_parent_id, cache_entry.get());
+  }
+
+  auto items_ptr = std::make_shared<CFileItemList>();
+  CFileItemList& items = *items_ptr;
   items.SetPath(std::string_view(parent_id));
 
   // guard against loading while saving to the same cache file
@@ -867,13 +933,12 @@ NPT_Result CUPnPServer::OnBrowseDirectChildren(PLT_ActionReference& action,
     }
   }
 
-  // Don't pass parent_id if action is Search not BrowseDirectChildren, as
-  // we want the engine to determine the best parent id, not necessarily the one
-  // passed
-  NPT_String action_name = action->GetActionDesc().GetName();
+  RemoveAddonNodes(items);
+
+  cache_entry = m_BrowseCache.Add(cache_key, items_ptr,
+                                  CUPnPBrowseCache::GetScope(parent_id.GetChars()));
   return BuildResponse(action, items, filter, starting_index, requested_count, sort_criteria,
-                       context,
-                       (action_name.Compare("Search", true) == 0) ? NULL : parent_id.GetChars());
+                       context, response_parent_id, cache_entry.get());
 }
 
 /*----------------------------------------------------------------------
@@ -886,44 +951,48 @@ NPT_Result CUPnPServer::BuildResponse(PLT_ActionReference& action,
                                       NPT_UInt32 requested_count,
                                       const char* sort_criteria,
                                       const PLT_HttpRequestContext& context,
-                                      const char* parent_id /* = NULL */)
+                                      const char* parent_id /* = NULL */,
+                                      CUPnPBrowseCache::CEntry* cache_entry /* = nullptr */)
 {
   NPT_COMPILER_UNUSED(sort_criteria);
 
   m_logger->debug("Building UPnP response with filter '{}', starting @ {} with {} requested",
                   filter, starting_index, requested_count);
 
-  // we will reuse this ThumbLoader for all items
-  NPT_Reference<CThumbLoader> thumb_loader;
-
-  if (URIUtils::IsVideoDb(items.GetPath()) ||
-      StringUtils::StartsWithNoCase(items.GetPath(), "library://video/") ||
-      StringUtils::StartsWithNoCase(items.GetPath(), "special://profile/playlists/video/"))
-  {
-
-    thumb_loader = NPT_Reference<CThumbLoader>(new CVideoThumbLoader());
-  }
-  else if (URIUtils::IsMusicDb(items.GetPath()) ||
-           StringUtils::StartsWithNoCase(items.GetPath(), "special://profile/playlists/music/"))
-  {
-
-    thumb_loader = NPT_Reference<CThumbLoader>(new CMusicThumbLoader());
-  }
-  if (!thumb_loader.IsNull())
-  {
-    thumb_loader->OnLoaderStart();
-  }
+  // building modifies the items, which are shared with other requests when cached
+  std::unique_lock<CCriticalSection> cache_lock;
+  if (cache_entry)
+    cache_lock = std::unique_lock(cache_entry->GetSection());
+  else
+    RemoveAddonNodes(items);
 
-  // this isn't pretty but needed to properly hide the addons node from clients
-  if (StringUtils::StartsWith(items.GetPath(), "library"))
-  {
-    for (int i = 0; i < items.Size(); i++)
+  // we will reuse this ThumbLoader for all items, it is only created once an
+  // item actually needs to be built as cached pages don't need it at all
+  NPT_Reference<CThumbLoader> thumb_loader;
+  bool thumb_loader_created = false;
+  auto get_thumb_loader = [&]() -> NPT_Reference<CThumbLoader>& {
+    if (!thumb_loader_created)
     {
-      if (StringUtils::StartsWith(items[i]->GetPath(), "addons") ||
-          StringUtils::EndsWith(items[i]->GetPath(), "/addons.xml/"))
-        items.Remove(i);
+      thumb_loader_created = true;
+      if (URIUtils::IsVideoDb(items.GetPath()) ||
+          StringUtils::StartsWithNoCase(items.GetPath(), "library://video/") ||
+          StringUtils::StartsWithNoCase(items.GetPath(), "special://profile/playlists/video/"))
+      {
+        thumb_loader = NPT_Reference<CThumbLoader>(new CVideoThumbLoader());
+      }
+      else if (URIUtils::IsMusicDb(items.GetPath()) ||
+               StringUtils::StartsWithNoCase(items.GetPath(),
+                                             "special://profile/playlists/music/"))
+      {
+        thumb_loader = NPT_Reference<CThumbLoader>(new CMusicThumbLoader());
+      }
+      if (!thumb_loader.IsNull())
+      {
+        thumb_loader->OnLoaderStart();
+      }
     }
-  }
+    return thumb_loader;
+  };
 
   // won't return more than UPNP_MAX_RETURNED_ITEMS items at a time to keep things smooth
   // 0 requested means as many as possible
@@ -939,17 +1008,37 @@ NPT_Result CUPnPServer::BuildResponse(PLT_ActionReference& action,
   PLT_MediaObjectReference object;
   for (unsigned long i = starting_index; i < stop_index; ++i)
   {
-    object = Build(items[i], true, context, thumb_loader, parent_id);
-    if (object.IsNull())
+    bool skipped = false;
+    const std::string* fragment = cache_entry ? cache_entry->GetFragment(i, skipped) : nullptr;
+    NPT_String tmp;
+    if (fragment)
+    {
+      tmp = fragment->c_str();
+    }
+    else if (!skipped)
+    {
+      object = Build(items[i], true, context, get_thumb_loader(), parent_id);
+      if (!object.IsNull())
+      {
+        NPT_CHECK(PLT_Didl::ToDidl(*object.AsPointer(), filter, tmp));
+        if (cache_entry)
+          cache_entry->SetFragment(i, tmp.GetChars());
+      }
+      else
+      {
+        skipped = true;
+        if (cache_entry)
+          cache_entry->SetSkipped(i);
+      }
+    }
+
+    if (skipped)
     {
       // don't tell the client this item ever existed
       --total;
       continue;
     }
 
-    NPT_String tmp;
-    NPT_CHECK(PLT_Didl::ToDidl(*object.AsPointer(), filter, tmp));
-
     // Neptunes string growing is dead slow for small additions
     if (didl.GetCapacity() < tmp.GetLength() + didl.GetLength())
     {
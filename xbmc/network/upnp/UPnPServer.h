@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "UPnPBrowseCache.h"
 #include "interfaces/IAnnouncer.h"
 #include "utils/logtypes.h"
 
@@ -125,7 +126,8 @@ public:
                              NPT_UInt32                    requested_count,
                              const char*                   sort_criteria,
                              const PLT_HttpRequestContext& context,
-                             const char*                   parent_id /* = NULL */);
+                             const char*                   parent_id /* = NULL */,
+                             CUPnPBrowseCache::CEntry*     cache_entry = nullptr);
 
     // class methods
     static void DefaultSortItems(CFileItemList& items);
@@ -141,6 +143,7 @@ public:
     static int GetRequiredVideoDbDetails(const NPT_String& filter);
 
     NPT_Mutex m_CacheMutex;
+    CUPnPBrowseCache m_BrowseCache;
 
     NPT_Mutex m_FileMutex;
     NPT_Map<NPT_String, NPT_String> m_FileMap;
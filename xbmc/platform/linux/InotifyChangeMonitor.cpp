@@ -0,0 +1,306 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "InotifyChangeMonitor.h"
+
+#include "utils/StringUtils.h"
+#include "utils/URIUtils.h"
+#include "utils/log.h"
+
+#include <cerrno>
+#include <filesystem>
+#include <mutex>
+
+#include <poll.h>
+#include <sys/inotify.h>
+#include <sys/vfs.h>
+#include <unistd.h>
+
+namespace
+{
+constexpr uint32_t WATCH_MASK = IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO |
+                                IN_CLOSE_WRITE | IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR;
+
+// file systems whose changes by other clients are not reported
+bool IsRemoteFileSystem(const std::string& path)
+{
+  struct statfs fs;
+  if (statfs(path.c_str(), &fs) != 0)
+    return true;
+
+  switch (static_cast<unsigned long>(fs.f_type))
+  {
+    case 0x6969: // NFS
+    case 0x517B: // SMB
+    case 0xFF534D42: // CIFS
+    case 0xFE534D42: // SMB2
+    case 0x65735546: // FUSE, e.g. sshfs
+    case 0x01021997: // 9P
+    case 0x564C: // NCP
+    case 0x73757245: // Coda
+    case 0x5346414F: // AFS
+      return true;
+    default:
+      return false;
+  }
+}
+} // unnamed namespace
+
+CInotifyChangeMonitor::CInotifyChangeMonitor(XFILE::IChangeMonitorCallback& callback)
+  : CThread("InotifyChangeMonitor"), m_callback(callback)
+{
+  m_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (m_fd < 0)
+  {
+    CLog::Log(LOGERROR, "CInotifyChangeMonitor: inotify_init1 failed, error {}", errno);
+    return;
+  }
+  Create();
+}
+
+CInotifyChangeMonitor::~CInotifyChangeMonitor()
+{
+  StopThread();
+  if (m_fd >= 0)
+    close(m_fd);
+}
+
+bool CInotifyChangeMonitor::Watch(const std::string& root)
+{
+  // only local paths, with the trailing slash of library paths
+  if (m_fd < 0 || !StringUtils::StartsWith(root, "/") || !URIUtils::HasSlashAtEnd(root))
+    return false;
+
+  if (IsRemoteFileSystem(root))
+    return false;
+
+  {
+    std::unique_lock lock(m_critSection);
+    if (m_roots.contains(root))
+      return true;
+  }
+
+  // walking a large tree takes a while, events of the trees watched already are handled
+  // meanwhile. those of the new tree are not, which the complete scan following covers.
+  Watches watches;
+  const bool added = AddWatches(root, root, watches);
+
+  std::unique_lock lock(m_critSection);
+  PublishWatches(root, watches);
+  if (m_roots.contains(root))
+    return true;
+
+  // a root removed during the walk had its events dropped, the watches being unknown then
+  std::error_code ec;
+  if (!added || !std::filesystem::is_directory(root, ec))
+  {
+    RemoveWatches(root, root);
+    return false;
+  }
+
+  m_roots.insert(root);
+  CLog::Log(LOGDEBUG, "CInotifyChangeMonitor: watching {} ({} directories in total)", root,
+            m_watches.size());
+  return true;
+}
+
+void CInotifyChangeMonitor::Process()
+{
+  alignas(inotify_event) char buffer[16 * 1024];
+
+  while (!m_bStop)
+  {
+    pollfd pfd = {m_fd, POLLIN, 0};
+    if (poll(&pfd, 1, 500) <= 0)
+      continue;
+
+    const ssize_t length = read(m_fd, buffer, sizeof(buffer));
+    if (length <= 0)
+      continue;
+
+    std::vector<Notification> notifications;
+    std::vector<Notification> newDirectories;
+    {
+      std::unique_lock lock(m_critSection);
+      for (ssize_t offset = 0; offset < length;)
+      {
+        const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+        HandleEvent(*event, notifications, newDirectories);
+        offset += sizeof(inotify_event) + event->len;
+      }
+    }
+
+    // watch new directories with the lock released, they may come with a whole tree. their events
+    // are read by this thread, so none are dropped meanwhile.
+    for (const auto& [root, directory] : newDirectories)
+    {
+      Watches watches;
+      const bool added = AddWatches(root, directory, watches);
+
+      std::unique_lock lock(m_critSection);
+      PublishWatches(root, watches);
+      if (!m_roots.contains(root))
+      {
+        // the root went away meanwhile
+        RemoveWatches(root, directory);
+        continue;
+      }
+
+      if (!added)
+      {
+        RemoveWatches(root, root);
+        m_roots.erase(root);
+        notifications.emplace_back(root, "");
+        continue;
+      }
+      // a new directory is scanned by itself, its parent has nothing new to scan
+      notifications.emplace_back(root, directory);
+    }
+
+    // the callbacks take locks of their own, they must not be called with ours held
+    for (const auto& [root, directory] : notifications)
+    {
+      if (directory.empty())
+        m_callback.OnChangesLost(root);
+      else
+        m_callback.OnDirectoryChanged(root, directory);
+    }
+  }
+}
+
+bool CInotifyChangeMonitor::AddWatch(const std::string& root,
+                                     const std::string& directory,
+                                     Watches& watches) const
+{
+  const int wd = inotify_add_watch(m_fd, directory.c_str(), WATCH_MASK);
+  if (wd < 0)
+  {
+    if (errno == ENOSPC || errno == ENOMEM)
+    {
+      CLog::Log(LOGWARNING,
+                "CInotifyChangeMonitor: too many directories to watch below {}, raise "
+                "fs.inotify.max_user_watches to watch it",
+                root);
+      return false;
+    }
+    // gone or not accessible, nothing to watch
+    return true;
+  }
+
+  watches.emplace_back(wd, directory);
+  return true;
+}
+
+bool CInotifyChangeMonitor::AddWatches(const std::string& root,
+                                       const std::string& directory,
+                                       Watches& watches) const
+{
+  if (!AddWatch(root, directory, watches))
+    return false;
+
+  namespace fs = std::filesystem;
+
+  std::error_code ec;
+  for (auto it = fs::recursive_directory_iterator(
+           directory, fs::directory_options::skip_permission_denied, ec);
+       !ec && it != fs::recursive_directory_iterator(); it.increment(ec))
+  {
+    if (it->is_symlink(ec) || !it->is_directory(ec))
+      continue;
+
+    if (!AddWatch(root, it->path().string() + "/", watches))
+      return false;
+  }
+  return true;
+}
+
+void CInotifyChangeMonitor::PublishWatches(const std::string& root, const Watches& watches)
+{
+  for (const auto& [wd, directory] : watches)
+  {
+    WatchedDirectory& watched = m_watches[wd];
+    watched.path = directory;
+    watched.roots.insert(root);
+  }
+}
+
+void CInotifyChangeMonitor::RemoveWatches(const std::string& root, const std::string& directory)
+{
+  for (auto it = m_watches.begin(); it != m_watches.end();)
+  {
+    WatchedDirectory& watched = it->second;
+    if (!StringUtils::StartsWith(watched.path, directory) || watched.roots.erase(root) == 0 ||
+        !watched.roots.empty())
+    {
+      ++it;
+      continue;
+    }
+
+    inotify_rm_watch(m_fd, it->first);
+    it = m_watches.erase(it);
+  }
+}
+
+void CInotifyChangeMonitor::HandleEvent(const inotify_event& event,
+                                        std::vector<Notification>& notifications,
+                                        std::vector<Notification>& newDirectories)
+{
+  if (event.mask & IN_Q_OVERFLOW)
+  {
+    for (const auto& root : m_roots)
+      notifications.emplace_back(root, "");
+    return;
+  }
+
+  const auto it = m_watches.find(event.wd);
+  if (it == m_watches.end())
+    return;
+
+  if (event.mask & IN_IGNORED)
+  {
+    m_watches.erase(it);
+    return;
+  }
+
+  // copied, the watches change below
+  const WatchedDirectory watched = it->second;
+
+  if (event.mask & (IN_DELETE_SELF | IN_MOVE_SELF))
+  {
+    // removed subdirectories are reported by their parent, only a removed root matters
+    if (watched.roots.contains(watched.path))
+    {
+      RemoveWatches(watched.path, watched.path);
+      m_roots.erase(watched.path);
+      notifications.emplace_back(watched.path, "");
+    }
+    return;
+  }
+
+  const std::string name = event.len > 0 ? event.name : "";
+  for (const auto& root : watched.roots)
+  {
+    if (!(event.mask & IN_ISDIR) || name.empty())
+    {
+      notifications.emplace_back(root, watched.path);
+      continue;
+    }
+
+    const std::string directory = watched.path + name + "/";
+    if (event.mask & (IN_CREATE | IN_MOVED_TO))
+    {
+      newDirectories.emplace_back(root, directory);
+    }
+    else
+    {
+      if (event.mask & IN_MOVED_FROM)
+        RemoveWatches(root, directory);
+      notifications.emplace_back(root, watched.path);
+    }
+  }
+}
@@ -0,0 +1,67 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "filesystem/IChangeMonitor.h"
+#include "threads/CriticalSection.h"
+#include "threads/Thread.h"
+
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+struct inotify_event;
+
+/*!
+ \brief Change monitor watching local directory trees with inotify.
+
+ inotify watches single directories, so every directory of a tree gets a watch and directories
+ created later are added as they appear. Network file systems don't report changes made by other
+ clients and are refused.
+ */
+class CInotifyChangeMonitor : public XFILE::IChangeMonitor, private CThread
+{
+public:
+  explicit CInotifyChangeMonitor(XFILE::IChangeMonitorCallback& callback);
+  ~CInotifyChangeMonitor() override;
+
+  bool Watch(const std::string& root) override;
+
+protected:
+  void Process() override;
+
+private:
+  struct WatchedDirectory
+  {
+    std::string path;
+    std::set<std::string> roots; // nested roots share the watches of their directories
+  };
+
+  using Notification = std::pair<std::string, std::string>; // root and directory, empty if lost
+  using Watches = std::vector<std::pair<int, std::string>>; // descriptor and directory
+
+  // add the watches of a tree, walking it without the lock held
+  bool AddWatch(const std::string& root, const std::string& directory, Watches& watches) const;
+  bool AddWatches(const std::string& root, const std::string& directory, Watches& watches) const;
+
+  // the following require the lock
+  void PublishWatches(const std::string& root, const Watches& watches);
+  void RemoveWatches(const std::string& root, const std::string& directory);
+  void HandleEvent(const inotify_event& event,
+                   std::vector<Notification>& notifications,
+                   std::vector<Notification>& newDirectories);
+
+  XFILE::IChangeMonitorCallback& m_callback;
+  int m_fd = -1;
+  CCriticalSection m_critSection;
+  std::map<int, WatchedDirectory> m_watches;
+  std::set<std::string> m_roots;
+};
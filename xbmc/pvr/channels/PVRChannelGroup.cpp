@@ -109,6 +109,8 @@ bool CPVRChannelGroup::LoadFromDatabase(
     channel->CreateEPG();
   }
 
+  std::unique_lock lock(m_critSection);
+  PublishMembers();
   m_bLoaded = true;
   return true;
 }
@@ -119,6 +121,30 @@ void CPVRChannelGroup::Unload()
   m_sortedMembers.clear();
   m_members.clear();
   m_failedClients.clear();
+  MembersChanged();
+  PublishMembers();
+}
+
+std::shared_ptr<const CPVRChannelGroup::MembersSnapshot> CPVRChannelGroup::GetMembersSnapshot()
+    const
+{
+  std::unique_lock lock(m_membersSnapshotCritSection);
+  return m_membersSnapshot;
+}
+
+void CPVRChannelGroup::PublishMembers()
+{
+  if (!m_bMembersChanged)
+    return;
+
+  // build the new snapshot outside of the snapshot lock, readers keep using the old one meanwhile
+  auto snapshot = std::make_shared<MembersSnapshot>();
+  snapshot->sorted = m_sortedMembers;
+  snapshot->byId = m_members;
+  m_bMembersChanged = false;
+
+  std::unique_lock lock(m_membersSnapshotCritSection);
+  m_membersSnapshot = std::move(snapshot);
 }
 
 int CPVRChannelGroup::GetClientID() const
@@ -191,10 +217,13 @@ struct sortByChannelNumber
 
 void CPVRChannelGroup::Sort()
 {
+  std::unique_lock lock(m_critSection);
   if (GetSettings()->UseBackendChannelOrder())
     SortByClientChannelNumber();
   else
     SortByChannelNumber();
+
+  PublishMembers();
 }
 
 bool CPVRChannelGroup::SortAndRenumber()
@@ -208,12 +237,14 @@ void CPVRChannelGroup::SortByClientChannelNumber()
 {
   std::unique_lock lock(m_critSection);
   std::ranges::sort(m_sortedMembers, sortByClientChannelNumber());
+  MembersChanged();
 }
 
 void CPVRChannelGroup::SortByChannelNumber()
 {
   std::unique_lock lock(m_critSection);
   std::ranges::sort(m_sortedMembers, sortByChannelNumber());
+  MembersChanged();
 }
 
 void CPVRChannelGroup::UpdateClientPriorities()
@@ -276,9 +307,9 @@ bool CPVRChannelGroup::UpdateMembersClientPriority()
 std::shared_ptr<CPVRChannelGroupMember> CPVRChannelGroup::GetByUniqueID(
     const std::pair<int, int>& id) const
 {
-  std::unique_lock lock(m_critSection);
-  const auto it = m_members.find(id);
-  return it != m_members.end() ? it->second : std::shared_ptr<CPVRChannelGroupMember>();
+  const auto members = GetMembersSnapshot();
+  const auto it = members->byId.find(id);
+  return it != members->byId.end() ? it->second : std::shared_ptr<CPVRChannelGroupMember>();
 }
 
 std::shared_ptr<CPVRChannel> CPVRChannelGroup::GetByUniqueID(int iUniqueChannelId,
@@ -291,11 +322,11 @@ std::shared_ptr<CPVRChannel> CPVRChannelGroup::GetByUniqueID(int iUniqueChannelI
 
 std::shared_ptr<CPVRChannel> CPVRChannelGroup::GetByChannelID(int iChannelID) const
 {
-  std::unique_lock lock(m_critSection);
+  const auto members = GetMembersSnapshot();
   const auto it =
-      std::ranges::find_if(m_members, [iChannelID](const auto& member)
+      std::ranges::find_if(members->byId, [iChannelID](const auto& member)
                            { return member.second->Channel()->ChannelID() == iChannelID; });
-  return it != m_members.cend() ? (*it).second->Channel() : std::shared_ptr<CPVRChannel>();
+  return it != members->byId.cend() ? (*it).second->Channel() : std::shared_ptr<CPVRChannel>();
 }
 
 namespace
@@ -309,8 +340,7 @@ bool MatchProvider(const std::shared_ptr<CPVRChannel>& channel, int clientId, in
 
 bool CPVRChannelGroup::HasChannelForProvider(int clientId, int providerId) const
 {
-  std::unique_lock lock(m_critSection);
-  return std::ranges::any_of(m_members,
+  return std::ranges::any_of(GetMembersSnapshot()->byId,
                              [clientId, providerId](const auto& member) {
                                return MatchProvider(member.second->Channel(), clientId, providerId);
                              });
@@ -318,9 +348,8 @@ bool CPVRChannelGroup::HasChannelForProvider(int clientId, int providerId) const
 
 unsigned int CPVRChannelGroup::GetChannelCountByProvider(int clientId, int providerId) const
 {
-  std::unique_lock lock(m_critSection);
   auto channels{std::ranges::count_if(
-      m_members, [clientId, providerId](const auto& member)
+      GetMembersSnapshot()->byId, [clientId, providerId](const auto& member)
       { return MatchProvider(member.second->Channel(), clientId, providerId); })};
   return static_cast<unsigned int>(channels);
 }
@@ -328,10 +357,8 @@ unsigned int CPVRChannelGroup::GetChannelCountByProvider(int clientId, int provi
 std::shared_ptr<CPVRChannelGroupMember> CPVRChannelGroup::GetLastPlayedChannelGroupMember(
     int iCurrentChannel /* = -1 */) const
 {
-  std::unique_lock lock(m_critSection);
-
   std::shared_ptr<CPVRChannelGroupMember> groupMember;
-  for (const auto& [_, member] : m_members)
+  for (const auto& [_, member] : GetMembersSnapshot()->byId)
   {
     const std::shared_ptr<const CPVRChannel> channel{member->Channel()};
     if (channel->ChannelID() != iCurrentChannel &&
@@ -348,13 +375,10 @@ std::shared_ptr<CPVRChannelGroupMember> CPVRChannelGroup::GetLastPlayedChannelGr
 
 GroupMemberPair CPVRChannelGroup::GetLastAndPreviousToLastPlayedChannelGroupMember() const
 {
-  std::unique_lock lock(m_critSection);
-  if (m_sortedMembers.empty())
+  auto members = GetMembersSnapshot()->sorted;
+  if (members.empty())
     return {};
 
-  auto members = m_sortedMembers;
-  lock.unlock();
-
   std::ranges::sort(members, [](const auto& a, const auto& b)
                     { return a->Channel()->LastWatched() > b->Channel()->LastWatched(); });
 
@@ -373,6 +397,7 @@ GroupMemberPair CPVRChannelGroup::GetLastAndPreviousToLastPlayedChannelGroupMemb
 CPVRChannelNumber CPVRChannelGroup::GetChannelNumber(
     const std::shared_ptr<const CPVRChannel>& channel) const
 {
+  // the numbers of a member change under the group lock, see Renumber()
   std::unique_lock lock(m_critSection);
   const std::shared_ptr<const CPVRChannelGroupMember> member = GetByUniqueID(channel->StorageId());
   return member ? member->ChannelNumber() : CPVRChannelNumber();
@@ -381,6 +406,7 @@ CPVRChannelNumber CPVRChannelGroup::GetChannelNumber(
 CPVRChannelNumber CPVRChannelGroup::GetClientChannelNumber(
     const std::shared_ptr<const CPVRChannel>& channel) const
 {
+  // the numbers of a member change under the group lock, see Renumber()
   std::unique_lock lock(m_critSection);
   const std::shared_ptr<const CPVRChannelGroupMember> member = GetByUniqueID(channel->StorageId());
   return member ? member->ClientChannelNumber() : CPVRChannelNumber();
@@ -409,15 +435,16 @@ std::shared_ptr<CPVRChannelGroupMember> CPVRChannelGroup::GetNextChannelGroupMem
 
   if (groupMember)
   {
-    std::unique_lock lock(m_critSection);
-    for (auto it = m_sortedMembers.cbegin(); !nextMember && it != m_sortedMembers.cend(); ++it)
+    const auto members = GetMembersSnapshot();
+    const auto& sortedMembers = members->sorted;
+    for (auto it = sortedMembers.cbegin(); !nextMember && it != sortedMembers.cend(); ++it)
     {
       if (*it == groupMember)
       {
         do
         {
-          if ((++it) == m_sortedMembers.cend())
-            it = m_sortedMembers.cbegin();
+          if ((++it) == sortedMembers.cend())
+            it = sortedMembers.cbegin();
           if ((*it)->Channel() && !(*it)->Channel()->IsHidden())
             nextMember = *it;
         } while (!nextMember && *it != groupMember);
@@ -437,16 +464,16 @@ std::shared_ptr<CPVRChannelGroupMember> CPVRChannelGroup::GetPreviousChannelGrou
 
   if (groupMember)
   {
-    std::unique_lock lock(m_critSection);
-    for (auto it = m_sortedMembers.crbegin(); !previousMember && it != m_sortedMembers.crend();
-         ++it)
+    const auto members = GetMembersSnapshot();
+    const auto& sortedMembers = members->sorted;
+    for (auto it = sortedMembers.crbegin(); !previousMember && it != sortedMembers.crend(); ++it)
     {
       if (*it == groupMember)
       {
         do
         {
-          if ((++it) == m_sortedMembers.crend())
-            it = m_sortedMembers.crbegin();
+          if ((++it) == sortedMembers.crend())
+            it = sortedMembers.crbegin();
           if ((*it)->Channel() && !(*it)->Channel()->IsHidden())
             previousMember = *it;
         } while (!previousMember && *it != groupMember);
@@ -461,12 +488,12 @@ std::shared_ptr<CPVRChannelGroupMember> CPVRChannelGroup::GetPreviousChannelGrou
 std::vector<std::shared_ptr<CPVRChannelGroupMember>> CPVRChannelGroup::GetMembers(
     Include eFilter /* = Include::ALL */) const
 {
-  std::unique_lock lock(m_critSection);
+  const auto snapshot = GetMembersSnapshot();
   if (eFilter == Include::ALL)
-    return m_sortedMembers;
+    return snapshot->sorted;
 
   std::vector<std::shared_ptr<CPVRChannelGroupMember>> members;
-  for (const auto& member : m_sortedMembers)
+  for (const auto& member : snapshot->sorted)
   {
     switch (eFilter)
     {
@@ -547,6 +574,7 @@ int CPVRChannelGroup::LoadFromDatabase(const std::vector<std::shared_ptr<CPVRCli
         // Ignore data from unknown/disabled clients
         m_sortedMembers.emplace_back(member);
         m_members.try_emplace({member->ChannelClientID(), member->ChannelUID()}, member);
+        MembersChanged();
       }
     }
 
@@ -598,10 +626,11 @@ bool CPVRChannelGroup::UpdateFromClient(const std::shared_ptr<CPVRChannelGroupMe
   std::unique_lock lock(m_critSection);
 
   const std::shared_ptr<CPVRChannel> channel = groupMember->Channel();
-  const std::shared_ptr<CPVRChannelGroupMember> existingMember =
-      GetByUniqueID(channel->StorageId());
-  if (existingMember)
+  const auto memberIt = m_members.find(channel->StorageId());
+  if (memberIt != m_members.end())
   {
+    const std::shared_ptr<CPVRChannelGroupMember>& existingMember = memberIt->second;
+
     // update existing channel
     if (IsChannelsOwner() && existingMember->Channel()->UpdateFromClient(channel))
     {
@@ -631,6 +660,7 @@ bool CPVRChannelGroup::UpdateFromClient(const std::shared_ptr<CPVRChannelGroupMe
 
     m_sortedMembers.emplace_back(groupMember);
     m_members.try_emplace(channel->StorageId(), groupMember);
+    MembersChanged();
 
     CLog::LogFC(LOGDEBUG, LOGPVR, "Added {} channel group member '{}' to group '{}'",
                 IsRadio() ? "radio" : "TV", channel->ChannelName(), GroupName());
@@ -708,6 +738,7 @@ std::vector<std::shared_ptr<CPVRChannelGroupMember>> CPVRChannelGroup::RemoveDel
 
       m_members.erase(channel->StorageId());
       it = m_sortedMembers.erase(it);
+      MembersChanged();
       continue;
     }
 
@@ -723,6 +754,7 @@ std::vector<std::shared_ptr<CPVRChannelGroupMember>> CPVRChannelGroup::RemoveDel
 
         m_members.erase(channel->StorageId());
         it = m_sortedMembers.erase(it);
+        MembersChanged();
         continue;
       }
     }
@@ -757,11 +789,13 @@ bool CPVRChannelGroup::UpdateGroupEntries(
     // back, so they'll get the highest numbers
     bool bRenumbered = SortAndRenumber();
     bReturn = Persist();
+    PublishMembers();
     m_events.Publish(HasNewChannels() || bRemoved || bRenumbered ? PVREvent::ChannelGroupInvalidated
                                                                  : PVREvent::ChannelGroup);
   }
   else
   {
+    PublishMembers();
     bReturn = true;
   }
 
@@ -783,6 +817,7 @@ bool CPVRChannelGroup::RemoveFromGroup(
     {
       m_members.erase(storageId);
       m_sortedMembers.erase(it);
+      MembersChanged();
       bReturn = true;
       break;
     }
@@ -793,6 +828,7 @@ bool CPVRChannelGroup::RemoveFromGroup(
   {
     DeleteGroupMembersFromDb({std::make_shared<CPVRChannelGroupMember>(*groupMember)});
     Renumber();
+    PublishMembers();
   }
 
   return bReturn;
@@ -805,7 +841,7 @@ bool CPVRChannelGroup::AppendToGroup(
 
   std::unique_lock lock(m_critSection);
 
-  if (!CPVRChannelGroup::IsGroupMember(groupMember))
+  if (!m_members.contains(groupMember->Channel()->StorageId()))
   {
     unsigned int channelNumberMax =
         std::accumulate(m_sortedMembers.cbegin(), m_sortedMembers.cend(), 0,
@@ -823,8 +859,10 @@ bool CPVRChannelGroup::AppendToGroup(
 
     m_sortedMembers.emplace_back(newMember);
     m_members.try_emplace(channel->StorageId(), newMember);
+    MembersChanged();
 
     SortAndRenumber();
+    PublishMembers();
     bReturn = true;
   }
   return bReturn;
@@ -833,8 +871,7 @@ bool CPVRChannelGroup::AppendToGroup(
 bool CPVRChannelGroup::IsGroupMember(
     const std::shared_ptr<const CPVRChannelGroupMember>& groupMember) const
 {
-  std::unique_lock lock(m_critSection);
-  return m_members.contains(groupMember->Channel()->StorageId());
+  return GetMembersSnapshot()->byId.contains(groupMember->Channel()->StorageId());
 }
 
 bool CPVRChannelGroup::Persist()
@@ -935,8 +972,7 @@ bool CPVRChannelGroup::Renumber(RenumberMode mode /* = NORMAL */)
 
 bool CPVRChannelGroup::HasNewChannels() const
 {
-  std::unique_lock lock(m_critSection);
-  return std::ranges::any_of(m_members, [](const auto& member)
+  return std::ranges::any_of(GetMembersSnapshot()->byId, [](const auto& member)
                              { return member.second->Channel()->ChannelID() <= 0; });
 }
 
@@ -1111,20 +1147,17 @@ void CPVRChannelGroup::SetLastOpened(uint64_t iLastOpened)
 
 size_t CPVRChannelGroup::Size() const
 {
-  std::unique_lock lock(m_critSection);
-  return m_members.size();
+  return GetMembersSnapshot()->byId.size();
 }
 
 bool CPVRChannelGroup::HasChannels() const
 {
-  std::unique_lock lock(m_critSection);
-  return !m_members.empty();
+  return !GetMembersSnapshot()->byId.empty();
 }
 
 bool CPVRChannelGroup::HasHiddenChannels() const
 {
-  std::unique_lock lock(m_critSection);
-  return std::ranges::any_of(m_members, [](const auto& member)
+  return std::ranges::any_of(GetMembersSnapshot()->byId, [](const auto& member)
                              { return member.second->Channel()->IsHidden(); });
 }
 
@@ -1189,12 +1222,9 @@ void CPVRChannelGroup::SetClientPosition(int iPosition)
 int CPVRChannelGroup::CleanupCachedImages()
 {
   std::vector<std::string> urlsToCheck;
-  {
-    std::unique_lock lock(m_critSection);
-    std::ranges::transform(m_members, std::back_inserter(urlsToCheck),
-                           [](const auto& groupMember)
-                           { return groupMember.second->Channel()->ClientIconPath(); });
-  }
+  std::ranges::transform(GetMembersSnapshot()->byId, std::back_inserter(urlsToCheck),
+                         [](const auto& groupMember)
+                         { return groupMember.second->Channel()->ClientIconPath(); });
 
   const std::string owner =
       StringUtils::Format(CPVRChannel::IMAGE_OWNER_PATTERN, IsRadio() ? "radio" : "tv");
@@ -327,6 +327,27 @@ public:
   std::vector<std::shared_ptr<CPVRChannelGroupMember>> GetMembers(
       Include eFilter = Include::ALL) const;
 
+  /*!
+   * @brief The members of a group at one point in time. Never modified, a new snapshot replaces
+   * the current one whenever members get added, removed or reordered. The members themselves are
+   * shared with the group and get renumbered under its lock, so their channel numbers must be
+   * read through the group.
+   */
+  struct MembersSnapshot
+  {
+    std::vector<std::shared_ptr<CPVRChannelGroupMember>>
+        sorted; /*!< members sorted by channel number */
+    std::map<std::pair<int, int>, std::shared_ptr<CPVRChannelGroupMember>>
+        byId; /*!< members with key clientid+uniqueid */
+  };
+
+  /*!
+   * @brief Get the current members of this group, without copying them and without waiting for
+   * running updates of the group.
+   * @return The members, never nullptr.
+   */
+  std::shared_ptr<const MembersSnapshot> GetMembersSnapshot() const;
+
   /*!
    * @brief Get the list of active channel numbers in a group.
    * @param channelNumbers The list to store the numbers in.
@@ -613,6 +634,17 @@ private:
 
   void OnSettingChanged();
 
+  /*!
+   * @brief Mark the members snapshot outdated after members were added, removed or reordered.
+   */
+  void MembersChanged() { m_bMembersChanged = true; }
+
+  /*!
+   * @brief Replace the members snapshot, if members were changed since it was taken.
+   * @note Must be called with m_critSection locked, at the end of a batch of changes.
+   */
+  void PublishMembers();
+
   std::shared_ptr<const CPVRChannelGroup> m_allChannelsGroup;
   CPVRChannelsPath m_path;
   bool m_bDeleted = false;
@@ -631,6 +663,10 @@ private:
   int m_iPosition{0}; /*!< the local position of this group within the group list */
   std::vector<std::shared_ptr<CPVRChannelGroupMember>>
       m_sortedMembers; /*!< members sorted by channel number */
+  bool m_bMembersChanged{false}; /*!< true if m_membersSnapshot is outdated */
+  mutable CCriticalSection m_membersSnapshotCritSection; /*!< guards m_membersSnapshot only */
+  std::shared_ptr<const MembersSnapshot> m_membersSnapshot{
+      std::make_shared<const MembersSnapshot>()};
   CEventSource<PVREvent> m_events;
   mutable std::shared_ptr<CPVRChannelGroupSettings> m_settings;
 
@@ -197,11 +197,11 @@ void CGUIDialogPVRChannelsOSD::Update()
         pvrMgr.PlaybackState()->GetActiveChannelGroup(channel->IsRadio());
     if (group)
     {
-      const std::vector<std::shared_ptr<CPVRChannelGroupMember>> groupMembers =
-          group->GetMembers(CPVRChannelGroup::Include::ONLY_VISIBLE);
-      for (const auto& groupMember : groupMembers)
+      const auto groupMembers = group->GetMembersSnapshot();
+      for (const auto& groupMember : groupMembers->sorted)
       {
-        m_vecItems->Add(std::make_shared<CFileItem>(groupMember));
+        if (!groupMember->Channel()->IsHidden())
+          m_vecItems->Add(std::make_shared<CFileItem>(groupMember));
       }
 
       m_viewControl.SetItems(*m_vecItems);
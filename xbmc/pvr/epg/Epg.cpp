@@ -22,6 +22,7 @@
 #include "utils/StringUtils.h"
 #include "utils/log.h"
 
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <utility>
@@ -72,12 +73,6 @@ void CPVREpg::Clear()
   m_tags.Clear();
 }
 
-void CPVREpg::Cleanup(int iPastDays)
-{
-  const CDateTime cleanupTime = CDateTime::GetUTCDateTime() - CDateTimeSpan(iPastDays, 0, 0, 0);
-  Cleanup(cleanupTime);
-}
-
 void CPVREpg::Cleanup(const CDateTime& time)
 {
   std::unique_lock lock(m_critSection);
@@ -254,9 +249,9 @@ bool CPVREpg::UpdateEntry(const std::shared_ptr<CPVREpgInfoTag>& tag, EPG_EVENT_
 bool CPVREpg::Update(time_t start,
                      time_t end,
                      int iUpdateTime,
-                     int iPastDays,
                      const std::shared_ptr<CPVREpgDatabase>& database,
-                     bool bForceUpdate /* = false */)
+                     bool bForceUpdate /* = false */,
+                     UpdateTimes* times /* = nullptr */)
 {
   bool bUpdate = false;
   std::shared_ptr<CPVREpg> tmpEpg;
@@ -304,14 +299,20 @@ bool CPVREpg::Update(time_t start,
     }
   }
 
-  // remove obsolete tags
-  Cleanup(iPastDays);
-
   bool bGrabSuccess = true;
 
   if (bUpdate)
   {
-    bGrabSuccess = tmpEpg->UpdateFromScraper(start, end, bForceUpdate) && UpdateEntries(*tmpEpg);
+    const auto fetchStart = std::chrono::steady_clock::now();
+    bGrabSuccess = tmpEpg->UpdateFromScraper(start, end, bForceUpdate);
+    const auto mergeStart = std::chrono::steady_clock::now();
+    bGrabSuccess = bGrabSuccess && UpdateEntries(*tmpEpg);
+
+    if (times)
+    {
+      times->fetch += mergeStart - fetchStart;
+      times->merge += std::chrono::steady_clock::now() - mergeStart;
+    }
 
     if (!bGrabSuccess)
       CLog::LogF(LOGERROR, "Failed to update table '{}'", Name());
@@ -360,6 +361,12 @@ bool CPVREpg::QueuePersistQuery(const std::shared_ptr<CPVREpgDatabase>& database
   return true;
 }
 
+void CPVREpg::ResetTimelineIndex()
+{
+  std::unique_lock lock(m_critSection);
+  m_tags.ResetTimelineIndex();
+}
+
 bool CPVREpg::QueueDeleteQueries(const std::shared_ptr<CPVREpgDatabase>& database)
 {
   if (!database)
@@ -15,6 +15,7 @@
 #include "utils/EventStream.h"
 
 #include <atomic>
+#include <chrono>
 #include <map>
 #include <memory>
 #include <string>
@@ -187,16 +188,30 @@ namespace PVR
     bool UpdateEntry(const std::shared_ptr<CPVREpgInfoTag>& tag, EPG_EVENT_STATE newState);
 
     /*!
-     * @brief Update the EPG from 'start' till 'end'.
+     * @brief Time spent in the stages of EPG updates.
+     */
+    struct UpdateTimes
+    {
+      std::chrono::steady_clock::duration fetch{}; //!< getting the events from the client
+      std::chrono::steady_clock::duration merge{}; //!< merging the events into the table
+    };
+
+    /*!
+     * @brief Update the EPG from 'start' till 'end'. Obsolete tags are left to Cleanup().
      * @param start The start time.
      * @param end The end time.
      * @param iUpdateTime Update the table after the given amount of time has passed.
-     * @param iPastDays Amount of past days from now on, for which past entries are to be kept.
      * @param database If given, the database to store the data.
      * @param bForceUpdate Force update from client even if it's not the time to
+     * @param times If given, the time spent in the stages of the update gets added to it.
      * @return True if the update was successful, false otherwise.
      */
-    bool Update(time_t start, time_t end, int iUpdateTime, int iPastDays, const std::shared_ptr<CPVREpgDatabase>& database, bool bForceUpdate = false);
+    bool Update(time_t start,
+                time_t end,
+                int iUpdateTime,
+                const std::shared_ptr<CPVREpgDatabase>& database,
+                bool bForceUpdate = false,
+                UpdateTimes* times = nullptr);
 
     /*!
      * @brief Get all EPG tags.
@@ -231,6 +246,12 @@ namespace PVR
      */
     bool QueueDeleteQueries(const std::shared_ptr<CPVREpgDatabase>& database);
 
+    /*!
+     * @brief Reload the timeline index from the database on next use. The index is updated when
+     * the persist queries are queued, so it is ahead of the database if committing them failed.
+     */
+    void ResetTimelineIndex();
+
     /*!
      * @brief Get the start and end time of the last not yet committed entry in this table.
      * @return The times; first: start time, second: end time.
@@ -312,12 +333,6 @@ namespace PVR
      */
     bool UpdateEntries(const CPVREpg& epg);
 
-    /*!
-     * @brief Remove all entries from this EPG that finished before the given amount of days.
-     * @param iPastDays Delete entries with an end time before the given amount of days from now on.
-     */
-    void Cleanup(int iPastDays);
-
     bool m_bChanged = false; /*!< true if anything changed that needs to be persisted, false otherwise */
     std::atomic<bool> m_bUpdatePending = {false}; /*!< true if manual update is pending */
     int m_iEpgID = 0; /*!< the database ID of this table */
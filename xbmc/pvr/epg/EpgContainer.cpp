@@ -23,10 +23,17 @@
 #include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
+#include "threads/Event.h"
+#include "threads/IRunnable.h"
 #include "threads/SystemClock.h"
+#include "threads/Thread.h"
 #include "utils/log.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <numeric>
@@ -87,6 +94,128 @@ void CEpgTagStateChange::Deliver(const std::shared_ptr<CPVREpg>& epg) const
   epg->UpdateEntry(m_epgtag, m_state);
 }
 
+/*!
+ * @brief Queue of EPG tables to update, worked off by one or more threads. The tables of one client
+ * are updated by a limited number of threads at once, tables of different clients concurrently.
+ */
+class CEpgUpdateQueue : public IRunnable
+{
+public:
+  using UpdateFunc = std::function<void(const std::shared_ptr<CPVREpg>&, CPVREpg::UpdateTimes&)>;
+  using InterruptFunc = std::function<bool()>;
+
+  CEpgUpdateQueue(const std::vector<std::shared_ptr<CPVREpg>>& epgs,
+                  unsigned int iMaxPerClient,
+                  UpdateFunc update,
+                  InterruptFunc interrupt);
+
+  void Run() override;
+
+  bool IsInterrupted() const { return m_bInterrupted; }
+  CPVREpg::UpdateTimes GetTimes() const;
+
+private:
+  std::shared_ptr<CPVREpg> Take(int& iClientId);
+  void Done(int iClientId);
+
+  struct ClientQueue
+  {
+    std::vector<std::shared_ptr<CPVREpg>> epgs;
+    size_t next{0};
+    unsigned int active{0};
+  };
+
+  const unsigned int m_iMaxPerClient;
+  const UpdateFunc m_update;
+  const InterruptFunc m_interrupt;
+
+  mutable CCriticalSection m_critSection;
+  std::map<int, ClientQueue> m_clients;
+  CPVREpg::UpdateTimes m_times;
+  CEvent m_done;
+  std::atomic<bool> m_bInterrupted{false};
+};
+
+CEpgUpdateQueue::CEpgUpdateQueue(const std::vector<std::shared_ptr<CPVREpg>>& epgs,
+                                 unsigned int iMaxPerClient,
+                                 UpdateFunc update,
+                                 InterruptFunc interrupt)
+  : m_iMaxPerClient(std::max(iMaxPerClient, 1u)),
+    m_update(std::move(update)),
+    m_interrupt(std::move(interrupt))
+{
+  for (const auto& epg : epgs)
+    m_clients[epg->GetChannelData()->ClientId()].epgs.emplace_back(epg);
+}
+
+void CEpgUpdateQueue::Run()
+{
+  CPVREpg::UpdateTimes times;
+
+  int iClientId{PVR_CLIENT_INVALID_UID};
+  for (auto epg = Take(iClientId); epg; epg = Take(iClientId))
+  {
+    m_update(epg, times);
+    Done(iClientId);
+  }
+
+  std::unique_lock lock(m_critSection);
+  m_times.fetch += times.fetch;
+  m_times.merge += times.merge;
+}
+
+CPVREpg::UpdateTimes CEpgUpdateQueue::GetTimes() const
+{
+  std::unique_lock lock(m_critSection);
+  return m_times;
+}
+
+std::shared_ptr<CPVREpg> CEpgUpdateQueue::Take(int& iClientId)
+{
+  while (true)
+  {
+    if (m_bInterrupted || m_interrupt())
+    {
+      m_bInterrupted = true;
+      return {};
+    }
+
+    {
+      std::unique_lock lock(m_critSection);
+
+      bool bPending = false;
+      for (auto& [id, client] : m_clients)
+      {
+        if (client.next == client.epgs.size())
+          continue;
+
+        if (client.active < m_iMaxPerClient)
+        {
+          client.active++;
+          iClientId = id;
+          return client.epgs[client.next++];
+        }
+        bPending = true;
+      }
+
+      if (!bPending)
+        return {};
+    }
+
+    // all clients with pending tables are busy
+    m_done.Wait(100ms);
+  }
+}
+
+void CEpgUpdateQueue::Done(int iClientId)
+{
+  {
+    std::unique_lock lock(m_critSection);
+    m_clients[iClientId].active--;
+  }
+  m_done.Set();
+}
+
 CPVREpgContainer::CPVREpgContainer(CEventSource<PVREvent>& eventSource)
   : CThread("EPGUpdater"),
     m_database(std::make_shared<CPVREpgDatabase>()),
@@ -261,6 +390,18 @@ bool CPVREpgContainer::PersistAll(unsigned int iMaxTimeslice) const
 
   if (!changedEpgs.empty())
   {
+    // the timeline indexes are updated when the queries are queued, those of the EPGs whose
+    // queries failed to commit get reloaded from the database
+    std::vector<std::shared_ptr<CPVREpg>> uncommittedEpgs;
+    std::vector<std::shared_ptr<CPVREpg>> failedEpgs;
+    const auto commit = [&database, &uncommittedEpgs, &failedEpgs]
+    {
+      const bool deleted = database->CommitDeleteQueries();
+      if (!database->CommitInsertQueries() || !deleted)
+        failedEpgs.insert(failedEpgs.end(), uncommittedEpgs.begin(), uncommittedEpgs.end());
+      uncommittedEpgs.clear();
+    };
+
     // Note: We must lock the db the whole time, otherwise races may occur.
     database->Lock();
 
@@ -273,14 +414,14 @@ bool CPVREpgContainer::PersistAll(unsigned int iMaxTimeslice) const
                     epg->GetChannelData()->ChannelName());
 
         bReturn &= epg->QueuePersistQuery(database);
+        uncommittedEpgs.emplace_back(epg);
 
         size_t queryCount = database->GetInsertQueriesCount() + database->GetDeleteQueriesCount();
         if (queryCount > EPG_COMMIT_QUERY_COUNT_LIMIT)
         {
           CLog::LogFC(LOGDEBUG, LOGEPG, "EPG Container: committing {} queries in loop.",
                       queryCount);
-          database->CommitDeleteQueries();
-          database->CommitInsertQueries();
+          commit();
           CLog::LogFC(LOGDEBUG, LOGEPG, "EPG Container: committed {} queries in loop.", queryCount);
         }
       }
@@ -289,12 +430,18 @@ bool CPVREpgContainer::PersistAll(unsigned int iMaxTimeslice) const
     }
 
     if (bReturn)
-    {
-      database->CommitDeleteQueries();
-      database->CommitInsertQueries();
-    }
+      commit();
 
     database->Unlock();
+
+    // Note: Not before the db is unlocked, the EPGs must be locked first.
+    for (const auto& epg : failedEpgs)
+    {
+      CLog::LogF(LOGERROR, "Failed to persist events for channel '{}'",
+                 epg->GetChannelData()->ChannelName());
+      epg->ResetTimelineIndex();
+    }
+    bReturn &= failedEpgs.empty();
   }
 
   return bReturn;
@@ -647,20 +794,35 @@ bool CPVREpgContainer::QueueDeleteEpgs(const std::vector<std::shared_ptr<CPVREpg
     epg->Lock();
   }
 
+  // the timeline indexes are cleared when the deletion is queued, those of the EPGs whose
+  // deletion failed to commit get reloaded from the database
+  std::vector<std::shared_ptr<CPVREpg>> uncommittedEpgs;
+  std::vector<std::shared_ptr<CPVREpg>> failedEpgs;
+  const auto commit = [&database, &uncommittedEpgs, &failedEpgs]
+  {
+    if (!database->CommitDeleteQueries())
+      failedEpgs.insert(failedEpgs.end(), uncommittedEpgs.begin(), uncommittedEpgs.end());
+    uncommittedEpgs.clear();
+  };
+
   database->Lock();
   for (const auto& epg : epgs)
   {
     QueueDeleteEpg(epg, database);
+    uncommittedEpgs.emplace_back(epg);
     epg->Unlock();
 
     size_t queryCount = database->GetDeleteQueriesCount();
     if (queryCount > EPG_COMMIT_QUERY_COUNT_LIMIT)
-      database->CommitDeleteQueries();
+      commit();
   }
-  database->CommitDeleteQueries();
+  commit();
   database->Unlock();
 
-  return true;
+  for (const auto& epg : failedEpgs)
+    epg->ResetTimelineIndex();
+
+  return failedEpgs.empty();
 }
 
 bool CPVREpgContainer::QueueDeleteEpg(const std::shared_ptr<const CPVREpg>& epg,
@@ -756,40 +918,89 @@ bool CPVREpgContainer::UpdateEPG(bool bOnlyPending /* = false */)
     progressHandler = std::make_unique<CPVRGUIProgressHandler>(
         g_localizeStrings.Get(19004)); // Loading programme guide
 
-  size_t counter = 0;
+  const int iUpdateTime = m_settings->GetIntValue(CSettings::SETTING_EPG_EPGUPDATE) * 60;
+  const int iPastDays = m_settings->GetIntValue(CSettings::SETTING_EPG_PAST_DAYSTODISPLAY);
+
+  std::vector<std::shared_ptr<CPVREpg>> epgs;
+  epgs.reserve(epgsToUpdate.size());
   for (const auto& [_, epg] : epgsToUpdate)
   {
-    if (InterruptUpdate())
-    {
-      bInterrupted = true;
-      break;
-    }
+    if (epg)
+      epgs.emplace_back(epg);
+  }
 
-    if (!epg)
-      continue;
+  std::atomic<size_t> counter{0};
+  std::atomic<unsigned int> updatedTables{0};
+  CCriticalSection tablesLock;
+  std::vector<std::shared_ptr<CPVREpg>> checkedTables;
 
-    if (progressHandler)
-    {
-      counter++;
-      progressHandler->UpdateProgress(epg->GetChannelData()->ChannelName(), counter,
-                                      epgsToUpdate.size());
-    }
+  const auto updateStart = std::chrono::steady_clock::now();
+
+  CEpgUpdateQueue queue(
+      epgs, static_cast<unsigned int>(advancedSettings->m_iEpgClientUpdateWorkers),
+      [&](const std::shared_ptr<CPVREpg>& epg, CPVREpg::UpdateTimes& times)
+      {
+        if (progressHandler)
+          progressHandler->UpdateProgress(epg->GetChannelData()->ChannelName(), ++counter,
+                                          epgs.size());
+
+        if (bOnlyPending && !epg->UpdatePending())
+        {
+          if (!epg->IsValid())
+          {
+            std::unique_lock lock(tablesLock);
+            invalidTables.push_back(epg);
+          }
+          return;
+        }
 
-    if ((!bOnlyPending || epg->UpdatePending()) &&
-        epg->Update(start, end, m_settings->GetIntValue(CSettings::SETTING_EPG_EPGUPDATE) * 60,
-                    m_settings->GetIntValue(CSettings::SETTING_EPG_PAST_DAYSTODISPLAY), database,
-                    bOnlyPending))
+        const bool updated = epg->Update(start, end, iUpdateTime, database, bOnlyPending, &times);
+        if (updated)
+          updatedTables++;
+
+        std::unique_lock lock(tablesLock);
+        checkedTables.push_back(epg);
+        if (!updated && !epg->IsValid())
+          invalidTables.push_back(epg);
+      },
+      [this] { return InterruptUpdate(); });
+
+  const size_t threadCount =
+      std::min(static_cast<size_t>(std::max(advancedSettings->m_iEpgUpdateWorkers, 1)),
+               epgs.size());
+  if (threadCount > 1)
+  {
+    std::vector<std::unique_ptr<CThread>> threads;
+    for (size_t i = 0; i < threadCount; ++i)
     {
-      iUpdatedTables++;
+      threads.emplace_back(std::make_unique<CThread>(&queue, "EPGUpdateWorker"));
+      threads.back()->Create();
+      threads.back()->SetPriority(ThreadPriority::LOWEST);
     }
-    else if (!epg->IsValid())
+
+    for (const auto& thread : threads)
     {
-      invalidTables.push_back(epg);
+      while (!thread->Join(500ms))
+        ;
     }
   }
+  else
+  {
+    queue.Run();
+  }
+
+  bInterrupted = queue.IsInterrupted();
+  iUpdatedTables = updatedTables;
 
   progressHandler.reset();
 
+  // remove obsolete tags of the tables checked for an update. this deletes from the database, so
+  // do it here on the updater thread rather than on the workers.
+  const CDateTime cleanupTime =
+      CDateTime::GetUTCDateTime() - CDateTimeSpan(iPastDays, 0, 0, 0);
+  for (const auto& epg : checkedTables)
+    epg->Cleanup(cleanupTime);
+
   QueueDeleteEpgs(invalidTables);
 
   if (bInterrupted)
@@ -810,6 +1021,37 @@ bool CPVREpgContainer::UpdateEPG(bool bOnlyPending /* = false */)
       m_pendingUpdates = 0;
   }
 
+  const auto persistStart = std::chrono::steady_clock::now();
+
+  // write the changes now instead of leaving them to the periodic save, which only persists one
+  // slice per minute. keep the slices and pause between them, so the guide can read the database
+  // in between instead of waiting for the whole write.
+  if (!bInterrupted && iUpdatedTables > 0)
+  {
+    const auto needsSave = [this]
+    {
+      std::unique_lock lock(m_critSection);
+      return std::ranges::any_of(m_epgIdToEpgMap, [](const auto& entry)
+                                 { return entry.second && entry.second->NeedsSave(); });
+    };
+
+    while (!InterruptUpdate() && PersistAll(1000) && needsSave())
+      CThread::Sleep(100ms);
+  }
+
+  const auto updateEnd = std::chrono::steady_clock::now();
+  const CPVREpg::UpdateTimes times = queue.GetTimes();
+  // most runs only find that no table is due for an update yet
+  CLog::Log(times.fetch.count() > 0 ? LOGINFO : LOGDEBUG,
+            "EPG Container: Updated {} of {} tables using {} threads in {} ms (fetch: {} ms, "
+            "merge: {} ms, summed up over the threads; persist: {} ms){}",
+            iUpdatedTables, epgs.size(), std::max<size_t>(threadCount, 1),
+            std::chrono::duration_cast<std::chrono::milliseconds>(updateEnd - updateStart).count(),
+            std::chrono::duration_cast<std::chrono::milliseconds>(times.fetch).count(),
+            std::chrono::duration_cast<std::chrono::milliseconds>(times.merge).count(),
+            std::chrono::duration_cast<std::chrono::milliseconds>(updateEnd - persistStart).count(),
+            bInterrupted ? ", interrupted" : "");
+
   if (iUpdatedTables > 0)
     m_events.Publish(PVREvent::EpgContainer);
 
@@ -14,6 +14,7 @@
 #include "pvr/epg/EpgInfoTag.h"
 #include "pvr/epg/EpgSearchData.h"
 #include "pvr/epg/EpgSearchFilter.h"
+#include "pvr/epg/EpgSearchTermConverter.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/StringUtils.h"
@@ -32,7 +33,17 @@ using namespace PVR;
 bool CPVREpgDatabase::Open()
 {
   std::unique_lock lock(m_critSection);
-  return CDatabase::Open(CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_databaseEpg);
+  if (!CDatabase::Open(
+          CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_databaseEpg))
+    return false;
+
+  m_bHasSearchIndex = HasSearchIndex();
+  if (m_bHasSearchIndex)
+  {
+    // REPLACE INTO epgtags must fire the delete trigger keeping the search index up to date
+    m_pDS->exec("PRAGMA recursive_triggers=ON");
+  }
+  return true;
 }
 
 void CPVREpgDatabase::Close()
@@ -137,6 +148,38 @@ void CPVREpgDatabase::CreateTables()
               "bStartAnyTime             bool, "
               "bEndAnyTime               bool"
               ")");
+
+  CreateSearchIndex();
+}
+
+void CPVREpgDatabase::CreateSearchIndex()
+{
+  if (!m_sqlite)
+    return;
+
+  CLog::LogFC(LOGDEBUG, LOGEPG, "Creating table 'epgtags_fts'");
+  try
+  {
+    // trigram tokens keep the substring semantics of the LIKE search this index replaces. the
+    // texts are read from epgtags instead of being stored a second time.
+    m_pDS->exec("CREATE VIRTUAL TABLE epgtags_fts USING fts5("
+                "sTitle, sPlotOutline, sPlot, sEpisodeName, sGenre, tokenize='trigram', "
+                "content='epgtags', content_rowid='idBroadcast')");
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGWARNING, "SQLite lacks FTS5 support, EPG searches will not be indexed");
+  }
+}
+
+bool CPVREpgDatabase::HasSearchIndex() const
+{
+  if (!m_sqlite)
+    return false;
+
+  return !GetSingleValue("SELECT name FROM sqlite_master "
+                         "WHERE type = 'table' AND name = 'epgtags_fts'")
+              .empty();
 }
 
 void CPVREpgDatabase::CreateAnalytics()
@@ -146,6 +189,37 @@ void CPVREpgDatabase::CreateAnalytics()
   std::unique_lock lock(m_critSection);
   m_pDS->exec("CREATE UNIQUE INDEX idx_epg_idEpg_iStartTime on epgtags(idEpg, iStartTime desc);");
   m_pDS->exec("CREATE INDEX idx_epg_iEndTime on epgtags(iEndTime);");
+
+  if (HasSearchIndex())
+  {
+    // the index of an external content table is only removed by the 'delete' command, given the
+    // values that were indexed
+    m_pDS->exec("CREATE TRIGGER epgtags_fts_insert AFTER INSERT ON epgtags "
+                "BEGIN "
+                "INSERT INTO epgtags_fts "
+                "(rowid, sTitle, sPlotOutline, sPlot, sEpisodeName, sGenre) "
+                "VALUES (new.idBroadcast, new.sTitle, new.sPlotOutline, new.sPlot, "
+                "new.sEpisodeName, new.sGenre); "
+                "END");
+    m_pDS->exec("CREATE TRIGGER epgtags_fts_update AFTER UPDATE ON epgtags "
+                "BEGIN "
+                "INSERT INTO epgtags_fts "
+                "(epgtags_fts, rowid, sTitle, sPlotOutline, sPlot, sEpisodeName, sGenre) "
+                "VALUES ('delete', old.idBroadcast, old.sTitle, old.sPlotOutline, old.sPlot, "
+                "old.sEpisodeName, old.sGenre); "
+                "INSERT INTO epgtags_fts "
+                "(rowid, sTitle, sPlotOutline, sPlot, sEpisodeName, sGenre) "
+                "VALUES (new.idBroadcast, new.sTitle, new.sPlotOutline, new.sPlot, "
+                "new.sEpisodeName, new.sGenre); "
+                "END");
+    m_pDS->exec("CREATE TRIGGER epgtags_fts_delete AFTER DELETE ON epgtags "
+                "BEGIN "
+                "INSERT INTO epgtags_fts "
+                "(epgtags_fts, rowid, sTitle, sPlotOutline, sPlot, sEpisodeName, sGenre) "
+                "VALUES ('delete', old.idBroadcast, old.sTitle, old.sPlotOutline, old.sPlot, "
+                "old.sEpisodeName, old.sGenre); "
+                "END");
+  }
 }
 
 void CPVREpgDatabase::UpdateTables(int iVersion)
@@ -356,6 +430,13 @@ void CPVREpgDatabase::UpdateTables(int iVersion)
     m_pDS->exec("ALTER TABLE epgtags ADD sTitleExtraInfo varchar(128);");
     m_pDS->exec("UPDATE epgtags SET sTitleExtraInfo = ''");
   }
+
+  if (iVersion < 21)
+  {
+    CreateSearchIndex();
+    if (HasSearchIndex())
+      m_pDS->exec("INSERT INTO epgtags_fts (epgtags_fts) VALUES ('rebuild')");
+  }
 }
 
 bool CPVREpgDatabase::DeleteEpg()
@@ -514,6 +595,37 @@ CDateTime CPVREpgDatabase::GetLastEndTime(int iEpgID) const
   return {};
 }
 
+std::vector<std::pair<time_t, time_t>> CPVREpgDatabase::GetEpgTagTimes(int iEpgID) const
+{
+  std::vector<std::pair<time_t, time_t>> times;
+
+  std::unique_lock lock(m_critSection);
+  const std::string strQuery = PrepareSQL("SELECT iStartTime, iEndTime "
+                                          "FROM epgtags "
+                                          "WHERE idEpg = %u ORDER BY iStartTime;",
+                                          iEpgID);
+  if (ResultQuery(strQuery))
+  {
+    try
+    {
+      while (!m_pDS->eof())
+      {
+        times.emplace_back(static_cast<time_t>(m_pDS->fv(0).get_asInt64()),
+                           static_cast<time_t>(m_pDS->fv(1).get_asInt64()));
+        m_pDS->next();
+      }
+      m_pDS->close();
+    }
+    catch (...)
+    {
+      CLog::LogF(LOGERROR, "Could not load tag times for EPG ({})", iEpgID);
+      times.clear();
+    }
+  }
+
+  return times;
+}
+
 std::pair<CDateTime, CDateTime> CPVREpgDatabase::GetFirstAndLastEPGDate() const
 {
   CDateTime first;
@@ -572,133 +684,6 @@ CDateTime CPVREpgDatabase::GetMaxEndTime(int iEpgID, const CDateTime& maxEnd) co
   return {};
 }
 
-namespace
-{
-
-class CSearchTermConverter
-{
-public:
-  explicit CSearchTermConverter(const std::string& strSearchTerm) { Parse(strSearchTerm); }
-
-  bool HasSearchTerm() const { return !m_fragments.empty(); }
-
-  std::string ToSQL(std::string_view strFieldName) const
-  {
-    std::string result = "(";
-
-    for (auto it = m_fragments.cbegin(); it != m_fragments.cend();)
-    {
-      result += (*it);
-
-      ++it;
-      if (it != m_fragments.cend())
-        result += strFieldName;
-    }
-
-    StringUtils::TrimRight(result);
-    result += ")";
-    return result;
-  }
-
-private:
-  void Parse(const std::string& strSearchTerm)
-  {
-    std::string strParsedSearchTerm(strSearchTerm);
-    StringUtils::Trim(strParsedSearchTerm);
-
-    std::string strFragment;
-
-    bool bNextOR = false;
-    while (!strParsedSearchTerm.empty())
-    {
-      StringUtils::TrimLeft(strParsedSearchTerm);
-
-      if (StringUtils::StartsWith(strParsedSearchTerm, "!") ||
-          StringUtils::StartsWithNoCase(strParsedSearchTerm, "not"))
-      {
-        std::string strDummy;
-        GetAndCutNextTerm(strParsedSearchTerm, strDummy);
-        strFragment += " NOT ";
-        bNextOR = false;
-      }
-      else if (StringUtils::StartsWith(strParsedSearchTerm, "+") ||
-               StringUtils::StartsWithNoCase(strParsedSearchTerm, "and"))
-      {
-        std::string strDummy;
-        GetAndCutNextTerm(strParsedSearchTerm, strDummy);
-        strFragment += " AND ";
-        bNextOR = false;
-      }
-      else if (StringUtils::StartsWith(strParsedSearchTerm, "|") ||
-               StringUtils::StartsWithNoCase(strParsedSearchTerm, "or"))
-      {
-        std::string strDummy;
-        GetAndCutNextTerm(strParsedSearchTerm, strDummy);
-        strFragment += " OR ";
-        bNextOR = false;
-      }
-      else
-      {
-        std::string strTerm;
-        GetAndCutNextTerm(strParsedSearchTerm, strTerm);
-        if (!strTerm.empty())
-        {
-          if (bNextOR && !m_fragments.empty())
-            strFragment += " OR "; // default operator
-
-          strFragment += "(UPPER(";
-
-          m_fragments.emplace_back(strFragment);
-          strFragment.clear();
-
-          strFragment += ") LIKE UPPER('%";
-          StringUtils::Replace(strTerm, "'", "''"); // escape '
-          strFragment += strTerm;
-          strFragment += "%')) ";
-
-          bNextOR = true;
-        }
-        else
-        {
-          break;
-        }
-      }
-
-      StringUtils::TrimLeft(strParsedSearchTerm);
-    }
-
-    if (!strFragment.empty())
-      m_fragments.emplace_back(strFragment);
-  }
-
-  static void GetAndCutNextTerm(std::string& strSearchTerm, std::string& strNextTerm)
-  {
-    std::string strFindNext(" ");
-
-    if (StringUtils::EndsWith(strSearchTerm, "\""))
-    {
-      strSearchTerm.erase(0, 1);
-      strFindNext = "\"";
-    }
-
-    const size_t iNextPos = strSearchTerm.find(strFindNext);
-    if (iNextPos != std::string::npos)
-    {
-      strNextTerm = strSearchTerm.substr(0, iNextPos);
-      strSearchTerm.erase(0, iNextPos + 1);
-    }
-    else
-    {
-      strNextTerm = strSearchTerm;
-      strSearchTerm.clear();
-    }
-  }
-
-  std::vector<std::string> m_fragments;
-};
-
-} // unnamed namespace
-
 std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgDatabase::GetEpgTags(
     const PVREpgSearchData& searchData) const
 {
@@ -802,21 +787,29 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgDatabase::GetEpgTags(
   // search term
   /////////////////////////////////////////////////////////////////////////////////////////////
 
-  const CSearchTermConverter conv{searchData.m_strSearchTerm};
+  const CPVREpgSearchTermConverter conv{searchData.m_strSearchTerm};
   if (conv.HasSearchTerm())
   {
     // title
-    std::string strWhere = conv.ToSQL("sTitle");
+    std::string strWhere = conv.ToSQL("sTitle", m_bHasSearchIndex);
 
     // plot outline
     strWhere += " OR ";
-    strWhere += conv.ToSQL("sPlotOutline");
+    strWhere += conv.ToSQL("sPlotOutline", m_bHasSearchIndex);
+
+    // episode name
+    strWhere += " OR ";
+    strWhere += conv.ToSQL("sEpisodeName", m_bHasSearchIndex);
 
     if (searchData.m_bSearchInDescription)
     {
       // plot
       strWhere += " OR ";
-      strWhere += conv.ToSQL("sPlot");
+      strWhere += conv.ToSQL("sPlot", m_bHasSearchIndex);
+
+      // genre
+      strWhere += " OR ";
+      strWhere += conv.ToSQL("sGenre", m_bHasSearchIndex);
     }
 
     filter.AppendWhere(strWhere);
@@ -11,7 +11,9 @@
 #include "dbwrappers/Database.h"
 #include "threads/CriticalSection.h"
 
+#include <ctime>
 #include <memory>
+#include <utility>
 #include <vector>
 
 class CDateTime;
@@ -66,7 +68,7 @@ namespace PVR
      * @brief Get the minimal database version that is required to operate correctly.
      * @return The minimal database version.
      */
-    int GetSchemaVersion() const override { return 20; }
+    int GetSchemaVersion() const override { return 21; }
 
     /*!
      * @brief Get the default sqlite database filename.
@@ -140,6 +142,13 @@ namespace PVR
      */
     CDateTime GetLastEndTime(int iEpgID) const;
 
+    /*!
+     * @brief Get the start and end times of all tags in this EPG.
+     * @param iEpgID The ID of the EPG.
+     * @return The times, sorted by start time; first: start time, second: end time.
+     */
+    std::vector<std::pair<time_t, time_t>> GetEpgTagTimes(int iEpgID) const;
+
     /*!
      * @brief Get the start and end time across all EPGs.
      * @return The times; first: start time, second: end time.
@@ -379,11 +388,23 @@ namespace PVR
 
     int GetMinSchemaVersion() const override { return 4; }
 
+    /*!
+     * @brief Create the full-text index searches on EPG tags run against, if SQLite supports it.
+     */
+    void CreateSearchIndex();
+
+    /*!
+     * @brief Check whether the full-text search index exists.
+     * @return True if searches can use the index, false otherwise.
+     */
+    bool HasSearchIndex() const;
+
     std::shared_ptr<CPVREpgInfoTag> CreateEpgTag(dbiplus::Dataset& ds) const;
 
     std::shared_ptr<CPVREpgSearchFilter> CreateEpgSearchFilter(bool bRadio,
                                                                dbiplus::Dataset& ds) const;
 
     mutable CCriticalSection m_critSection;
+    bool m_bHasSearchIndex{false};
   };
 }
@@ -346,7 +346,9 @@ bool CPVREpgSearchFilter::MatchSearchTerm(const std::shared_ptr<const CPVREpgInf
       CTextSearch search(m_searchData.m_strSearchTerm, m_bIsCaseSensitive, SEARCH_DEFAULT_OR);
 
       bReturn = search.Search(tag->Title()) || search.Search(tag->PlotOutline()) ||
-                (m_searchData.m_bSearchInDescription && search.Search(tag->Plot()));
+                search.Search(tag->EpisodeName()) ||
+                (m_searchData.m_bSearchInDescription &&
+                 (search.Search(tag->Plot()) || search.Search(tag->GenreDescription())));
     }
   }
 
@@ -0,0 +1,152 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "EpgSearchTermConverter.h"
+
+#include "utils/StringUtils.h"
+
+#include <algorithm>
+
+using namespace PVR;
+
+CPVREpgSearchTermConverter::CPVREpgSearchTermConverter(const std::string& strSearchTerm)
+{
+  Parse(strSearchTerm);
+}
+
+std::string CPVREpgSearchTermConverter::ToSQL(std::string_view strFieldName,
+                                              bool bUseSearchIndex) const
+{
+  std::string result = "(";
+
+  for (const auto& term : m_terms)
+  {
+    result += term.strOperators;
+
+    // the trigram index cannot match anything shorter than three characters
+    if (bUseSearchIndex && CountCharacters(term.strText) >= 3)
+    {
+      std::string strPhrase = term.strText;
+      StringUtils::Replace(strPhrase, "\"", "\"\""); // escape " in the fts5 phrase
+      StringUtils::Replace(strPhrase, "'", "''"); // escape '
+      result += "(idBroadcast IN (SELECT rowid FROM epgtags_fts WHERE epgtags_fts MATCH '";
+      result += strFieldName;
+      result += " : \"";
+      result += strPhrase;
+      result += "\"')) ";
+    }
+    else
+    {
+      std::string strPattern = term.strText;
+      StringUtils::Replace(strPattern, "'", "''"); // escape '
+      result += "(UPPER(";
+      result += strFieldName;
+      result += ") LIKE UPPER('%";
+      result += strPattern;
+      result += "%')) ";
+    }
+  }
+
+  result += m_strTrailingOperators;
+  StringUtils::TrimRight(result);
+  result += ")";
+  return result;
+}
+
+size_t CPVREpgSearchTermConverter::CountCharacters(const std::string& strText)
+{
+  // count all bytes but utf-8 continuation bytes
+  return std::count_if(strText.begin(), strText.end(),
+                       [](char c) { return (static_cast<unsigned char>(c) & 0xC0) != 0x80; });
+}
+
+void CPVREpgSearchTermConverter::Parse(const std::string& strSearchTerm)
+{
+  std::string strParsedSearchTerm(strSearchTerm);
+  StringUtils::Trim(strParsedSearchTerm);
+
+  std::string strFragment;
+
+  bool bNextOR = false;
+  while (!strParsedSearchTerm.empty())
+  {
+    StringUtils::TrimLeft(strParsedSearchTerm);
+
+    if (StringUtils::StartsWith(strParsedSearchTerm, "!") ||
+        StringUtils::StartsWithNoCase(strParsedSearchTerm, "not"))
+    {
+      std::string strDummy;
+      GetAndCutNextTerm(strParsedSearchTerm, strDummy);
+      strFragment += " NOT ";
+      bNextOR = false;
+    }
+    else if (StringUtils::StartsWith(strParsedSearchTerm, "+") ||
+             StringUtils::StartsWithNoCase(strParsedSearchTerm, "and"))
+    {
+      std::string strDummy;
+      GetAndCutNextTerm(strParsedSearchTerm, strDummy);
+      strFragment += " AND ";
+      bNextOR = false;
+    }
+    else if (StringUtils::StartsWith(strParsedSearchTerm, "|") ||
+             StringUtils::StartsWithNoCase(strParsedSearchTerm, "or"))
+    {
+      std::string strDummy;
+      GetAndCutNextTerm(strParsedSearchTerm, strDummy);
+      strFragment += " OR ";
+      bNextOR = false;
+    }
+    else
+    {
+      std::string strTerm;
+      GetAndCutNextTerm(strParsedSearchTerm, strTerm);
+      if (!strTerm.empty())
+      {
+        if (bNextOR && !m_terms.empty())
+          strFragment += " OR "; // default operator
+
+        m_terms.push_back({strFragment, strTerm});
+        strFragment.clear();
+
+        bNextOR = true;
+      }
+      else
+      {
+        break;
+      }
+    }
+
+    StringUtils::TrimLeft(strParsedSearchTerm);
+  }
+
+  m_strTrailingOperators = strFragment;
+}
+
+void CPVREpgSearchTermConverter::GetAndCutNextTerm(std::string& strSearchTerm,
+                                                   std::string& strNextTerm)
+{
+  std::string strFindNext(" ");
+
+  if (StringUtils::EndsWith(strSearchTerm, "\""))
+  {
+    strSearchTerm.erase(0, 1);
+    strFindNext = "\"";
+  }
+
+  const size_t iNextPos = strSearchTerm.find(strFindNext);
+  if (iNextPos != std::string::npos)
+  {
+    strNextTerm = strSearchTerm.substr(0, iNextPos);
+    strSearchTerm.erase(0, iNextPos + 1);
+  }
+  else
+  {
+    strNextTerm = strSearchTerm;
+    strSearchTerm.clear();
+  }
+}
@@ -0,0 +1,57 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace PVR
+{
+/*!
+ * @brief Converts the search term of an EPG search into the SQL condition matching it.
+ *
+ * The term consists of words or quoted phrases, combined with the operators NOT (!), AND (+) and
+ * OR (|). Consecutive terms without an operator in between are combined with OR.
+ */
+class CPVREpgSearchTermConverter
+{
+public:
+  explicit CPVREpgSearchTermConverter(const std::string& strSearchTerm);
+
+  /*!
+   * @brief Check whether there is anything to search for.
+   * @return True if the search term contains a term or an operator, false otherwise.
+   */
+  bool HasSearchTerm() const { return !m_terms.empty() || !m_strTrailingOperators.empty(); }
+
+  /*!
+   * @brief Get the SQL condition matching the search term in the given field of epgtags.
+   * @param strFieldName The field.
+   * @param bUseSearchIndex Whether to match terms of at least three characters with the full-text
+   * index epgtags_fts instead of LIKE.
+   * @return The condition.
+   */
+  std::string ToSQL(std::string_view strFieldName, bool bUseSearchIndex) const;
+
+private:
+  struct Term
+  {
+    std::string strOperators; //!< operators preceding the term
+    std::string strText;
+  };
+
+  static size_t CountCharacters(const std::string& strText);
+  static void GetAndCutNextTerm(std::string& strSearchTerm, std::string& strNextTerm);
+  void Parse(const std::string& strSearchTerm);
+
+  std::vector<Term> m_terms;
+  std::string m_strTrailingOperators;
+};
+} // namespace PVR
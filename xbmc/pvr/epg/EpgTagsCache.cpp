@@ -14,6 +14,7 @@
 #include "pvr/epg/EpgChannelData.h"
 #include "pvr/epg/EpgDatabase.h"
 #include "pvr/epg/EpgInfoTag.h"
+#include "pvr/epg/EpgTimelineIndex.h"
 #include "utils/log.h"
 
 #include <algorithm>
@@ -93,7 +94,7 @@ bool CPVREpgTagsCache::Refresh()
     m_nowActiveEnd = m_nowActiveTag->EndAsUTC();
   }
 
-  if (!m_nowActiveTag && m_database)
+  if (!m_nowActiveTag && m_database && m_timelineIndex.HasEventAt(activeTime))
   {
     const std::vector<std::shared_ptr<CPVREpgInfoTag>> tags =
         m_database->GetEpgTagsByMinEndMaxStartTime(m_iEpgID, activeTime + ONE_SECOND, activeTime);
@@ -135,7 +136,7 @@ bool CPVREpgTagsCache::Refresh()
 
 void CPVREpgTagsCache::RefreshLastEndedTag(const CDateTime& activeTime)
 {
-  if (m_database)
+  if (m_database && m_timelineIndex.GetMaxEndTime(activeTime).IsValid())
   {
     m_lastEndedTag = m_database->GetEpgTagByMaxEndTime(m_iEpgID, activeTime);
     if (m_lastEndedTag)
@@ -155,9 +156,10 @@ void CPVREpgTagsCache::RefreshLastEndedTag(const CDateTime& activeTime)
 
 void CPVREpgTagsCache::RefreshNextStartingTag(const CDateTime& activeTime)
 {
-  if (m_database)
+  const CDateTime nextStart = m_timelineIndex.GetMinStartTime(activeTime);
+  if (m_database && nextStart.IsValid())
   {
-    m_nextStartingTag = m_database->GetEpgTagByMinStartTime(m_iEpgID, activeTime + ONE_SECOND);
+    m_nextStartingTag = m_database->GetEpgTagByStartTime(m_iEpgID, nextStart);
     if (m_nextStartingTag)
       m_nextStartingTag->SetChannelData(m_channelData);
   }
@@ -18,6 +18,7 @@ namespace PVR
 class CPVREpgChannelData;
 class CPVREpgDatabase;
 class CPVREpgInfoTag;
+class CPVREpgTimelineIndex;
 
 class CPVREpgTagsCache
 {
@@ -26,8 +27,13 @@ public:
   CPVREpgTagsCache(int iEpgID,
                    const std::shared_ptr<CPVREpgChannelData>& channelData,
                    const std::shared_ptr<CPVREpgDatabase>& database,
-                   const std::map<CDateTime, std::shared_ptr<CPVREpgInfoTag>>& changedTags)
-    : m_iEpgID(iEpgID), m_channelData(channelData), m_database(database), m_changedTags(changedTags)
+                   const std::map<CDateTime, std::shared_ptr<CPVREpgInfoTag>>& changedTags,
+                   CPVREpgTimelineIndex& timelineIndex)
+    : m_iEpgID(iEpgID),
+      m_channelData(channelData),
+      m_database(database),
+      m_changedTags(changedTags),
+      m_timelineIndex(timelineIndex)
   {
   }
 
@@ -49,6 +55,7 @@ private:
   std::shared_ptr<CPVREpgChannelData> m_channelData;
   std::shared_ptr<CPVREpgDatabase> m_database;
   const std::map<CDateTime, std::shared_ptr<CPVREpgInfoTag>>& m_changedTags;
+  CPVREpgTimelineIndex& m_timelineIndex;
 
   std::shared_ptr<CPVREpgInfoTag> m_lastEndedTag;
   std::shared_ptr<CPVREpgInfoTag> m_nowActiveTag;
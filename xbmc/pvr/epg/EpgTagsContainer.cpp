@@ -12,6 +12,7 @@
 #include "pvr/epg/EpgDatabase.h"
 #include "pvr/epg/EpgInfoTag.h"
 #include "pvr/epg/EpgTagsCache.h"
+#include "pvr/epg/EpgTimelineIndex.h"
 #include "utils/log.h"
 
 #include <algorithm>
@@ -30,7 +31,9 @@ CPVREpgTagsContainer::CPVREpgTagsContainer(int iEpgID,
   : m_iEpgID(iEpgID),
     m_channelData(channelData),
     m_database(database),
-    m_tagsCache(std::make_unique<CPVREpgTagsCache>(iEpgID, channelData, database, m_changedTags))
+    m_timelineIndex(std::make_unique<CPVREpgTimelineIndex>(iEpgID, database)),
+    m_tagsCache(std::make_unique<CPVREpgTagsCache>(
+        iEpgID, channelData, database, m_changedTags, *m_timelineIndex))
 {
 }
 
@@ -39,6 +42,7 @@ CPVREpgTagsContainer::~CPVREpgTagsContainer() = default;
 void CPVREpgTagsContainer::SetEpgID(int iEpgID)
 {
   m_iEpgID = iEpgID;
+  m_timelineIndex->SetEpgID(iEpgID);
   for (const auto& [_, tag] : m_changedTags)
     tag->SetEpgID(iEpgID);
 }
@@ -141,8 +145,10 @@ bool CPVREpgTagsContainer::UpdateEntries(const CPVREpgTagsContainer& tags)
     const CDateTime minEventEnd = (*tags.m_changedTags.cbegin()).second->StartAsUTC() + ONE_SECOND;
     const CDateTime maxEventStart = (*tags.m_changedTags.crbegin()).second->EndAsUTC();
 
-    std::vector<std::shared_ptr<CPVREpgInfoTag>> existingTags =
-        m_database->GetEpgTagsByMinEndMaxStartTime(m_iEpgID, minEventEnd, maxEventStart);
+    std::vector<std::shared_ptr<CPVREpgInfoTag>> existingTags;
+    if (m_timelineIndex->HasEventsBetween(minEventEnd, maxEventStart))
+      existingTags =
+          m_database->GetEpgTagsByMinEndMaxStartTime(m_iEpgID, minEventEnd, maxEventStart);
 
     if (!m_changedTags.empty())
     {
@@ -318,7 +324,12 @@ void CPVREpgTagsContainer::Cleanup(const CDateTime& time)
   }
 
   if (m_database)
-    m_database->DeleteEpgTags(m_iEpgID, time);
+  {
+    if (m_database->DeleteEpgTags(m_iEpgID, time))
+      m_timelineIndex->EraseEndedBefore(time);
+    else
+      m_timelineIndex->Reset();
+  }
 }
 
 void CPVREpgTagsContainer::Clear()
@@ -333,7 +344,7 @@ bool CPVREpgTagsContainer::IsEmpty() const
     return false;
 
   if (m_database)
-    return !m_database->HasTags(m_iEpgID);
+    return m_timelineIndex->IsEmpty();
 
   return true;
 }
@@ -344,7 +355,7 @@ std::shared_ptr<CPVREpgInfoTag> CPVREpgTagsContainer::GetTag(const CDateTime& st
   if (it != m_changedTags.cend())
     return (*it).second;
 
-  if (m_database)
+  if (m_database && m_timelineIndex->HasEventStartingAt(startTime))
     return CreateEntry(m_database->GetEpgTagByStartTime(m_iEpgID, startTime));
 
   return {};
@@ -399,7 +410,7 @@ std::shared_ptr<CPVREpgInfoTag> CPVREpgTagsContainer::GetTagBetween(const CDateT
     }
   }
 
-  if (m_database)
+  if (m_database && m_timelineIndex->HasEventsWithin(start, end))
   {
     const std::vector<std::shared_ptr<CPVREpgInfoTag>> tags =
         CreateEntries(m_database->GetEpgTagsByMinStartMaxEndTime(m_iEpgID, start, end));
@@ -468,7 +479,7 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetTimeline(
     bool loadFromDb = true;
     if (!m_changedTags.empty())
     {
-      const CDateTime lastEnd = m_database->GetLastEndTime(m_iEpgID);
+      const CDateTime lastEnd = m_timelineIndex->GetLastEndTime();
       if (!lastEnd.IsValid() || lastEnd < minEventEnd)
       {
         // nothing in the db yet. take what we have in memory.
@@ -479,7 +490,9 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetTimeline(
 
     if (loadFromDb)
     {
-      tags = m_database->GetEpgTagsByMinEndMaxStartTime(m_iEpgID, minEventEnd, maxEventStart);
+      // the index knows whether there is anything to load at all
+      if (m_timelineIndex->HasEventsBetween(minEventEnd, maxEventStart))
+        tags = m_database->GetEpgTagsByMinEndMaxStartTime(m_iEpgID, minEventEnd, maxEventStart);
 
       if (!m_changedTags.empty())
       {
@@ -521,11 +534,11 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetTimeline(
     if (result.empty())
     {
       // create single gap tag
-      CDateTime maxEnd = m_database->GetMaxEndTime(m_iEpgID, minEventEnd);
+      CDateTime maxEnd = m_timelineIndex->GetMaxEndTime(minEventEnd);
       if (!maxEnd.IsValid() || maxEnd < timelineStart)
         maxEnd = timelineStart;
 
-      CDateTime minStart = m_database->GetMinStartTime(m_iEpgID, maxEventStart);
+      CDateTime minStart = m_timelineIndex->GetMinStartTime(maxEventStart);
       if (!minStart.IsValid() || minStart > timelineEnd)
         minStart = timelineEnd;
 
@@ -536,7 +549,7 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetTimeline(
       if (result.front()->StartAsUTC() > minEventEnd)
       {
         // prepend gap tag
-        CDateTime maxEnd = m_database->GetMaxEndTime(m_iEpgID, minEventEnd);
+        CDateTime maxEnd = m_timelineIndex->GetMaxEndTime(minEventEnd);
         if (!maxEnd.IsValid() || maxEnd < timelineStart)
           maxEnd = timelineStart;
 
@@ -546,7 +559,7 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetTimeline(
       if (result.back()->EndAsUTC() < maxEventStart)
       {
         // append gap tag
-        CDateTime minStart = m_database->GetMinStartTime(m_iEpgID, maxEventStart);
+        CDateTime minStart = m_timelineIndex->GetMinStartTime(maxEventStart);
         if (!minStart.IsValid() || minStart > timelineEnd)
           minStart = timelineEnd;
 
@@ -565,7 +578,7 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetAllTags()
   if (m_database)
   {
     std::vector<std::shared_ptr<CPVREpgInfoTag>> tags;
-    if (!m_changedTags.empty() && !m_database->HasTags(m_iEpgID))
+    if (!m_changedTags.empty() && m_timelineIndex->IsEmpty())
     {
       // nothing in the db yet. take what we have in memory.
       std::ranges::copy(std::views::values(m_changedTags), std::back_inserter(tags));
@@ -616,7 +629,10 @@ void CPVREpgTagsContainer::QueuePersistQuery()
                 m_changedTags.size(), m_deletedTags.size());
 
     for (const auto& [_, tag] : m_deletedTags)
-      m_database->QueueDeleteTagQuery(*tag);
+    {
+      if (m_database->QueueDeleteTagQuery(*tag))
+        m_timelineIndex->Erase(tag->StartAsUTC());
+    }
 
     m_deletedTags.clear();
 
@@ -629,6 +645,7 @@ void CPVREpgTagsContainer::QueuePersistQuery()
           m_iEpgID, tag->StartAsUTC() + ONE_SECOND, tag->EndAsUTC() - ONE_SECOND);
 
       tag->QueuePersistQuery(m_database);
+      m_timelineIndex->Insert(tag->StartAsUTC(), tag->EndAsUTC());
     }
 
     Clear();
@@ -637,10 +654,18 @@ void CPVREpgTagsContainer::QueuePersistQuery()
   }
 }
 
+void CPVREpgTagsContainer::ResetTimelineIndex()
+{
+  m_timelineIndex->Reset();
+}
+
 void CPVREpgTagsContainer::QueueDelete()
 {
   if (m_database)
+  {
     m_database->QueueDeleteEpgTags(m_iEpgID);
+    m_timelineIndex->Clear();
+  }
 
   Clear();
 }
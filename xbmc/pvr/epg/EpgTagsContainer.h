@@ -17,6 +17,7 @@
 namespace PVR
 {
 class CPVREpgTagsCache;
+class CPVREpgTimelineIndex;
 class CPVREpgChannelData;
 class CPVREpgDatabase;
 class CPVREpgInfoTag;
@@ -174,6 +175,12 @@ public:
    */
   void QueueDelete();
 
+  /*!
+   * @brief Reload the timeline index from the database on next use, for when committing the
+   * queries queued failed and the index got ahead of the database.
+   */
+  void ResetTimelineIndex();
+
 private:
   /*!
    * @brief Complete the instance data for the given tags.
@@ -218,6 +225,7 @@ private:
   int m_iEpgID = 0;
   std::shared_ptr<CPVREpgChannelData> m_channelData;
   const std::shared_ptr<CPVREpgDatabase> m_database;
+  const std::unique_ptr<CPVREpgTimelineIndex> m_timelineIndex;
   const std::unique_ptr<CPVREpgTagsCache> m_tagsCache;
 
   std::map<CDateTime, std::shared_ptr<CPVREpgInfoTag>> m_changedTags;
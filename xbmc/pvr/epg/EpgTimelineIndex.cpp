@@ -0,0 +1,241 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "EpgTimelineIndex.h"
+
+#include "pvr/epg/EpgDatabase.h"
+
+#include <algorithm>
+
+using namespace PVR;
+
+namespace
+{
+time_t ToTime(const CDateTime& dateTime)
+{
+  time_t time{0};
+  dateTime.GetAsTime(time);
+  return time;
+}
+} // unnamed namespace
+
+void CPVREpgTimelineIndex::SetEpgID(int iEpgID)
+{
+  m_iEpgID = iEpgID;
+  Reset();
+}
+
+void CPVREpgTimelineIndex::Reset()
+{
+  m_bLoaded = false;
+  m_starts.clear();
+  m_ends.clear();
+  m_maxEnds.clear();
+}
+
+void CPVREpgTimelineIndex::Clear()
+{
+  Reset();
+  m_bLoaded = true;
+}
+
+void CPVREpgTimelineIndex::Load()
+{
+  if (m_bLoaded)
+    return;
+
+  m_bLoaded = true;
+  if (!m_database || m_iEpgID <= 0)
+    return;
+
+  // sorted by start time
+  const std::vector<std::pair<time_t, time_t>> times = m_database->GetEpgTagTimes(m_iEpgID);
+  m_starts.reserve(times.size());
+  m_ends.reserve(times.size());
+  for (const auto& [start, end] : times)
+  {
+    m_starts.emplace_back(start);
+    m_ends.emplace_back(end);
+  }
+  UpdateMaxEnds(0);
+}
+
+void CPVREpgTimelineIndex::UpdateMaxEnds(size_t from)
+{
+  m_maxEnds.resize(m_ends.size());
+  for (size_t i = from; i < m_ends.size(); ++i)
+    m_maxEnds[i] = i > 0 ? std::max(m_maxEnds[i - 1], m_ends[i]) : m_ends[i];
+}
+
+void CPVREpgTimelineIndex::Insert(const CDateTime& start, const CDateTime& end)
+{
+  // not loaded yet, the event will be read from the database with all others
+  if (!m_bLoaded)
+    return;
+
+  const time_t s = ToTime(start);
+  const time_t e = ToTime(end);
+
+  // only events starting before the end and ending after the start can overlap
+  const auto hi = static_cast<size_t>(
+      std::distance(m_starts.begin(), std::lower_bound(m_starts.begin(), m_starts.end(), e)));
+  const auto lo = static_cast<size_t>(std::min(
+      std::distance(m_maxEnds.begin(),
+                    std::upper_bound(m_maxEnds.begin(), m_maxEnds.begin() + hi, s)),
+      std::distance(m_starts.begin(),
+                    std::lower_bound(m_starts.begin(), m_starts.begin() + hi, s))));
+
+  size_t out = lo;
+  for (size_t i = lo; i < hi; ++i)
+  {
+    const bool overlapped = m_starts[i] == s || (m_ends[i] > s && m_starts[i] < e);
+    if (!overlapped)
+    {
+      m_starts[out] = m_starts[i];
+      m_ends[out] = m_ends[i];
+      ++out;
+    }
+  }
+  m_starts.erase(m_starts.begin() + out, m_starts.begin() + hi);
+  m_ends.erase(m_ends.begin() + out, m_ends.begin() + hi);
+
+  const auto pos = std::distance(
+      m_starts.begin(), std::upper_bound(m_starts.begin() + lo, m_starts.begin() + out, s));
+  m_starts.insert(m_starts.begin() + pos, s);
+  m_ends.insert(m_ends.begin() + pos, e);
+  UpdateMaxEnds(lo);
+}
+
+void CPVREpgTimelineIndex::Erase(const CDateTime& start)
+{
+  if (!m_bLoaded)
+    return;
+
+  const time_t s = ToTime(start);
+  const auto it = std::lower_bound(m_starts.begin(), m_starts.end(), s);
+  if (it == m_starts.end() || *it != s)
+    return;
+
+  const auto pos = std::distance(m_starts.begin(), it);
+  m_starts.erase(it);
+  m_ends.erase(m_ends.begin() + pos);
+  UpdateMaxEnds(static_cast<size_t>(pos));
+}
+
+void CPVREpgTimelineIndex::EraseEndedBefore(const CDateTime& time)
+{
+  if (!m_bLoaded)
+    return;
+
+  const time_t t = ToTime(time);
+  size_t out = 0;
+  for (size_t i = 0; i < m_starts.size(); ++i)
+  {
+    if (m_ends[i] >= t)
+    {
+      m_starts[out] = m_starts[i];
+      m_ends[out] = m_ends[i];
+      ++out;
+    }
+  }
+  m_starts.resize(out);
+  m_ends.resize(out);
+  UpdateMaxEnds(0);
+}
+
+bool CPVREpgTimelineIndex::IsEmpty()
+{
+  Load();
+  return m_starts.empty();
+}
+
+bool CPVREpgTimelineIndex::HasEventsBetween(const CDateTime& minEnd, const CDateTime& maxStart)
+{
+  Load();
+
+  // candidates start not after maxStart. the first of them whose running maximum of the end times
+  // reaches minEnd ends not before minEnd itself.
+  const auto hi = std::upper_bound(m_starts.begin(), m_starts.end(), ToTime(maxStart));
+  const auto maxEndsHi = m_maxEnds.begin() + std::distance(m_starts.begin(), hi);
+  return std::lower_bound(m_maxEnds.begin(), maxEndsHi, ToTime(minEnd)) != maxEndsHi;
+}
+
+bool CPVREpgTimelineIndex::HasEventsWithin(const CDateTime& minStart, const CDateTime& maxEnd)
+{
+  Load();
+
+  const time_t e = ToTime(maxEnd);
+  for (auto i = static_cast<size_t>(
+           std::distance(m_starts.begin(),
+                         std::lower_bound(m_starts.begin(), m_starts.end(), ToTime(minStart))));
+       i < m_starts.size() && m_starts[i] < e; ++i)
+  {
+    if (m_ends[i] <= e)
+      return true;
+  }
+  return false;
+}
+
+bool CPVREpgTimelineIndex::HasEventStartingAt(const CDateTime& start)
+{
+  Load();
+  return std::binary_search(m_starts.begin(), m_starts.end(), ToTime(start));
+}
+
+bool CPVREpgTimelineIndex::HasEventAt(const CDateTime& time)
+{
+  return HasEventsBetween(time + CDateTimeSpan(0, 0, 0, 1), time);
+}
+
+CDateTime CPVREpgTimelineIndex::GetLastEndTime()
+{
+  Load();
+
+  if (m_maxEnds.empty())
+    return {};
+
+  return CDateTime(m_maxEnds.back());
+}
+
+CDateTime CPVREpgTimelineIndex::GetMaxEndTime(const CDateTime& maxEnd)
+{
+  Load();
+
+  // all events before the first running maximum exceeding maxEnd end in time, the events after it
+  // can only end in time if they start before maxEnd
+  const time_t e = ToTime(maxEnd);
+  auto i = static_cast<size_t>(std::distance(
+      m_maxEnds.begin(), std::upper_bound(m_maxEnds.begin(), m_maxEnds.end(), e)));
+
+  time_t result = i > 0 ? m_maxEnds[i - 1] : 0;
+  bool found = i > 0;
+  for (; i < m_starts.size() && m_starts[i] < e; ++i)
+  {
+    if (m_ends[i] <= e && (!found || m_ends[i] > result))
+    {
+      result = m_ends[i];
+      found = true;
+    }
+  }
+
+  if (!found)
+    return {};
+
+  return CDateTime(result);
+}
+
+CDateTime CPVREpgTimelineIndex::GetMinStartTime(const CDateTime& minStart)
+{
+  Load();
+
+  const auto it = std::upper_bound(m_starts.begin(), m_starts.end(), ToTime(minStart));
+  if (it == m_starts.end())
+    return {};
+
+  return CDateTime(*it);
+}
@@ -0,0 +1,143 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "XBDateTime.h"
+
+#include <ctime>
+#include <memory>
+#include <vector>
+
+namespace PVR
+{
+class CPVREpgDatabase;
+
+/*!
+ * @brief In-memory index of the start and end times of the persisted events of one EPG.
+ *
+ * The times are kept in flat arrays sorted by start time and are searched with binary searches,
+ * so that the timeline lookups of the guide can be answered without querying the database. The
+ * database is only asked for the events themselves, once the index knows that there are any.
+ * The index is loaded on first use and must be kept in sync with every change persisted to the
+ * database.
+ */
+class CPVREpgTimelineIndex
+{
+public:
+  CPVREpgTimelineIndex() = delete;
+  CPVREpgTimelineIndex(int iEpgID, const std::shared_ptr<CPVREpgDatabase>& database)
+    : m_iEpgID(iEpgID), m_database(database)
+  {
+  }
+
+  /*!
+   * @brief Set the EPG id, the index gets reloaded on next use.
+   * @param iEpgID The ID.
+   */
+  void SetEpgID(int iEpgID);
+
+  /*!
+   * @brief Forget the loaded times, the index gets reloaded on next use.
+   */
+  void Reset();
+
+  /*!
+   * @brief Remove all events, for when all events of the EPG were deleted from the database.
+   */
+  void Clear();
+
+  /*!
+   * @brief Add an event, removing all events it overlaps, like persisting it does.
+   * @param start The start time of the event.
+   * @param end The end time of the event.
+   */
+  void Insert(const CDateTime& start, const CDateTime& end);
+
+  /*!
+   * @brief Remove the event starting at the given time.
+   * @param start The start time of the event.
+   */
+  void Erase(const CDateTime& start);
+
+  /*!
+   * @brief Remove all events which ended before the given time.
+   * @param time The time.
+   */
+  void EraseEndedBefore(const CDateTime& time);
+
+  /*!
+   * @brief Check whether the index contains any event.
+   * @return True if there is no event, false otherwise.
+   */
+  bool IsEmpty();
+
+  /*!
+   * @brief Check for events with end >= minEnd and start <= maxStart.
+   * @param minEnd The minimum end time.
+   * @param maxStart The maximum start time.
+   * @return True if there is at least one such event, false otherwise.
+   */
+  bool HasEventsBetween(const CDateTime& minEnd, const CDateTime& maxStart);
+
+  /*!
+   * @brief Check for events with start >= minStart and end <= maxEnd.
+   * @param minStart The minimum start time.
+   * @param maxEnd The maximum end time.
+   * @return True if there is at least one such event, false otherwise.
+   */
+  bool HasEventsWithin(const CDateTime& minStart, const CDateTime& maxEnd);
+
+  /*!
+   * @brief Check for an event starting at the given time.
+   * @param start The start time.
+   * @return True if there is such an event, false otherwise.
+   */
+  bool HasEventStartingAt(const CDateTime& start);
+
+  /*!
+   * @brief Check for an event with start <= time < end.
+   * @param time The time.
+   * @return True if there is such an event, false otherwise.
+   */
+  bool HasEventAt(const CDateTime& time);
+
+  /*!
+   * @brief Get the end time of the last event.
+   * @return The time or an invalid time if there is no event.
+   */
+  CDateTime GetLastEndTime();
+
+  /*!
+   * @brief Get the latest end time not after the given time.
+   * @param maxEnd The maximum end time.
+   * @return The time or an invalid time if there is no such event.
+   */
+  CDateTime GetMaxEndTime(const CDateTime& maxEnd);
+
+  /*!
+   * @brief Get the earliest start time after the given time.
+   * @param minStart The start time must be after this time.
+   * @return The time or an invalid time if there is no such event.
+   */
+  CDateTime GetMinStartTime(const CDateTime& minStart);
+
+private:
+  void Load();
+  void UpdateMaxEnds(size_t from);
+
+  int m_iEpgID;
+  std::shared_ptr<CPVREpgDatabase> m_database;
+
+  bool m_bLoaded{false};
+  std::vector<time_t> m_starts; //!< sorted ascending
+  std::vector<time_t> m_ends; //!< end of the event at the same position in m_starts
+  std::vector<time_t> m_maxEnds; //!< running maximum of m_ends, for binary searches by end time
+};
+
+} // namespace PVR
@@ -0,0 +1,235 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "dbwrappers/dataset.h"
+#include "filesystem/File.h"
+#include "filesystem/SpecialProtocol.h"
+#include "pvr/epg/EpgDatabase.h"
+#include "pvr/epg/EpgInfoTag.h"
+#include "pvr/epg/EpgSearchData.h"
+#include "settings/AdvancedSettings.h"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace PVR;
+
+namespace
+{
+const std::string DATABASE_NAME = "TestEpg.db";
+constexpr int EPG_ID = 1;
+
+class CTestEpgDatabase : public CPVREpgDatabase
+{
+public:
+  void Insert(unsigned int iBroadcastUid,
+              const std::string& strTitle,
+              const std::string& strPlotOutline = "",
+              const std::string& strPlot = "",
+              const std::string& strEpisodeName = "",
+              const std::string& strGenre = "")
+  {
+    Execute("INSERT", iBroadcastUid, strTitle, strPlotOutline, strPlot, strEpisodeName, strGenre);
+  }
+
+  void Replace(unsigned int iBroadcastUid, const std::string& strTitle)
+  {
+    Execute("REPLACE", iBroadcastUid, strTitle, "", "", "", "");
+  }
+
+  void SetTitle(unsigned int iBroadcastUid, const std::string& strTitle)
+  {
+    m_pDS->exec(PrepareSQL("UPDATE epgtags SET sTitle = '%s' WHERE iBroadcastUid = %u",
+                           strTitle.c_str(), iBroadcastUid));
+  }
+
+  bool IsSearchIndexConsistent()
+  {
+    try
+    {
+      // compares the index with the texts of epgtags
+      m_pDS->exec("INSERT INTO epgtags_fts (epgtags_fts, rank) VALUES ('integrity-check', 1)");
+      return true;
+    }
+    catch (...)
+    {
+      return false;
+    }
+  }
+
+  void DropSearchIndex()
+  {
+    m_pDS->exec("DROP TRIGGER epgtags_fts_insert");
+    m_pDS->exec("DROP TRIGGER epgtags_fts_update");
+    m_pDS->exec("DROP TRIGGER epgtags_fts_delete");
+    m_pDS->exec("DROP TABLE epgtags_fts");
+  }
+
+private:
+  void Execute(const std::string& strStatement,
+               unsigned int iBroadcastUid,
+               const std::string& strTitle,
+               const std::string& strPlotOutline,
+               const std::string& strPlot,
+               const std::string& strEpisodeName,
+               const std::string& strGenre)
+  {
+    // the broadcast uid doubles as start time, (idEpg, iStartTime) being the unique key
+    m_pDS->exec(PrepareSQL(strStatement +
+                               " INTO epgtags (idEpg, iBroadcastUid, iStartTime, iEndTime, sTitle, "
+                               "sPlotOutline, sPlot, sEpisodeName, sGenre) "
+                               "VALUES (%i, %u, %u, %u, '%s', '%s', '%s', '%s', '%s')",
+                           EPG_ID, iBroadcastUid, iBroadcastUid, iBroadcastUid + 1,
+                           strTitle.c_str(), strPlotOutline.c_str(), strPlot.c_str(),
+                           strEpisodeName.c_str(), strGenre.c_str()));
+  }
+};
+} // unnamed namespace
+
+class TestEpgDatabase : public ::testing::Test
+{
+protected:
+  DatabaseSettings settings;
+  CTestEpgDatabase database;
+
+  void SetUp() override
+  {
+    settings.type = "sqlite3";
+    settings.host = CSpecialProtocol::TranslatePath("special://temp/");
+    XFILE::CFile::Delete("special://temp/" + DATABASE_NAME);
+
+    ASSERT_EQ(CDatabase::ConnectionState::STATE_CONNECTED,
+              database.Connect(DATABASE_NAME, settings, true));
+    // already connected, only detects the search index
+    ASSERT_TRUE(database.Open());
+    ASSERT_TRUE(database.IsSearchIndexConsistent());
+  }
+
+  void TearDown() override
+  {
+    database.Close();
+    database.Close();
+    XFILE::CFile::Delete("special://temp/" + DATABASE_NAME);
+  }
+
+  void WithoutSearchIndex()
+  {
+    database.DropSearchIndex();
+    database.Close();
+    ASSERT_TRUE(database.Open());
+  }
+
+  std::vector<unsigned int> Search(const std::string& strSearchTerm,
+                                   bool bSearchInDescription = false)
+  {
+    PVREpgSearchData searchData;
+    searchData.Reset();
+    searchData.m_bIgnoreFinishedBroadcasts = false;
+    searchData.m_strSearchTerm = strSearchTerm;
+    searchData.m_bSearchInDescription = bSearchInDescription;
+
+    std::vector<unsigned int> uids;
+    for (const auto& tag : database.GetEpgTags(searchData))
+      uids.emplace_back(tag->UniqueBroadcastID());
+
+    std::ranges::sort(uids);
+    return uids;
+  }
+};
+
+using UIDs = std::vector<unsigned int>;
+
+TEST_F(TestEpgDatabase, InsertTrigger)
+{
+  database.Insert(100, "Evening News", "", "The day's headlines");
+
+  EXPECT_EQ(UIDs({100}), Search("news"));
+  EXPECT_EQ(UIDs(), Search("headlines"));
+  EXPECT_EQ(UIDs({100}), Search("headlines", true));
+  EXPECT_TRUE(database.IsSearchIndexConsistent());
+}
+
+TEST_F(TestEpgDatabase, UpdateTrigger)
+{
+  database.Insert(100, "Evening News");
+  database.SetTitle(100, "Morning Show");
+
+  EXPECT_EQ(UIDs(), Search("news"));
+  EXPECT_EQ(UIDs({100}), Search("morning"));
+  EXPECT_TRUE(database.IsSearchIndexConsistent());
+}
+
+TEST_F(TestEpgDatabase, ReplaceTrigger)
+{
+  database.Insert(100, "Evening News");
+  // same start time, the old row is deleted
+  database.Replace(100, "Morning Show");
+
+  EXPECT_EQ(UIDs(), Search("news"));
+  EXPECT_EQ(UIDs({100}), Search("morning"));
+  EXPECT_TRUE(database.IsSearchIndexConsistent());
+}
+
+TEST_F(TestEpgDatabase, DeleteTrigger)
+{
+  database.Insert(100, "Evening News");
+  database.Insert(200, "Late News");
+  ASSERT_EQ(UIDs({100, 200}), Search("news"));
+
+  EXPECT_TRUE(database.DeleteEpgTags(EPG_ID));
+
+  EXPECT_EQ(UIDs(), Search("news"));
+  EXPECT_TRUE(database.IsSearchIndexConsistent());
+}
+
+TEST_F(TestEpgDatabase, SameResultsWithoutSearchIndex)
+{
+  database.Insert(100, "Evening News", "Headlines", "The day's news in detail", "", "News");
+  database.Insert(200, "Late Show", "Talk with guests", "", "It's a King's life", "Show");
+  database.Insert(300, "Tennis", "", "Live from Wimbledon", "Final", "Sport");
+  database.Insert(400, "Sport News", "Results", "", "", "Sport");
+  database.Insert(500, "TV Shop", "", "Gadgets", "", "");
+  database.Insert(600, "Die K\xC3\xBC" "che", "Kochen", "", "", "");
+  database.Insert(700, "Quiz", "Say \"cheese\"", "", "", "Show");
+
+  const std::vector<std::string> searchTerms{"news",
+                                             "NEWS",
+                                             "show",
+                                             "ng's",
+                                             "king's",
+                                             "\"late show\"",
+                                             "\"king's life\"",
+                                             "say \"cheese",
+                                             "k\xC3\xBC" "che",
+                                             "tv",
+                                             "tv shop",
+                                             "news + ! sport",
+                                             "news and sport",
+                                             "tennis | quiz",
+                                             "! news",
+                                             "xyz"};
+
+  std::vector<std::pair<UIDs, UIDs>> indexed;
+  for (const auto& searchTerm : searchTerms)
+    indexed.emplace_back(Search(searchTerm), Search(searchTerm, true));
+
+  ASSERT_EQ(UIDs({200}), indexed[2].first);
+  ASSERT_EQ(UIDs({200, 700}), indexed[2].second);
+
+  WithoutSearchIndex();
+
+  for (size_t i = 0; i < searchTerms.size(); ++i)
+  {
+    EXPECT_EQ(indexed[i].first, Search(searchTerms[i])) << searchTerms[i];
+    EXPECT_EQ(indexed[i].second, Search(searchTerms[i], true)) << searchTerms[i];
+  }
+}
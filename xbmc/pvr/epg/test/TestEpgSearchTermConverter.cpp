@@ -0,0 +1,93 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "pvr/epg/EpgSearchTermConverter.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace PVR;
+
+namespace
+{
+std::string Like(const std::string& pattern)
+{
+  return "(UPPER(sTitle) LIKE UPPER('%" + pattern + "%'))";
+}
+
+std::string Match(const std::string& phrase)
+{
+  return "(idBroadcast IN (SELECT rowid FROM epgtags_fts WHERE epgtags_fts MATCH 'sTitle : \"" +
+         phrase + "\"'))";
+}
+
+std::string ToSQL(const std::string& searchTerm, bool bUseSearchIndex)
+{
+  return CPVREpgSearchTermConverter(searchTerm).ToSQL("sTitle", bUseSearchIndex);
+}
+} // unnamed namespace
+
+TEST(TestEpgSearchTermConverter, Empty)
+{
+  EXPECT_FALSE(CPVREpgSearchTermConverter("").HasSearchTerm());
+  EXPECT_FALSE(CPVREpgSearchTermConverter("   ").HasSearchTerm());
+  EXPECT_TRUE(CPVREpgSearchTermConverter("news").HasSearchTerm());
+}
+
+TEST(TestEpgSearchTermConverter, Phrase)
+{
+  EXPECT_EQ("(" + Match("news") + ")", ToSQL("news", true));
+  EXPECT_EQ("(" + Like("news") + ")", ToSQL("news", false));
+
+  // a quoted phrase is a single term
+  EXPECT_EQ("(" + Match("the late show") + ")", ToSQL("\"the late show\"", true));
+  EXPECT_EQ("(" + Like("the late show") + ")", ToSQL("\"the late show\"", false));
+}
+
+TEST(TestEpgSearchTermConverter, QuotesEscaped)
+{
+  // ' ends the SQL string, " the fts5 phrase
+  EXPECT_EQ("(" + Match("it''s") + ")", ToSQL("it's", true));
+  EXPECT_EQ("(" + Like("it''s") + ")", ToSQL("it's", false));
+  EXPECT_EQ("(" + Match("say\"\"cheese") + ")", ToSQL("say\"cheese", true));
+  EXPECT_EQ("(" + Match("the king''s speech") + ")", ToSQL("\"the king's speech\"", true));
+}
+
+TEST(TestEpgSearchTermConverter, ShortTermsUseLike)
+{
+  // the trigram index has no token for less than three characters
+  EXPECT_EQ("(" + Like("tv") + ")", ToSQL("tv", true));
+  EXPECT_EQ("(" + Match("abc") + ")", ToSQL("abc", true));
+
+  // characters are counted, not bytes
+  EXPECT_EQ("(" + Like("\xC3\xA4\xC3\xB6") + ")", ToSQL("\xC3\xA4\xC3\xB6", true));
+  EXPECT_EQ("(" + Match("\xC3\xA4\xC3\xB6\xC3\xBC") + ")", ToSQL("\xC3\xA4\xC3\xB6\xC3\xBC", true));
+
+  // each term decides on its own
+  EXPECT_EQ("(" + Match("news") + "  OR " + Like("at") + ")", ToSQL("news at", true));
+}
+
+TEST(TestEpgSearchTermConverter, Operators)
+{
+  // terms without operator are combined with OR
+  EXPECT_EQ("(" + Match("news") + "  OR " + Match("sport") + ")", ToSQL("news sport", true));
+
+  EXPECT_EQ("(" + Match("news") + "  AND " + Match("sport") + ")", ToSQL("news + sport", true));
+  EXPECT_EQ("(" + Match("news") + "  AND " + Match("sport") + ")", ToSQL("news and sport", true));
+  EXPECT_EQ("(" + Match("news") + "  OR " + Match("sport") + ")", ToSQL("news | sport", true));
+  EXPECT_EQ("(" + Match("news") + "  OR " + Match("sport") + ")", ToSQL("news OR sport", true));
+
+  // operators are separate words; NOT precedes the term it negates
+  EXPECT_EQ("( NOT " + Match("news") + ")", ToSQL("! news", true));
+  EXPECT_EQ("( NOT " + Match("news") + ")", ToSQL("not news", true));
+  EXPECT_EQ("(" + Match("news") + "  AND  NOT " + Match("sport") + ")",
+            ToSQL("news + ! sport", true));
+  EXPECT_EQ("(" + Like("news") + "  AND  NOT " + Like("sport") + ")",
+            ToSQL("news + ! sport", false));
+}
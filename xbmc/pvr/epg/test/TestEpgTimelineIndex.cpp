@@ -0,0 +1,107 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "XBDateTime.h"
+#include "pvr/epg/EpgTimelineIndex.h"
+
+#include <gtest/gtest.h>
+
+using namespace PVR;
+
+namespace
+{
+CDateTime At(int minutes)
+{
+  return CDateTime(static_cast<time_t>(1700000000 + minutes * 60));
+}
+
+class TestEpgTimelineIndex : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    // no database, start out with an empty timeline
+    index.Clear();
+    index.Insert(At(0), At(30));
+    index.Insert(At(30), At(60));
+    index.Insert(At(90), At(120));
+  }
+
+  CPVREpgTimelineIndex index{1, nullptr};
+};
+} // unnamed namespace
+
+TEST_F(TestEpgTimelineIndex, Empty)
+{
+  CPVREpgTimelineIndex empty{1, nullptr};
+  EXPECT_TRUE(empty.IsEmpty());
+  EXPECT_FALSE(empty.HasEventsBetween(At(0), At(100)));
+  EXPECT_FALSE(empty.GetLastEndTime().IsValid());
+  EXPECT_FALSE(index.IsEmpty());
+}
+
+TEST_F(TestEpgTimelineIndex, HasEventsBetween)
+{
+  EXPECT_TRUE(index.HasEventsBetween(At(10), At(20)));
+  EXPECT_TRUE(index.HasEventsBetween(At(60), At(70)));
+  EXPECT_FALSE(index.HasEventsBetween(At(61), At(89)));
+  EXPECT_TRUE(index.HasEventsBetween(At(61), At(90)));
+  EXPECT_FALSE(index.HasEventsBetween(At(121), At(200)));
+}
+
+TEST_F(TestEpgTimelineIndex, HasEventsWithin)
+{
+  EXPECT_TRUE(index.HasEventsWithin(At(0), At(30)));
+  EXPECT_FALSE(index.HasEventsWithin(At(10), At(50)));
+  EXPECT_TRUE(index.HasEventsWithin(At(10), At(60)));
+}
+
+TEST_F(TestEpgTimelineIndex, HasEventAt)
+{
+  EXPECT_TRUE(index.HasEventAt(At(0)));
+  EXPECT_TRUE(index.HasEventAt(At(59)));
+  EXPECT_FALSE(index.HasEventAt(At(60)));
+  EXPECT_FALSE(index.HasEventAt(At(75)));
+  EXPECT_TRUE(index.HasEventStartingAt(At(90)));
+  EXPECT_FALSE(index.HasEventStartingAt(At(91)));
+}
+
+TEST_F(TestEpgTimelineIndex, Bounds)
+{
+  EXPECT_EQ(index.GetLastEndTime(), At(120));
+  EXPECT_EQ(index.GetMaxEndTime(At(75)), At(60));
+  EXPECT_EQ(index.GetMaxEndTime(At(60)), At(60));
+  EXPECT_FALSE(index.GetMaxEndTime(At(29)).IsValid());
+  EXPECT_EQ(index.GetMinStartTime(At(30)), At(90));
+  EXPECT_FALSE(index.GetMinStartTime(At(90)).IsValid());
+}
+
+TEST_F(TestEpgTimelineIndex, InsertReplacesOverlapped)
+{
+  index.Insert(At(20), At(100));
+  EXPECT_FALSE(index.HasEventStartingAt(At(0)));
+  EXPECT_TRUE(index.HasEventStartingAt(At(20)));
+  EXPECT_FALSE(index.HasEventStartingAt(At(30)));
+  EXPECT_FALSE(index.HasEventStartingAt(At(90)));
+  EXPECT_EQ(index.GetLastEndTime(), At(100));
+
+  index.Insert(At(100), At(130));
+  EXPECT_TRUE(index.HasEventStartingAt(At(20)));
+  EXPECT_EQ(index.GetMaxEndTime(At(110)), At(100));
+}
+
+TEST_F(TestEpgTimelineIndex, Erase)
+{
+  index.Erase(At(30));
+  EXPECT_FALSE(index.HasEventAt(At(45)));
+  EXPECT_EQ(index.GetMaxEndTime(At(89)), At(30));
+
+  index.EraseEndedBefore(At(100));
+  EXPECT_FALSE(index.HasEventStartingAt(At(0)));
+  EXPECT_TRUE(index.HasEventStartingAt(At(90)));
+}
@@ -777,10 +777,12 @@ std::vector<std::shared_ptr<CPVRChannelGroupMember>> GetChannelGroupMembers(
     {
       std::vector<std::shared_ptr<CPVRChannelGroupMember>> result;
 
-      const std::vector<std::shared_ptr<CPVRChannelGroupMember>> allGroupMembers{
-          group->GetMembers(CPVRChannelGroup::Include::ONLY_VISIBLE)};
-      for (const auto& allGroupMember : allGroupMembers)
+      const auto allGroupMembers{group->GetMembersSnapshot()};
+      for (const auto& allGroupMember : allGroupMembers->sorted)
       {
+        if (allGroupMember->Channel()->IsHidden())
+          continue;
+
         std::shared_ptr<CPVRChannelGroupMember> member{
             GetLastWatchedChannelGroupMember(allGroupMember->Channel())};
         if (member)
@@ -1070,13 +1072,12 @@ bool CPVRGUIDirectory::GetProvidersDirectory(CFileItemList& results) const
       if (group)
       {
         const bool checkUid{path.GetProviderUid() != PVR_PROVIDER_INVALID_UID};
-        const std::vector<std::shared_ptr<CPVRChannelGroupMember>> allGroupMembers{
-            group->GetMembers(CPVRChannelGroup::Include::ONLY_VISIBLE)};
-        for (const auto& allGroupMember : allGroupMembers)
+        const auto allGroupMembers{group->GetMembersSnapshot()};
+        for (const auto& allGroupMember : allGroupMembers->sorted)
         {
           const std::shared_ptr<const CPVRChannel> channel{allGroupMember->Channel()};
 
-          if (channel->ClientID() != path.GetClientId())
+          if (channel->IsHidden() || channel->ClientID() != path.GetClientId())
             continue;
 
           if (checkUid && channel->ClientProviderUid() != path.GetProviderUid())
@@ -41,7 +41,31 @@ void CGUIEPGGridContainerModel::SetInvalid() const
   for (const auto& channel : m_channelItems)
     channel->SetInvalid();
   for (const auto& ruler : m_rulerItems)
-    ruler->SetInvalid();
+  {
+    if (ruler)
+      ruler->SetInvalid();
+  }
+}
+
+std::shared_ptr<CFileItem> CGUIEPGGridContainerModel::GetRulerItem(int iIndex) const
+{
+  std::shared_ptr<CFileItem>& rulerItem = m_rulerItems[iIndex];
+  if (!rulerItem)
+  {
+    if (iIndex == 0)
+    {
+      rulerItem = std::make_shared<CFileItem>(m_rulerStart.GetAsLocalizedDate(true));
+      rulerItem->SetProperty("DateLabel", true);
+    }
+    else
+    {
+      const CDateTime ruler =
+          m_rulerStart + CDateTimeSpan(0, 0, (iIndex - 1) * m_minutesPerRulerItem, 0);
+      rulerItem = std::make_shared<CFileItem>(ruler.GetAsLocalizedTime("", false));
+      rulerItem->SetLabel2(ruler.GetAsLocalizedDate(true));
+    }
+  }
+  return rulerItem;
 }
 
 std::shared_ptr<CFileItem> CGUIEPGGridContainerModel::CreateGapItem(int iChannel) const
@@ -127,22 +151,20 @@ void CGUIEPGGridContainerModel::Initialize(const CFileItemList& items,
   }
 
   ////////////////////////////////////////////////////////////////////////
-  // Create ruler items
-  CDateTime ruler;
-  ruler.SetFromUTCDateTime(m_gridStart);
+  // Size ruler items. They get created on demand, only the visible ones are kept.
+  m_rulerStart.SetFromUTCDateTime(m_gridStart);
   CDateTime rulerEnd;
   rulerEnd.SetFromUTCDateTime(m_gridEnd);
-  auto rulerItem{std::make_shared<CFileItem>(ruler.GetAsLocalizedDate(true))};
-  rulerItem->SetProperty("DateLabel", true);
-  m_rulerItems.emplace_back(rulerItem);
+  m_minutesPerRulerItem = blocksPerRulerItem * static_cast<int>(m_minutesPerBlock);
 
-  const CDateTimeSpan unit(0, 0, blocksPerRulerItem * m_minutesPerBlock, 0);
-  for (; ruler < rulerEnd; ruler += unit)
+  int rulerItems = 1; // date label
+  if (m_rulerStart < rulerEnd && m_minutesPerRulerItem > 0)
   {
-    rulerItem = std::make_shared<CFileItem>(ruler.GetAsLocalizedTime("", false));
-    rulerItem->SetLabel2(ruler.GetAsLocalizedDate(true));
-    m_rulerItems.emplace_back(rulerItem);
+    const int secondsTotal = (rulerEnd - m_rulerStart).GetSecondsTotal();
+    const int secondsPerItem = m_minutesPerRulerItem * 60;
+    rulerItems += (secondsTotal + secondsPerItem - 1) / secondsPerItem;
   }
+  m_rulerItems.resize(rulerItems);
 
   m_firstActiveChannel = iFirstChannel;
   m_lastActiveChannel = iFirstChannel + iChannelsPerPage - 1;
@@ -515,62 +537,63 @@ bool CGUIEPGGridContainerModel::FreeProgrammeMemory(int firstChannel,
   if (!channelsChanged && !blocksChanged)
     return false;
 
-  // clear the grid. it will be recreated on-demand.
-  m_gridIndex.clear();
-
-  bool newChannels = false;
-
-  if (channelsChanged)
+  // purge epg tags for inactive channels and epg tags outside the active blocks
+  for (auto it = m_epgItems.begin(); it != m_epgItems.end();)
   {
-    // purge epg tags for inactive channels
-    for (auto it = m_epgItems.begin(); it != m_epgItems.end();)
+    if ((*it).first < firstChannel || (*it).first > lastChannel ||
+        !TrimEpgTags((*it).second, firstBlock, lastBlock))
     {
-      if ((*it).first < firstChannel || (*it).first > lastChannel)
-      {
-        it = m_epgItems.erase(it);
-        continue; // next channel
-      }
-      ++it;
+      it = m_epgItems.erase(it);
+      continue; // next channel
     }
-
-    newChannels = (firstChannel < m_firstActiveChannel) || (lastChannel > m_lastActiveChannel);
+    ++it;
   }
 
-  if (blocksChanged || newChannels)
+  // purge grid items outside the viewport. the others still refer to the remaining epg tags.
+  std::erase_if(m_gridIndex,
+                [this, firstChannel, lastChannel, firstBlock, lastBlock](const auto& gridItem)
+                {
+                  const GridCoordinates& coordinates = gridItem.first;
+                  return coordinates.channel < firstChannel || coordinates.channel > lastChannel ||
+                         coordinates.block < firstBlock || coordinates.block > lastBlock ||
+                         !m_epgItems.contains(coordinates.channel);
+                });
+
+  // fetch epg tags for active channels, only for the blocks not already present
+  const CDateTime maxEnd = GetStartTimeForBlock(firstBlock);
+  const CDateTime minStart = GetStartTimeForBlock(lastBlock);
+  for (int i = firstChannel; i <= lastChannel; ++i)
   {
-    // clear and refetch epg tags for active channels
-    const CDateTime maxEnd = GetStartTimeForBlock(firstBlock);
-    const CDateTime minStart = GetStartTimeForBlock(lastBlock);
-    std::vector<std::shared_ptr<CPVREpgInfoTag>> tags;
-    for (int i = firstChannel; i <= lastChannel; ++i)
+    const auto it = m_epgItems.find(i);
+    if (it != m_epgItems.end())
     {
-      auto it = m_epgItems.find(i);
-      if (it == m_epgItems.end())
-        it = m_epgItems.try_emplace(i).first;
+      EpgTags& epgTags = (*it).second;
 
-      if (blocksChanged || i < m_firstActiveChannel || i > m_lastActiveChannel)
-      {
-        EpgTags& epgTags = (*it).second;
+      if (firstBlock < epgTags.firstBlock)
+        GetEpgTagsBefore(epgTags, i, firstBlock);
 
-        (*it).second.tags.clear();
+      if (lastBlock > epgTags.lastBlock)
+        GetEpgTagsAfter(epgTags, i, lastBlock);
 
-        tags = GetEPGTimeline(i, maxEnd, minStart);
-        const int firstResultBlock = GetFirstEventBlock(tags.front());
-        const int lastResultBlock = GetLastEventBlock(tags.back());
-        if (firstResultBlock > lastResultBlock)
-          continue;
+      continue; // next channel
+    }
 
-        epgTags.firstBlock = firstResultBlock;
-        epgTags.lastBlock = lastResultBlock;
+    const std::vector<std::shared_ptr<CPVREpgInfoTag>> tags = GetEPGTimeline(i, maxEnd, minStart);
+    const int firstResultBlock = GetFirstEventBlock(tags.front());
+    const int lastResultBlock = GetLastEventBlock(tags.back());
+    if (firstResultBlock > lastResultBlock)
+      continue;
 
-        for (const auto& tag : tags)
-        {
-          if (GetFirstEventBlock(tag) > GetLastEventBlock(tag))
-            continue;
+    EpgTags& epgTags = m_epgItems[i];
+    epgTags.firstBlock = firstResultBlock;
+    epgTags.lastBlock = lastResultBlock;
 
-          epgTags.tags.emplace_back(std::make_shared<CFileItem>(tag));
-        }
-      }
+    for (const auto& tag : tags)
+    {
+      if (GetFirstEventBlock(tag) > GetLastEventBlock(tag))
+        continue;
+
+      epgTags.tags.emplace_back(std::make_shared<CFileItem>(tag));
     }
   }
 
@@ -582,15 +605,45 @@ bool CGUIEPGGridContainerModel::FreeProgrammeMemory(int firstChannel,
   return true;
 }
 
+bool CGUIEPGGridContainerModel::TrimEpgTags(EpgTags& epgTags, int firstBlock, int lastBlock) const
+{
+  std::vector<std::shared_ptr<CFileItem>>& tags = epgTags.tags;
+
+  // tags are sorted and do not overlap
+  const auto first = std::ranges::find_if(
+      tags, [this, firstBlock](const auto& item)
+      { return GetLastEventBlock(item->GetEPGInfoTag()) >= firstBlock; });
+  const auto last =
+      std::find_if(first, tags.end(), [this, lastBlock](const auto& item)
+                   { return GetFirstEventBlock(item->GetEPGInfoTag()) > lastBlock; });
+
+  const bool trimFront = (first != tags.begin());
+  const bool trimBack = (last != tags.end());
+
+  tags.erase(last, tags.end());
+  tags.erase(tags.begin(), first);
+
+  if (tags.empty())
+    return false;
+
+  if (trimFront)
+    epgTags.firstBlock = GetFirstEventBlock(tags.front()->GetEPGInfoTag());
+  if (trimBack)
+    epgTags.lastBlock = GetLastEventBlock(tags.back()->GetEPGInfoTag());
+
+  return true;
+}
+
 void CGUIEPGGridContainerModel::FreeRulerMemory(int keepStart, int keepEnd)
 {
+  // drop the items, they get recreated on demand. keep the date label.
   if (keepStart < keepEnd)
   {
     // remove before keepStart and after keepEnd
     for (int i = 1; i < keepStart && i < RulerItemsSize(); ++i)
-      m_rulerItems[i]->FreeMemory();
+      m_rulerItems[i].reset();
     for (int i = keepEnd + 1; i < RulerItemsSize(); ++i)
-      m_rulerItems[i]->FreeMemory();
+      m_rulerItems[i].reset();
   }
   else
   {
@@ -600,7 +653,7 @@ void CGUIEPGGridContainerModel::FreeRulerMemory(int keepStart, int keepEnd)
       if (i == 0)
         continue;
 
-      m_rulerItems[i]->FreeMemory();
+      m_rulerItems[i].reset();
     }
   }
 }
@@ -79,7 +79,7 @@ public:
     return m_channelItems.empty() ? -1 : static_cast<int>(m_channelItems.size()) - 1;
   }
 
-  std::shared_ptr<CFileItem> GetRulerItem(int iIndex) const { return m_rulerItems[iIndex]; }
+  std::shared_ptr<CFileItem> GetRulerItem(int iIndex) const;
   int RulerItemsSize() const { return static_cast<int>(m_rulerItems.size()); }
 
   int GridItemsSize() const { return m_blocks; }
@@ -135,6 +135,7 @@ private:
                                         int iBlock) const;
   std::shared_ptr<CFileItem> GetEpgTagsBefore(EpgTags& epgTags, int iChannel, int iBlock) const;
   std::shared_ptr<CFileItem> GetEpgTagsAfter(EpgTags& epgTags, int iChannel, int iBlock) const;
+  bool TrimEpgTags(EpgTags& epgTags, int firstBlock, int lastBlock) const;
 
   mutable EpgTagsMap m_epgItems;
 
@@ -142,7 +143,9 @@ private:
   CDateTime m_gridEnd;
 
   std::vector<std::shared_ptr<CFileItem>> m_channelItems;
-  std::vector<std::shared_ptr<CFileItem>> m_rulerItems;
+  mutable std::vector<std::shared_ptr<CFileItem>> m_rulerItems; // created on demand
+  CDateTime m_rulerStart;
+  int m_minutesPerRulerItem = 0;
 
   struct GridCoordinates
   {
@@ -788,12 +788,11 @@ bool CGUIWindowPVRGuideBase::RefreshTimelineItems()
         endDate = maxFutureDate;
 
       CFileItemList channels;
-      const std::vector<std::shared_ptr<CPVRChannelGroupMember>> groupMembers =
-          group->GetMembers(CPVRChannelGroup::Include::ONLY_VISIBLE);
-
-      for (const auto& groupMember : groupMembers)
+      const auto groupMembers = group->GetMembersSnapshot();
+      for (const auto& groupMember : groupMembers->sorted)
       {
-        channels.Add(std::make_shared<CFileItem>(groupMember));
+        if (!groupMember->Channel()->IsHidden())
+          channels.Add(std::make_shared<CFileItem>(groupMember));
       }
 
       if (m_guiState)
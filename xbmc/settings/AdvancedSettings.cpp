@@ -211,6 +211,11 @@ void CAdvancedSettings::Initialize()
 
   m_fullScreenOnMovieStart = true;
   m_cachePath = "special://temp/";
+  m_scraperCacheMaxSize = 64;
+  m_scraperCacheTTL = 0;
+  m_scraperCacheTTLs.clear();
+  m_languageInvokerPoolSize = 4;
+  m_languageInvokerReuseAddons.clear();
 
   m_videoFilenameIdentifierRegExp = R"([\{\[](\w+?)(?:id)?[-=](\w+)[\}|\]])";
   m_videoCleanDateTimeRegExp = "(.*[^ _\\,\\.\\(\\)\\[\\]\\-])[ _\\.\\(\\)\\[\\]\\-]+(19[0-9][0-9]|20[0-9][0-9])([ _\\,\\.\\(\\)\\[\\]\\-]|[^0-9]$)?";
@@ -335,11 +340,20 @@ void CAdvancedSettings::Initialize()
   m_iMusicLibraryDateAdded = 1; // prefer mtime over ctime and current time
   m_bMusicLibraryUseISODates = false;
   m_bMusicLibraryArtistNavigatesToSongs = false;
+  m_iMusicLibraryTagReaderThreads = 4;
+  m_iMusicLibraryPendingFolders = 16;
+  m_bMusicLibraryUseChangeJournal = true;
+  m_bMusicLibraryDeferIndices = false;
 
   m_bVideoLibraryAllItemsOnBottom = false;
   m_iVideoLibraryRecentlyAddedItems = 25;
   m_bVideoLibraryCleanOnUpdate = false;
   m_bVideoLibraryUseFastHash = true;
+  m_bVideoLibraryUseChangeJournal = true;
+  m_bVideoLibraryDeferIndices = false;
+  m_iVideoLibraryScanWorkers = 1;
+  m_iVideoLibraryProbeThreads = 4;
+  m_iVideoLibraryScraperInterval = 0;
   m_bVideoScannerIgnoreErrors = false;
   m_iVideoLibraryDateAdded = 1; // prefer mtime over ctime and current time
   m_minimumEpisodePlaylistDuration = 5 * 60; // 5 minutes
@@ -370,6 +384,8 @@ void CAdvancedSettings::Initialize()
                                                       updateemptytagsinterval = 3600 => trigger an EPG update for every
                                                       channel without EPG data every 2 hours and trigger an EPG update
                                                       for every channel with EPG data every 1 hour. */
+  m_iEpgUpdateWorkers = 4; /* Number of threads updating EPG tables from clients at once */
+  m_iEpgClientUpdateWorkers = 1; /* Number of threads updating EPG tables of the same client at once */
   m_bEpgDisplayUpdatePopup = true; /* Display a progress popup while updating EPG data from clients */
   m_bEpgDisplayIncrementalUpdatePopup = false; /* Display a progress popup while doing incremental EPG updates, but
                                                   only if 'displayupdatepopup' is also enabled. */
@@ -429,6 +445,7 @@ void CAdvancedSettings::Initialize()
   m_PVRDefaultSortOrder.sortOrder = SortOrderDescending;
 
   m_addonPackageFolderSize = 200;
+  m_pythonOwnGilAddons.clear();
 
   m_jsonOutputCompact = true;
   m_jsonTcpPort = 9090;
@@ -466,6 +483,7 @@ void CAdvancedSettings::Initialize()
   m_logLevelHint = m_logLevel = LOG_LEVEL_NORMAL;
 
   m_openGlDebugging = false;
+  m_traceMessageLatency = false;
 
   m_userAgent = CSysInfo::GetUserAgent();
 
@@ -824,6 +842,10 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetInt(pElement, "dateadded", m_iMusicLibraryDateAdded);
     XMLUtils::GetBoolean(pElement, "useisodates", m_bMusicLibraryUseISODates);
     XMLUtils::GetBoolean(pElement, "artistnavigatestosongs", m_bMusicLibraryArtistNavigatesToSongs);
+    XMLUtils::GetInt(pElement, "tagreaderthreads", m_iMusicLibraryTagReaderThreads, 0, 32);
+    XMLUtils::GetInt(pElement, "pendingfolders", m_iMusicLibraryPendingFolders, 1, 1024);
+    XMLUtils::GetBoolean(pElement, "usechangejournal", m_bMusicLibraryUseChangeJournal);
+    XMLUtils::GetBoolean(pElement, "deferindices", m_bMusicLibraryDeferIndices);
     //Music artist name separators
     TiXmlElement* separators = pElement->FirstChildElement("artistseparators");
     if (separators)
@@ -846,6 +868,11 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetInt(pElement, "recentlyaddeditems", m_iVideoLibraryRecentlyAddedItems, 1, INT_MAX);
     XMLUtils::GetBoolean(pElement, "cleanonupdate", m_bVideoLibraryCleanOnUpdate);
     XMLUtils::GetBoolean(pElement, "usefasthash", m_bVideoLibraryUseFastHash);
+    XMLUtils::GetBoolean(pElement, "usechangejournal", m_bVideoLibraryUseChangeJournal);
+    XMLUtils::GetBoolean(pElement, "deferindices", m_bVideoLibraryDeferIndices);
+    XMLUtils::GetInt(pElement, "scanworkers", m_iVideoLibraryScanWorkers, 1, 16);
+    XMLUtils::GetInt(pElement, "probethreads", m_iVideoLibraryProbeThreads, 0, 16);
+    XMLUtils::GetInt(pElement, "scraperinterval", m_iVideoLibraryScraperInterval, 0, 60000);
     XMLUtils::GetString(pElement, "itemseparator", m_videoItemSeparator);
     XMLUtils::GetBoolean(pElement, "importwatchedstate", m_bVideoLibraryImportWatchedState);
     XMLUtils::GetBoolean(pElement, "importresumepoint", m_bVideoLibraryImportResumePoint);
@@ -959,6 +986,24 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
   XMLUtils::GetBoolean(pRootElement,"virtualshares", m_bVirtualShares);
   XMLUtils::GetUInt(pRootElement, "packagefoldersize", m_addonPackageFolderSize);
 
+  // Python add-ons known to work in an interpreter with a GIL of its own
+  pElement = pRootElement->FirstChildElement("python");
+  if (pElement)
+  {
+    TiXmlElement* ownGil = pElement->FirstChildElement("owngil");
+    if (ownGil)
+    {
+      m_pythonOwnGilAddons.clear();
+      TiXmlNode* addon = ownGil->FirstChild("addon");
+      while (addon)
+      {
+        if (addon->FirstChild())
+          m_pythonOwnGilAddons.push_back(addon->FirstChild()->ValueStr());
+        addon = addon->NextSibling("addon");
+      }
+    }
+  }
+
   // EPG
   pElement = pRootElement->FirstChildElement("epg");
   if (pElement)
@@ -968,6 +1013,8 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetInt(pElement, "activetagcheckinterval", m_iEpgActiveTagCheckInterval);
     XMLUtils::GetInt(pElement, "retryinterruptedupdateinterval", m_iEpgRetryInterruptedUpdateInterval);
     XMLUtils::GetInt(pElement, "updateemptytagsinterval", m_iEpgUpdateEmptyTagsInterval);
+    XMLUtils::GetInt(pElement, "updateworkers", m_iEpgUpdateWorkers, 1, 16);
+    XMLUtils::GetInt(pElement, "clientupdateworkers", m_iEpgClientUpdateWorkers, 1, 16);
     XMLUtils::GetBoolean(pElement, "displayupdatepopup", m_bEpgDisplayUpdatePopup);
     XMLUtils::GetBoolean(pElement, "displayincrementalupdatepopup", m_bEpgDisplayIncrementalUpdatePopup);
   }
@@ -1022,6 +1069,33 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     m_cachePath = tmp;
   URIUtils::AddSlashAtEnd(m_cachePath);
 
+  pElement = pRootElement->FirstChildElement("scrapercache");
+  if (pElement)
+  {
+    XMLUtils::GetInt(pElement, "maxsize", m_scraperCacheMaxSize, 0, 4096);
+    XMLUtils::GetInt(pElement, "ttl", m_scraperCacheTTL, 0, INT_MAX);
+    for (const TiXmlElement* scraper = pElement->FirstChildElement("scraper"); scraper;
+         scraper = scraper->NextSiblingElement("scraper"))
+    {
+      const char* id = scraper->Attribute("id");
+      int ttl = 0;
+      if (id && scraper->QueryIntAttribute("ttl", &ttl) == TIXML_SUCCESS && ttl >= 0)
+        m_scraperCacheTTLs[id] = ttl;
+    }
+  }
+
+  pElement = pRootElement->FirstChildElement("languageinvokers");
+  if (pElement)
+  {
+    XMLUtils::GetInt(pElement, "poolsize", m_languageInvokerPoolSize, 0, 32);
+    for (const TiXmlElement* addon = pElement->FirstChildElement("reuse"); addon;
+         addon = addon->NextSiblingElement("reuse"))
+    {
+      if (addon->FirstChild())
+        m_languageInvokerReuseAddons.emplace(addon->FirstChild()->ValueStr());
+    }
+  }
+
   g_LangCodeExpander.LoadUserCodes(pRootElement->FirstChildElement("languagecodes"));
 
   // trailer matching regexps
@@ -1285,6 +1359,7 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
   }
 
   XMLUtils::GetBoolean(pRootElement, "opengldebugging", m_openGlDebugging);
+  XMLUtils::GetBoolean(pRootElement, "tracemessagelatency", m_traceMessageLatency);
 
   // load in the settings overrides
   CServiceBroker::GetSettingsComponent()->GetSettings()->LoadHidden(pRootElement);
@@ -16,6 +16,8 @@
 #include "utils/SortUtils.h"
 
 #include <cstdint>
+#include <map>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -209,6 +211,11 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
 
     bool m_fullScreenOnMovieStart;
     std::string m_cachePath;
+    int m_scraperCacheMaxSize; // MiB, 0 disables the scraper response cache
+    int m_scraperCacheTTL; // minutes a cached scraper response is used without revalidation
+    std::map<std::string, int, std::less<>> m_scraperCacheTTLs; // per scraper add-on
+    int m_languageInvokerPoolSize; // idle add-on interpreters kept warm, 0 disables reuse
+    std::set<std::string, std::less<>> m_languageInvokerReuseAddons; // reused without opting in
     std::string m_videoCleanDateTimeRegExp;
     std::string m_videoFilenameIdentifierRegExp;
     std::vector<std::string> m_videoCleanStringRegExps;
@@ -251,6 +258,10 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
 
     int m_iMusicLibraryRecentlyAddedItems;
     int m_iMusicLibraryDateAdded;
+    int m_iMusicLibraryTagReaderThreads;
+    int m_iMusicLibraryPendingFolders;
+    bool m_bMusicLibraryUseChangeJournal;
+    bool m_bMusicLibraryDeferIndices; // drop secondary indices and triggers while scanning
     bool m_bMusicLibraryAllItemsOnBottom;
     bool m_bMusicLibraryCleanOnUpdate;
     bool m_bMusicLibraryArtistSortOnUpdate;
@@ -267,6 +278,11 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     int m_iVideoLibraryRecentlyAddedItems;
     bool m_bVideoLibraryCleanOnUpdate;
     bool m_bVideoLibraryUseFastHash;
+    bool m_bVideoLibraryUseChangeJournal;
+    bool m_bVideoLibraryDeferIndices; // drop secondary indices while importing
+    int m_iVideoLibraryScanWorkers;
+    int m_iVideoLibraryProbeThreads; // 0 probes stream details while adding the items
+    int m_iVideoLibraryScraperInterval; // milliseconds
     bool m_bVideoLibraryImportWatchedState{true};
     bool m_bVideoLibraryImportResumePoint{true};
 
@@ -285,6 +301,8 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     int m_iEpgActiveTagCheckInterval; // seconds
     int m_iEpgRetryInterruptedUpdateInterval; // seconds
     int m_iEpgUpdateEmptyTagsInterval; // seconds
+    int m_iEpgUpdateWorkers;
+    int m_iEpgClientUpdateWorkers;
     bool m_bEpgDisplayUpdatePopup;
     bool m_bEpgDisplayIncrementalUpdatePopup;
 
@@ -353,10 +371,13 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     bool m_guiVideoLayoutTransparent{false};
 
     unsigned int m_addonPackageFolderSize;
+    std::vector<std::string> m_pythonOwnGilAddons; // run on a GIL of their own where possible
 
     bool m_jsonOutputCompact;
     unsigned int m_jsonTcpPort;
 
+    bool m_traceMessageLatency{false}; /*!< record application messenger latency histograms */
+
     bool m_enableMultimediaKeys;
     std::vector<std::string> m_settingsFiles;
     void ParseSettingsFile(const std::string &file);
@@ -0,0 +1,311 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "MessagePackVariantParser.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+
+namespace
+{
+// nesting limit to protect the stack from hostile input
+constexpr int MAX_DEPTH = 256;
+
+using Result = CMessagePackVariantParser::Result;
+
+class CReader
+{
+public:
+  CReader(const char* data, size_t size)
+    : m_data(reinterpret_cast<const uint8_t*>(data)), m_size(size)
+  {
+  }
+
+  size_t GetPosition() const { return m_position; }
+  size_t GetRemaining() const { return m_size - m_position; }
+
+  bool ReadByte(uint8_t& value)
+  {
+    if (m_position >= m_size)
+      return false;
+    value = m_data[m_position++];
+    return true;
+  }
+
+  template<typename T>
+  bool ReadBigEndian(T& value)
+  {
+    if (GetRemaining() < sizeof(T))
+      return false;
+
+    uint64_t result = 0;
+    for (size_t i = 0; i < sizeof(T); ++i)
+      result = (result << 8) | m_data[m_position++];
+    value = static_cast<T>(result);
+    return true;
+  }
+
+  bool ReadBytes(size_t count, const char*& bytes)
+  {
+    if (GetRemaining() < count)
+      return false;
+    bytes = reinterpret_cast<const char*>(m_data + m_position);
+    m_position += count;
+    return true;
+  }
+
+private:
+  const uint8_t* m_data;
+  size_t m_size;
+  size_t m_position = 0;
+};
+
+Result ReadValue(CReader& reader, CVariant& value, int depth);
+
+Result ReadString(CReader& reader, size_t size, CVariant& value)
+{
+  const char* bytes;
+  if (!reader.ReadBytes(size, bytes))
+    return Result::INCOMPLETE;
+
+  value = CVariant(std::string(bytes, size));
+  return Result::OK;
+}
+
+template<typename T>
+Result ReadLength(CReader& reader, size_t& size)
+{
+  T length;
+  if (!reader.ReadBigEndian(length))
+    return Result::INCOMPLETE;
+
+  size = length;
+  return Result::OK;
+}
+
+Result ReadArray(CReader& reader, size_t count, CVariant& value, int depth)
+{
+  value = CVariant(CVariant::VariantTypeArray);
+  // every element takes at least one byte, don't trust the count any further
+  value.reserve(std::min(count, reader.GetRemaining()));
+  for (size_t i = 0; i < count; ++i)
+  {
+    CVariant element;
+    Result result = ReadValue(reader, element, depth + 1);
+    if (result != Result::OK)
+      return result;
+    value.push_back(std::move(element));
+  }
+  return Result::OK;
+}
+
+Result ReadMap(CReader& reader, size_t count, CVariant& value, int depth)
+{
+  value = CVariant(CVariant::VariantTypeObject);
+  for (size_t i = 0; i < count; ++i)
+  {
+    CVariant key;
+    Result result = ReadValue(reader, key, depth + 1);
+    if (result != Result::OK)
+      return result;
+    if (!key.isString())
+      return Result::INVALID;
+
+    result = ReadValue(reader, value[key.asString()], depth + 1);
+    if (result != Result::OK)
+      return result;
+  }
+  return Result::OK;
+}
+
+Result ReadValue(CReader& reader, CVariant& value, int depth)
+{
+  if (depth > MAX_DEPTH)
+    return Result::INVALID;
+
+  uint8_t marker;
+  if (!reader.ReadByte(marker))
+    return Result::INCOMPLETE;
+
+  // positive and negative fixint
+  if (marker <= 0x7F)
+  {
+    value = CVariant(static_cast<uint64_t>(marker));
+    return Result::OK;
+  }
+  if (marker >= 0xE0)
+  {
+    value = CVariant(static_cast<int64_t>(static_cast<int8_t>(marker)));
+    return Result::OK;
+  }
+  if ((marker & 0xF0) == 0x80)
+    return ReadMap(reader, marker & 0x0F, value, depth);
+  if ((marker & 0xF0) == 0x90)
+    return ReadArray(reader, marker & 0x0F, value, depth);
+  if ((marker & 0xE0) == 0xA0)
+    return ReadString(reader, marker & 0x1F, value);
+
+  Result result = Result::OK;
+  size_t size = 0;
+  switch (marker)
+  {
+    case 0xC0:
+      value = CVariant(CVariant::VariantTypeNull);
+      return Result::OK;
+    case 0xC2:
+      value = CVariant(false);
+      return Result::OK;
+    case 0xC3:
+      value = CVariant(true);
+      return Result::OK;
+
+    case 0xC4: // bin 8
+    case 0xD9: // str 8
+      if ((result = ReadLength<uint8_t>(reader, size)) != Result::OK)
+        return result;
+      return ReadString(reader, size, value);
+    case 0xC5: // bin 16
+    case 0xDA: // str 16
+      if ((result = ReadLength<uint16_t>(reader, size)) != Result::OK)
+        return result;
+      return ReadString(reader, size, value);
+    case 0xC6: // bin 32
+    case 0xDB: // str 32
+      if ((result = ReadLength<uint32_t>(reader, size)) != Result::OK)
+        return result;
+      return ReadString(reader, size, value);
+
+    case 0xCA:
+    {
+      uint32_t bits;
+      if (!reader.ReadBigEndian(bits))
+        return Result::INCOMPLETE;
+      value = CVariant(std::bit_cast<float>(bits));
+      return Result::OK;
+    }
+    case 0xCB:
+    {
+      uint64_t bits;
+      if (!reader.ReadBigEndian(bits))
+        return Result::INCOMPLETE;
+      value = CVariant(std::bit_cast<double>(bits));
+      return Result::OK;
+    }
+
+    case 0xCC:
+    {
+      uint8_t number;
+      if (!reader.ReadBigEndian(number))
+        return Result::INCOMPLETE;
+      value = CVariant(static_cast<uint64_t>(number));
+      return Result::OK;
+    }
+    case 0xCD:
+    {
+      uint16_t number;
+      if (!reader.ReadBigEndian(number))
+        return Result::INCOMPLETE;
+      value = CVariant(static_cast<uint64_t>(number));
+      return Result::OK;
+    }
+    case 0xCE:
+    {
+      uint32_t number;
+      if (!reader.ReadBigEndian(number))
+        return Result::INCOMPLETE;
+      value = CVariant(static_cast<uint64_t>(number));
+      return Result::OK;
+    }
+    case 0xCF:
+    {
+      uint64_t number;
+      if (!reader.ReadBigEndian(number))
+        return Result::INCOMPLETE;
+      value = CVariant(number);
+      return Result::OK;
+    }
+
+    case 0xD0:
+    {
+      int8_t number;
+      if (!reader.ReadBigEndian(number))
+        return Result::INCOMPLETE;
+      value = CVariant(static_cast<int64_t>(number));
+      return Result::OK;
+    }
+    case 0xD1:
+    {
+      int16_t number;
+      if (!reader.ReadBigEndian(number))
+        return Result::INCOMPLETE;
+      value = CVariant(static_cast<int64_t>(number));
+      return Result::OK;
+    }
+    case 0xD2:
+    {
+      int32_t number;
+      if (!reader.ReadBigEndian(number))
+        return Result::INCOMPLETE;
+      value = CVariant(static_cast<int64_t>(number));
+      return Result::OK;
+    }
+    case 0xD3:
+    {
+      int64_t number;
+      if (!reader.ReadBigEndian(number))
+        return Result::INCOMPLETE;
+      value = CVariant(number);
+      return Result::OK;
+    }
+
+    case 0xDC:
+      if ((result = ReadLength<uint16_t>(reader, size)) != Result::OK)
+        return result;
+      return ReadArray(reader, size, value, depth);
+    case 0xDD:
+      if ((result = ReadLength<uint32_t>(reader, size)) != Result::OK)
+        return result;
+      return ReadArray(reader, size, value, depth);
+    case 0xDE:
+      if ((result = ReadLength<uint16_t>(reader, size)) != Result::OK)
+        return result;
+      return ReadMap(reader, size, value, depth);
+    case 0xDF:
+      if ((result = ReadLength<uint32_t>(reader, size)) != Result::OK)
+        return result;
+      return ReadMap(reader, size, value, depth);
+
+    // 0xC1 is never used, 0xC7 - 0xC9 and 0xD4 - 0xD8 are extension types
+    default:
+      return Result::INVALID;
+  }
+}
+} // unnamed namespace
+
+CMessagePackVariantParser::Result CMessagePackVariantParser::Parse(const char* data,
+                                                                   size_t size,
+                                                                   CVariant& value,
+                                                                   size_t& length)
+{
+  CReader reader(data, size);
+  CVariant result;
+  Result status = ReadValue(reader, result, 0);
+  if (status != Result::OK)
+    return status;
+
+  value = std::move(result);
+  length = reader.GetPosition();
+  return Result::OK;
+}
+
+bool CMessagePackVariantParser::Parse(const std::string& data, CVariant& value)
+{
+  size_t length = 0;
+  return Parse(data.data(), data.size(), value, length) == Result::OK && length == data.size();
+}
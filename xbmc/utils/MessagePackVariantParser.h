@@ -0,0 +1,44 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "utils/Variant.h"
+
+#include <cstddef>
+#include <string>
+
+/*!
+ \brief Parses MessagePack (https://msgpack.org) into a CVariant
+
+ Maps must only use string keys. Binary data is returned as string, extension types are not
+ supported.
+ */
+class CMessagePackVariantParser
+{
+public:
+  CMessagePackVariantParser() = delete;
+
+  enum class Result
+  {
+    OK,
+    INCOMPLETE, //!< the data ends in the middle of the value
+    INVALID
+  };
+
+  /*!
+   \brief Parse the first value of a stream of values
+   \param[out] length the number of bytes the value takes, only set on success
+   */
+  static Result Parse(const char* data, size_t size, CVariant& value, size_t& length);
+
+  /*!
+   \brief Parse data consisting of exactly one value
+   */
+  static bool Parse(const std::string& data, CVariant& value);
+};
@@ -0,0 +1,139 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "MessagePackVariantWriter.h"
+
+#include "utils/Variant.h"
+
+#include <bit>
+#include <cstdint>
+#include <limits>
+
+namespace
+{
+template<typename T>
+void WriteBigEndian(std::string& output, uint8_t marker, T value)
+{
+  output.push_back(static_cast<char>(marker));
+  for (int shift = (sizeof(T) - 1) * 8; shift >= 0; shift -= 8)
+    output.push_back(static_cast<char>((value >> shift) & 0xFF));
+}
+
+void WriteUnsigned(std::string& output, uint64_t value)
+{
+  if (value < 0x80)
+    output.push_back(static_cast<char>(value));
+  else if (value <= std::numeric_limits<uint8_t>::max())
+    WriteBigEndian(output, 0xCC, static_cast<uint8_t>(value));
+  else if (value <= std::numeric_limits<uint16_t>::max())
+    WriteBigEndian(output, 0xCD, static_cast<uint16_t>(value));
+  else if (value <= std::numeric_limits<uint32_t>::max())
+    WriteBigEndian(output, 0xCE, static_cast<uint32_t>(value));
+  else
+    WriteBigEndian(output, 0xCF, value);
+}
+
+void WriteSigned(std::string& output, int64_t value)
+{
+  if (value >= 0)
+    WriteUnsigned(output, static_cast<uint64_t>(value));
+  else if (value >= -32)
+    output.push_back(static_cast<char>(value));
+  else if (value >= std::numeric_limits<int8_t>::min())
+    WriteBigEndian(output, 0xD0, static_cast<uint8_t>(value));
+  else if (value >= std::numeric_limits<int16_t>::min())
+    WriteBigEndian(output, 0xD1, static_cast<uint16_t>(value));
+  else if (value >= std::numeric_limits<int32_t>::min())
+    WriteBigEndian(output, 0xD2, static_cast<uint32_t>(value));
+  else
+    WriteBigEndian(output, 0xD3, static_cast<uint64_t>(value));
+}
+
+void WriteString(std::string& output, const char* data, size_t size)
+{
+  if (size < 32)
+    output.push_back(static_cast<char>(0xA0 | size));
+  else if (size <= std::numeric_limits<uint8_t>::max())
+    WriteBigEndian(output, 0xD9, static_cast<uint8_t>(size));
+  else if (size <= std::numeric_limits<uint16_t>::max())
+    WriteBigEndian(output, 0xDA, static_cast<uint16_t>(size));
+  else
+    WriteBigEndian(output, 0xDB, static_cast<uint32_t>(size));
+
+  output.append(data, size);
+}
+
+void WriteContainer(std::string& output, uint8_t fixMarker, uint8_t marker16, size_t size)
+{
+  if (size < 16)
+    output.push_back(static_cast<char>(fixMarker | size));
+  else if (size <= std::numeric_limits<uint16_t>::max())
+    WriteBigEndian(output, marker16, static_cast<uint16_t>(size));
+  else
+    WriteBigEndian(output, marker16 + 1, static_cast<uint32_t>(size));
+}
+
+bool InternalWrite(std::string& output, const CVariant& value)
+{
+  switch (value.type())
+  {
+    case CVariant::VariantTypeInteger:
+      WriteSigned(output, value.asInteger());
+      break;
+    case CVariant::VariantTypeUnsignedInteger:
+      WriteUnsigned(output, value.asUnsignedInteger());
+      break;
+    case CVariant::VariantTypeDouble:
+      WriteBigEndian(output, 0xCB, std::bit_cast<uint64_t>(value.asDouble()));
+      break;
+    case CVariant::VariantTypeBoolean:
+      output.push_back(static_cast<char>(value.asBoolean() ? 0xC3 : 0xC2));
+      break;
+    case CVariant::VariantTypeString:
+      if (value.size() > std::numeric_limits<uint32_t>::max())
+        return false;
+      WriteString(output, value.c_str(), value.size());
+      break;
+    case CVariant::VariantTypeArray:
+      if (value.size() > std::numeric_limits<uint32_t>::max())
+        return false;
+      WriteContainer(output, 0x90, 0xDC, value.size());
+      for (CVariant::const_iterator_array itr = value.begin_array(); itr != value.end_array();
+           ++itr)
+      {
+        if (!InternalWrite(output, *itr))
+          return false;
+      }
+      break;
+    case CVariant::VariantTypeObject:
+      if (value.size() > std::numeric_limits<uint32_t>::max())
+        return false;
+      WriteContainer(output, 0x80, 0xDE, value.size());
+      for (CVariant::const_iterator_map itr = value.begin_map(); itr != value.end_map(); ++itr)
+      {
+        WriteString(output, itr->first.c_str(), itr->first.size());
+        if (!InternalWrite(output, itr->second))
+          return false;
+      }
+      break;
+
+    // same as CJSONVariantWriter
+    case CVariant::VariantTypeConstNull:
+    case CVariant::VariantTypeNull:
+    default:
+      output.push_back(static_cast<char>(0xC0));
+      break;
+  }
+  return true;
+}
+} // unnamed namespace
+
+bool CMessagePackVariantWriter::Write(const CVariant& value, std::string& output)
+{
+  return InternalWrite(output, value);
+}
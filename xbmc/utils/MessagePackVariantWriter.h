@@ -0,0 +1,30 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <string>
+
+class CVariant;
+
+/*!
+ \brief Writes a CVariant as MessagePack (https://msgpack.org)
+
+ The variant is encoded in a single pass straight into the output, integers and strings use the
+ shortest representation MessagePack offers.
+ */
+class CMessagePackVariantWriter
+{
+public:
+  CMessagePackVariantWriter() = delete;
+
+  /*!
+   \brief Append the encoded value to output
+   */
+  static bool Write(const CVariant& value, std::string& output);
+};
@@ -9,6 +9,7 @@
 #include "RegExp.h"
 
 #include "log.h"
+#include "utils/RegExpCache.h"
 #include "utils/StringUtils.h"
 #include "utils/Utf8Utils.h"
 
@@ -20,6 +21,40 @@ int CRegExp::m_Utf8Supported = -1;
 int CRegExp::m_UcpSupported  = -1;
 int CRegExp::m_JitSupported  = -1;
 
+namespace
+{
+// JIT stacks are only needed while matching, one per thread serves all expressions
+pcre2_match_context* GetThreadMatchContext()
+{
+  struct MatchContext
+  {
+    ~MatchContext()
+    {
+      pcre2_match_context_free(context);
+      pcre2_jit_stack_free(jitStack);
+    }
+
+    pcre2_match_context* context = nullptr;
+    pcre2_jit_stack* jitStack = nullptr;
+  };
+  thread_local MatchContext matchContext;
+
+  if (!matchContext.context)
+  {
+    matchContext.context = pcre2_match_context_create(nullptr);
+    if (CRegExp::IsJitSupported())
+    {
+      matchContext.jitStack = pcre2_jit_stack_create(32 * 1024, 512 * 1024, nullptr);
+      if (matchContext.jitStack == nullptr)
+        CLog::Log(LOGWARNING, "{}: can't allocate address space for JIT stack", __FUNCTION__);
+
+      pcre2_jit_stack_assign(matchContext.context, nullptr, matchContext.jitStack);
+    }
+  }
+  return matchContext.context;
+}
+} // unnamed namespace
+
 
 CRegExp::CRegExp(bool caseless /*= false*/, CRegExp::utf8Mode utf8 /*= asciiOnly*/)
 {
@@ -29,8 +64,7 @@ CRegExp::CRegExp(bool caseless /*= false*/, CRegExp::utf8Mode utf8 /*= asciiOnly
 void CRegExp::InitValues(bool caseless /*= false*/, CRegExp::utf8Mode utf8 /*= asciiOnly*/)
 {
   m_utf8Mode    = utf8;
-  m_re          = NULL;
-  m_ctxt = nullptr;
+  m_re.reset();
   m_iOptions = PCRE2_DOTALL;
   if(caseless)
     m_iOptions |= PCRE2_CASELESS;
@@ -48,7 +82,6 @@ void CRegExp::InitValues(bool caseless /*= false*/, CRegExp::utf8Mode utf8 /*= a
   m_iMatchCount = 0;
   m_matchData = nullptr;
   m_iOvector = nullptr;
-  m_jitStack = NULL;
 }
 
 CRegExp::CRegExp(bool caseless, CRegExp::utf8Mode utf8, const char *re, studyMode study /*= NoStudy*/)
@@ -203,11 +236,8 @@ bool CRegExp::isCharClassWithUnicode(const std::string& regexp, size_t& pos)
 
 CRegExp::CRegExp(const CRegExp& re)
 {
-  m_re = NULL;
-  m_ctxt = nullptr;
   m_matchData = nullptr;
   m_iOvector = nullptr;
-  m_jitStack = NULL;
   m_utf8Mode = re.m_utf8Mode;
   m_iOptions = re.m_iOptions;
   *this = re;
@@ -215,28 +245,20 @@ CRegExp::CRegExp(const CRegExp& re)
 
 CRegExp& CRegExp::operator=(const CRegExp& re)
 {
-  size_t size;
   Cleanup();
   m_jitCompiled = false;
   m_pattern = re.m_pattern;
   if (re.m_re)
   {
-    if (pcre2_pattern_info(re.m_re, PCRE2_INFO_SIZE, &size) >= 0)
-    {
-      if ((m_re = pcre2_code_copy(re.m_re)))
-      {
-        if (re.m_ctxt)
-          m_ctxt = pcre2_match_context_copy(re.m_ctxt);
-        m_iOvector = re.m_iOvector;
-        m_offset = re.m_offset;
-        m_iMatchCount = re.m_iMatchCount;
-        m_bMatched = re.m_bMatched;
-        m_subject = re.m_subject;
-        m_iOptions = re.m_iOptions;
-      }
-      else
-        CLog::Log(LOGFATAL, "{}: Failed to allocate memory", __FUNCTION__);
-    }
+    // compiled code is read-only, copies share it
+    m_re = re.m_re;
+    m_jitCompiled = re.m_jitCompiled;
+    m_iOvector = re.m_iOvector;
+    m_offset = re.m_offset;
+    m_iMatchCount = re.m_iMatchCount;
+    m_bMatched = re.m_bMatched;
+    m_subject = re.m_subject;
+    m_iOptions = re.m_iOptions;
   }
   return *this;
 }
@@ -246,7 +268,9 @@ CRegExp::~CRegExp()
   Cleanup();
 }
 
-bool CRegExp::RegComp(const char *re, studyMode study /*= NoStudy*/)
+bool CRegExp::RegComp(const char* re,
+                      studyMode study /*= NoStudy*/,
+                      cacheMode cache /*= UseCache*/)
 {
   if (!re)
     return false;
@@ -266,10 +290,26 @@ bool CRegExp::RegComp(const char *re, studyMode study /*= NoStudy*/)
 
   Cleanup();
 
+  const bool jitCompile = (study == StudyWithJitComp) && IsJitSupported();
+  std::string key(re);
+  key += '\0';
+  key += std::to_string(options);
+  key += jitCompile ? 'j' : 'i';
+
+  CRegExpCache::Pattern pattern;
+  if (cache == UseCache && CRegExpCache::GetInstance().Get(key, pattern))
+  {
+    m_re = pattern.code;
+    m_jitCompiled = pattern.jitCompiled;
+    m_pattern = re;
+    return true;
+  }
+
   ctxt = pcre2_compile_context_create(NULL);
   pcre2_set_newline(ctxt, PCRE2_NEWLINE_ANY);
-  m_re = pcre2_compile(reinterpret_cast<PCRE2_SPTR>(re), PCRE2_ZERO_TERMINATED, options, &errCode,
-                       &errOffset, ctxt);
+  m_re.reset(pcre2_compile(reinterpret_cast<PCRE2_SPTR>(re), PCRE2_ZERO_TERMINATED, options,
+                           &errCode, &errOffset, ctxt),
+             pcre2_code_free);
   pcre2_compile_context_free(ctxt);
 
   if (!m_re)
@@ -283,18 +323,16 @@ bool CRegExp::RegComp(const char *re, studyMode study /*= NoStudy*/)
 
   m_pattern = re;
 
-  if (study)
+  if (jitCompile)
   {
-    const bool jitCompile = (study == StudyWithJitComp) && IsJitSupported();
-    if (jitCompile)
-    {
-      pcre2_jit_compile(m_re, PCRE2_JIT_COMPLETE);
-      size_t jitPresent = 0;
-      m_jitCompiled =
-          (pcre2_pattern_info(m_re, PCRE2_INFO_JITSIZE, &jitPresent) == 0 && jitPresent > 0);
-    }
+    pcre2_jit_compile(m_re.get(), PCRE2_JIT_COMPLETE);
+    size_t jitPresent = 0;
+    m_jitCompiled =
+        (pcre2_pattern_info(m_re.get(), PCRE2_INFO_JITSIZE, &jitPresent) == 0 && jitPresent > 0);
   }
 
+  if (cache == UseCache)
+    CRegExpCache::GetInstance().Add(key, {m_re, m_jitCompiled});
   return true;
 }
 
@@ -329,26 +367,14 @@ int CRegExp::PrivateRegFind(size_t bufferLen, const char *str, unsigned int star
     return -1;
   }
 
-  if (!m_ctxt)
-    m_ctxt = pcre2_match_context_create(NULL);
-
-  if (m_jitCompiled && !m_jitStack)
-  {
-    m_jitStack = pcre2_jit_stack_create(32 * 1024, 512 * 1024, NULL);
-    if (m_jitStack == NULL)
-      CLog::Log(LOGWARNING, "{}: can't allocate address space for JIT stack", __FUNCTION__);
-
-    pcre2_jit_stack_assign(m_ctxt, NULL, m_jitStack);
-  }
-
   if (maxNumberOfCharsToTest >= 0)
     bufferLen = std::min<size_t>(bufferLen, startoffset + maxNumberOfCharsToTest);
 
   m_subject.assign(str + startoffset, bufferLen - startoffset);
   if (m_matchData == nullptr)
     m_matchData = pcre2_match_data_create(OVECCOUNT, nullptr);
-  int rc = pcre2_match(m_re, reinterpret_cast<PCRE2_SPTR>(m_subject.c_str()), m_subject.length(), 0,
-                       0, m_matchData, m_ctxt);
+  int rc = pcre2_match(m_re.get(), reinterpret_cast<PCRE2_SPTR>(m_subject.c_str()),
+                       m_subject.length(), 0, 0, m_matchData, GetThreadMatchContext());
   m_iOvector = pcre2_get_ovector_pointer(m_matchData);
   offset = pcre2_get_startchar(m_matchData);
 
@@ -430,7 +456,7 @@ int CRegExp::GetCaptureTotal() const
 {
   int c = -1;
   if (m_re)
-    pcre2_pattern_info(m_re, PCRE2_INFO_CAPTURECOUNT, &c);
+    pcre2_pattern_info(m_re.get(), PCRE2_INFO_CAPTURECOUNT, &c);
   return c;
 }
 
@@ -533,23 +559,7 @@ void CRegExp::DumpOvector(int iLog /* = LOGDEBUG */)
 
 void CRegExp::Cleanup()
 {
-  if (m_re)
-  {
-    pcre2_code_free(m_re);
-    m_re = nullptr;
-  }
-
-  if (m_ctxt)
-  {
-    pcre2_match_context_free(m_ctxt);
-    m_ctxt = nullptr;
-  }
-
-  if (m_jitStack)
-  {
-    pcre2_jit_stack_free(m_jitStack);
-    m_jitStack = NULL;
-  }
+  m_re.reset();
 
   if (m_matchData)
   {
@@ -634,7 +644,7 @@ std::vector<CRegExp> CompileRegexes(const std::vector<std::string>& regExpPatter
 
   for (const auto& expression : regExpPatterns)
   {
-    if (regEx.RegComp(expression))
+    if (regEx.RegComp(expression, CRegExp::StudyWithJitComp))
       regExps.emplace_back(regEx);
     else
       CLog::LogF(LOGERROR, "Invalid RegExp:'{}'", expression.c_str());
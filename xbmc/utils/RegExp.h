@@ -10,6 +10,7 @@
 
 //! @todo - move to std::regex (after switching to gcc 4.9 or higher) and get rid of CRegExp
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -32,6 +33,11 @@ public:
     asciiOnly =  0, // process regexp and strings as single-byte encoded strings
     forceUtf8 =  1  // enable UTF-8 mode (with Unicode properties)
   };
+  enum cacheMode
+  {
+    UseCache, // share the compiled expression with all expressions compiled from the same string
+    NoCache   // compile the expression on its own, for expressions built from changing input
+  };
 
   static const int m_MaxNumOfBackrefrences = 20;
   /**
@@ -60,19 +66,21 @@ public:
    * @param re          The regular expression
    * @param study (optional) Controls study of expression, useful if expression will be used
    *                         several times
+   * @param cache (optional) Controls whether the compiled expression is cached
    * @return true on success, false on any error
    */
-  bool RegComp(const char *re, studyMode study = NoStudy);
+  bool RegComp(const char* re, studyMode study = NoStudy, cacheMode cache = UseCache);
 
   /**
    * Compile (prepare) regular expression
    * @param re          The regular expression
    * @param study (optional) Controls study of expression, useful if expression will be used
    *                         several times
+   * @param cache (optional) Controls whether the compiled expression is cached
    * @return true on success, false on any error
    */
-  bool RegComp(const std::string& re, studyMode study = NoStudy)
-  { return RegComp(re.c_str(), study); }
+  bool RegComp(const std::string& re, studyMode study = NoStudy, cacheMode cache = UseCache)
+  { return RegComp(re.c_str(), study, cache); }
 
   /**
    * Find first match of regular expression in given string
@@ -130,8 +138,7 @@ private:
   void Cleanup();
   inline bool IsValidSubNumber(int iSub) const;
 
-  pcre2_code* m_re;
-  pcre2_match_context* m_ctxt;
+  std::shared_ptr<pcre2_code> m_re; // shared with CRegExpCache and copies
   static const int OVECCOUNT=(m_MaxNumOfBackrefrences + 1) * 3;
   unsigned int m_offset;
   pcre2_match_data* m_matchData;
@@ -141,7 +148,6 @@ private:
   uint32_t m_iOptions;
   bool        m_jitCompiled;
   bool        m_bMatched;
-  pcre2_jit_stack* m_jitStack;
   std::string m_subject;
   std::string m_pattern;
   static int  m_Utf8Supported;
@@ -0,0 +1,80 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "RegExpCache.h"
+
+#include <mutex>
+
+namespace
+{
+constexpr size_t MAX_PATTERNS = 1024;
+} // unnamed namespace
+
+CRegExpCache& CRegExpCache::GetInstance()
+{
+  static CRegExpCache cache(MAX_PATTERNS);
+  return cache;
+}
+
+bool CRegExpCache::Get(const std::string& key, Pattern& pattern)
+{
+  std::unique_lock lock(m_critSection);
+  const auto it = m_index.find(key);
+  if (it == m_index.end())
+  {
+    m_misses++;
+    return false;
+  }
+
+  m_entries.splice(m_entries.begin(), m_entries, it->second);
+  pattern = it->second->second;
+  m_hits++;
+  return true;
+}
+
+void CRegExpCache::Add(const std::string& key, Pattern pattern)
+{
+  std::unique_lock lock(m_critSection);
+  const auto it = m_index.find(key);
+  if (it != m_index.end())
+  {
+    // compiled by another thread meanwhile
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    return;
+  }
+
+  if (m_maxPatterns == 0)
+    return;
+
+  while (m_entries.size() >= m_maxPatterns)
+  {
+    m_index.erase(m_entries.back().first);
+    m_entries.pop_back();
+  }
+
+  m_entries.emplace_front(key, std::move(pattern));
+  m_index.emplace(key, m_entries.begin());
+}
+
+size_t CRegExpCache::Size() const
+{
+  std::unique_lock lock(m_critSection);
+  return m_entries.size();
+}
+
+unsigned int CRegExpCache::GetHits() const
+{
+  std::unique_lock lock(m_critSection);
+  return m_hits;
+}
+
+unsigned int CRegExpCache::GetMisses() const
+{
+  std::unique_lock lock(m_critSection);
+  return m_misses;
+}
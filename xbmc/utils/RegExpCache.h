@@ -0,0 +1,71 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#define PCRE2_CODE_UNIT_WIDTH 8
+#include <pcre2.h>
+
+/*!
+ \brief Process-wide cache of compiled regular expressions.
+
+ Scrapers and the library scanners compile the same few patterns for every expression or file.
+ Compiled (and JIT-compiled) code is read-only and can be shared between threads, only match data
+ and JIT stacks are per matching thread. When full, the pattern used least recently is dropped.
+ */
+class CRegExpCache
+{
+public:
+  struct Pattern
+  {
+    std::shared_ptr<pcre2_code> code;
+    bool jitCompiled = false;
+  };
+
+  /*!
+   \param maxPatterns The number of patterns to keep at most.
+   */
+  explicit CRegExpCache(size_t maxPatterns) : m_maxPatterns(maxPatterns) {}
+
+  static CRegExpCache& GetInstance();
+
+  /*!
+   \brief Get a cached pattern and mark it as used.
+   \param key The pattern together with everything it was compiled with.
+   \param[out] pattern The cached pattern.
+   \return True if the pattern was cached, false otherwise.
+   */
+  bool Get(const std::string& key, Pattern& pattern);
+
+  /*!
+   \brief Cache a pattern, dropping the one used least recently if the cache is full.
+   */
+  void Add(const std::string& key, Pattern pattern);
+
+  size_t Size() const;
+  unsigned int GetHits() const;
+  unsigned int GetMisses() const;
+
+private:
+  using Entries = std::list<std::pair<std::string, Pattern>>;
+
+  const size_t m_maxPatterns;
+  mutable CCriticalSection m_critSection;
+  Entries m_entries; //!< most recently used first
+  std::unordered_map<std::string, Entries::iterator> m_index;
+  unsigned int m_hits{0};
+  unsigned int m_misses{0};
+};
@@ -210,10 +210,16 @@ void CScraperParser::ParseExpression(const std::string& input, std::string& dest
       strExpression = pExpression->FirstChild()->Value();
     else
       strExpression = "(.*)";
+    const std::string strTemplate = strExpression;
     ReplaceBuffers(strExpression);
     ReplaceBuffers(strOutput);
 
-    if (!reg.RegComp(strExpression.c_str()))
+    // expressions with buffers substituted differ for every page, caching or JIT-compiling them
+    // costs more than it saves
+    const bool bSubstituted = strExpression != strTemplate;
+    if (!reg.RegComp(strExpression.c_str(),
+                     bSubstituted ? CRegExp::NoStudy : CRegExp::StudyWithJitComp,
+                     bSubstituted ? CRegExp::NoCache : CRegExp::UseCache))
     {
       return;
     }
@@ -0,0 +1,381 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ScraperResponseCache.h"
+
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "ServiceBroker.h"
+#include "URL.h"
+#include "XBDateTime.h"
+#include "filesystem/CurlFile.h"
+#include "filesystem/Directory.h"
+#include "filesystem/File.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
+#include "utils/Digest.h"
+#include "utils/StringUtils.h"
+#include "utils/URIUtils.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+using KODI::UTILITY::CDigest;
+
+namespace
+{
+constexpr std::string_view ENTRY_MAGIC = "KodiScraperResponse2";
+constexpr int ENTRY_HEADER_LINES = 7;
+constexpr std::string_view TEMP_EXTENSION = ".tmp";
+
+int64_t Now()
+{
+  return std::chrono::duration_cast<std::chrono::seconds>(
+             std::chrono::system_clock::now().time_since_epoch())
+      .count();
+}
+
+std::string GetCacheFolder()
+{
+  return URIUtils::AddFileToFolder(
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_cachePath, "scrapers",
+      "responses/");
+}
+
+// header values are stored one per line
+std::string SingleLine(const std::string& value)
+{
+  std::string line = value;
+  line.erase(std::remove_if(line.begin(), line.end(), [](char c) { return c == '\r' || c == '\n'; }),
+             line.end());
+  return line;
+}
+} // unnamed namespace
+
+CScraperResponseCache& CScraperResponseCache::GetInstance()
+{
+  static CScraperResponseCache cache(GetCacheFolder());
+  return cache;
+}
+
+CScraperResponseCache::CScraperResponseCache(std::string folder) : m_folder(std::move(folder))
+{
+}
+
+bool CScraperResponseCache::Get(const std::string& scraperId,
+                                const std::string& url,
+                                XFILE::CCurlFile& http,
+                                std::string& body,
+                                std::string& mimeType,
+                                std::string& charset)
+{
+  const auto fetch = [&http](const std::string& requestUrl, const std::string& etag,
+                             const std::string& lastModified, Response& response)
+  {
+    if (!etag.empty())
+      http.SetRequestHeader("If-None-Match", etag);
+    if (!lastModified.empty())
+      http.SetRequestHeader("If-Modified-Since", lastModified);
+
+    const bool result = http.Get(requestUrl, response.entry.body);
+    http.RemoveRequestHeader("If-None-Match");
+    http.RemoveRequestHeader("If-Modified-Since");
+    if (!result)
+      return false;
+
+    response.code = http.GetResponseCode();
+    response.cacheControl = http.GetHttpHeader().GetValue("Cache-Control");
+    response.entry.etag = http.GetHttpHeader().GetValue("ETag");
+    response.entry.lastModified = http.GetHttpHeader().GetValue("Last-Modified");
+    response.entry.mimeType = http.GetProperty(XFILE::FileProperty::MIME_TYPE);
+    response.entry.charset = http.GetProperty(XFILE::FileProperty::CONTENT_CHARSET);
+    return true;
+  };
+
+  return Get(scraperId, url, fetch, body, mimeType, charset);
+}
+
+bool CScraperResponseCache::Get(const std::string& scraperId,
+                                const std::string& url,
+                                const FetchFunction& fetch,
+                                std::string& body,
+                                std::string& mimeType,
+                                std::string& charset)
+{
+  const auto advancedSettings = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+  if (advancedSettings->m_scraperCacheMaxSize == 0)
+  {
+    Response response;
+    if (!fetch(url, "", "", response))
+      return false;
+
+    body = std::move(response.entry.body);
+    mimeType = response.entry.mimeType;
+    charset = response.entry.charset;
+    return true;
+  }
+
+  int ttl = advancedSettings->m_scraperCacheTTL;
+  const auto it = advancedSettings->m_scraperCacheTTLs.find(scraperId);
+  if (it != advancedSettings->m_scraperCacheTTLs.end())
+    ttl = it->second;
+
+  const std::string path = GetEntryPath(scraperId, url);
+  Entry entry;
+  const bool cached = Load(path, entry);
+  if (cached && Now() - entry.stored < static_cast<int64_t>(ttl) * 60)
+  {
+    CLog::Log(LOGDEBUG, "CScraperResponseCache: using cached {}", CURL::GetRedacted(url));
+    {
+      std::unique_lock lock(m_critSection);
+      m_stats.hits++;
+    }
+    body = std::move(entry.body);
+    mimeType = entry.mimeType;
+    charset = entry.charset;
+    return true;
+  }
+
+  Response response;
+  if (!fetch(url, cached ? entry.etag : "", cached ? entry.lastModified : "", response))
+    return false;
+
+  if (cached && response.code == 304)
+  {
+    CLog::Log(LOGDEBUG, "CScraperResponseCache: {} not modified", CURL::GetRedacted(url));
+    {
+      std::unique_lock lock(m_critSection);
+      m_stats.revalidated++;
+    }
+    entry.stored = Now();
+    Store(path, entry);
+    body = std::move(entry.body);
+    mimeType = entry.mimeType;
+    charset = entry.charset;
+    return true;
+  }
+
+  {
+    std::unique_lock lock(m_critSection);
+    m_stats.misses++;
+  }
+
+  // without a TTL, only responses that can be revalidated are worth keeping
+  Entry& fetched = response.entry;
+  fetched.stored = Now();
+  const bool storable = response.code == 200 &&
+                        !StringUtils::Contains(response.cacheControl, "no-store") &&
+                        (ttl > 0 || !fetched.etag.empty() || !fetched.lastModified.empty());
+  if (storable)
+    Store(path, fetched);
+
+  body = std::move(fetched.body);
+  mimeType = fetched.mimeType;
+  charset = fetched.charset;
+  return true;
+}
+
+CScraperResponseCache::Stats CScraperResponseCache::GetStats() const
+{
+  std::unique_lock lock(m_critSection);
+  return m_stats;
+}
+
+std::string CScraperResponseCache::Serialize(const Entry& entry)
+{
+  std::string data(ENTRY_MAGIC);
+  data += '\n';
+  data += SingleLine(entry.etag) + '\n';
+  data += SingleLine(entry.lastModified) + '\n';
+  data += SingleLine(entry.mimeType) + '\n';
+  data += SingleLine(entry.charset) + '\n';
+  data += std::to_string(entry.stored) + '\n';
+  data += std::to_string(entry.body.size()) + '\n';
+  data += entry.body;
+  return data;
+}
+
+bool CScraperResponseCache::Deserialize(const std::string& data, Entry& entry)
+{
+  std::string lines[ENTRY_HEADER_LINES];
+  size_t begin = 0;
+  for (auto& line : lines)
+  {
+    const size_t end = data.find('\n', begin);
+    if (end == std::string::npos)
+      return false;
+
+    line = data.substr(begin, end - begin);
+    begin = end + 1;
+  }
+
+  if (lines[0] != ENTRY_MAGIC)
+    return false;
+
+  entry.etag = lines[1];
+  entry.lastModified = lines[2];
+  entry.mimeType = lines[3];
+  entry.charset = lines[4];
+  // a file cut short must not be taken for a complete response
+  if (std::strtoull(lines[6].c_str(), nullptr, 10) != data.size() - begin)
+    return false;
+
+  entry.stored = std::strtoll(lines[5].c_str(), nullptr, 10);
+  entry.body = data.substr(begin);
+  return true;
+}
+
+std::string CScraperResponseCache::GetEntryPath(const std::string& scraperId,
+                                                const std::string& url) const
+{
+  return m_folder + CDigest::Calculate(CDigest::Type::MD5, scraperId + '\n' + url);
+}
+
+bool CScraperResponseCache::Load(const std::string& path, Entry& entry)
+{
+  {
+    std::unique_lock lock(m_critSection);
+    LoadIndex();
+    const auto it = m_index.find(URIUtils::GetFileName(path));
+    if (it == m_index.end())
+      return false;
+    it->second.lastUse = ++m_lastUse;
+  }
+
+  XFILE::CFile file;
+  std::vector<uint8_t> buffer;
+  if (file.LoadFile(path, buffer) > 0 &&
+      Deserialize(std::string(reinterpret_cast<char*>(buffer.data()), buffer.size()), entry))
+    return true;
+
+  std::unique_lock lock(m_critSection);
+  const auto it = m_index.find(URIUtils::GetFileName(path));
+  if (it != m_index.end())
+  {
+    m_size -= it->second.size;
+    m_index.erase(it);
+  }
+  XFILE::CFile::Delete(path);
+  return false;
+}
+
+void CScraperResponseCache::Store(const std::string& path, const Entry& entry)
+{
+  const std::string data = Serialize(entry);
+
+  // write to a file of its own and move it in place, so that neither a concurrent Load() nor a
+  // crash sees a partly written response
+  const std::string tempPath =
+      path + "." + StringUtils::CreateUUID() + std::string(TEMP_EXTENSION);
+  XFILE::CFile file;
+  if (!file.OpenForWrite(tempPath, true) ||
+      file.Write(data.data(), data.size()) != static_cast<ssize_t>(data.size()))
+  {
+    CLog::Log(LOGWARNING, "CScraperResponseCache: failed to write {}", tempPath);
+    file.Close();
+    XFILE::CFile::Delete(tempPath);
+    return;
+  }
+  file.Close();
+
+  // not every platform replaces an existing file on rename
+  if (!XFILE::CFile::Rename(tempPath, path) &&
+      !(XFILE::CFile::Delete(path) && XFILE::CFile::Rename(tempPath, path)))
+  {
+    CLog::Log(LOGWARNING, "CScraperResponseCache: failed to replace {}", path);
+    XFILE::CFile::Delete(tempPath);
+    return;
+  }
+
+  const int64_t maxSize = static_cast<int64_t>(CServiceBroker::GetSettingsComponent()
+                                                   ->GetAdvancedSettings()
+                                                   ->m_scraperCacheMaxSize) *
+                          1024 * 1024;
+
+  std::unique_lock lock(m_critSection);
+  IndexEntry& indexEntry = m_index[URIUtils::GetFileName(path)];
+  m_size += static_cast<int64_t>(data.size()) - indexEntry.size;
+  indexEntry.size = static_cast<int64_t>(data.size());
+  indexEntry.lastUse = ++m_lastUse;
+  Evict(maxSize);
+}
+
+void CScraperResponseCache::LoadIndex()
+{
+  if (m_indexLoaded)
+    return;
+
+  m_indexLoaded = true;
+  if (!XFILE::CDirectory::Exists(m_folder))
+  {
+    XFILE::CDirectory::Create(m_folder);
+    return;
+  }
+
+  CFileItemList items;
+  XFILE::CDirectory::GetDirectory(m_folder, items, "", XFILE::DIR_FLAG_NO_FILE_DIRS);
+
+  // order the responses by modification time, a response is written whenever it is downloaded
+  // or revalidated
+  std::vector<std::pair<time_t, std::shared_ptr<CFileItem>>> files;
+  for (const auto& item : items)
+  {
+    if (item->IsFolder())
+      continue;
+
+    // left behind by a Store() that did not finish
+    if (URIUtils::HasExtension(item->GetPath(), std::string(TEMP_EXTENSION)))
+    {
+      XFILE::CFile::Delete(item->GetPath());
+      continue;
+    }
+
+    time_t modified = 0;
+    item->GetDateTime().GetAsTime(modified);
+    files.emplace_back(modified, item);
+  }
+  std::stable_sort(files.begin(), files.end(),
+                   [](const auto& a, const auto& b) { return a.first < b.first; });
+
+  for (const auto& [_, item] : files)
+  {
+    m_index[URIUtils::GetFileName(item->GetPath())] = {item->GetSize(), ++m_lastUse};
+    m_size += item->GetSize();
+  }
+}
+
+void CScraperResponseCache::Evict(int64_t maxSize)
+{
+  if (m_size <= maxSize)
+    return;
+
+  // evict down to 90% at once, so that not every store evicts
+  std::vector<std::pair<uint64_t, std::string>> entries;
+  entries.reserve(m_index.size());
+  for (const auto& [name, indexEntry] : m_index)
+    entries.emplace_back(indexEntry.lastUse, name);
+  std::sort(entries.begin(), entries.end());
+
+  const int64_t targetSize = maxSize / 10 * 9;
+  for (const auto& [lastUse, name] : entries)
+  {
+    if (m_size <= targetSize)
+      break;
+
+    XFILE::CFile::Delete(m_folder + name);
+    m_size -= m_index[name].size;
+    m_index.erase(name);
+    m_stats.evictions++;
+  }
+}
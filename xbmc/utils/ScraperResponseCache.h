@@ -0,0 +1,129 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+
+namespace XFILE
+{
+class CCurlFile;
+}
+
+/*!
+ \brief On-disk cache of the HTTP responses fetched for scrapers.
+
+ Responses are kept below the cache path, one file per scraper and URL. A cached response is used
+ without asking the server for the TTL configured for its scraper. After that it is revalidated
+ with the ETag and Last-Modified headers it was sent with, so an unchanged response costs a
+ request but no download. The least recently used responses are evicted once the cache grows
+ beyond its maximum size.
+ */
+class CScraperResponseCache
+{
+public:
+  struct Entry
+  {
+    std::string etag;
+    std::string lastModified;
+    std::string mimeType;
+    std::string charset;
+    int64_t stored = 0; //!< seconds since the epoch
+    std::string body;
+  };
+
+  struct Response
+  {
+    int code = 0; //!< HTTP status code
+    std::string cacheControl;
+    Entry entry; //!< headers and body, \ref Entry::stored is not used
+  };
+
+  /*!
+   \brief Fetches a URL, sending the validators given unless they are empty.
+   \return true if the server responded, false on failure
+   */
+  using FetchFunction = std::function<bool(const std::string& url,
+                                           const std::string& etag,
+                                           const std::string& lastModified,
+                                           Response& response)>;
+
+  struct Stats
+  {
+    unsigned int hits = 0; //!< served without a request
+    unsigned int revalidated = 0; //!< served after the server reported no change
+    unsigned int misses = 0; //!< downloaded
+    unsigned int evictions = 0;
+  };
+
+  static CScraperResponseCache& GetInstance();
+
+  /*!
+   \brief Create a cache in the given folder, GetInstance() uses one below the cache path.
+   */
+  explicit CScraperResponseCache(std::string folder);
+
+  /*!
+   \brief Get a response from the cache or the server
+   \param scraperId [in] id of the scraper add-on fetching the URL
+   \param url [in] the URL to get
+   \param http [in] the connection to fetch the URL with
+   \param body [out] the body of the response, as sent by the server
+   \param mimeType [out] the mime type of the response
+   \param charset [out] the charset reported by the server
+   \return true on success, false if the URL could not be fetched
+   */
+  bool Get(const std::string& scraperId,
+           const std::string& url,
+           XFILE::CCurlFile& http,
+           std::string& body,
+           std::string& mimeType,
+           std::string& charset);
+
+  /*!
+   \brief Get a response from the cache or fetch it with the given function
+   \sa Get
+   */
+  bool Get(const std::string& scraperId,
+           const std::string& url,
+           const FetchFunction& fetch,
+           std::string& body,
+           std::string& mimeType,
+           std::string& charset);
+
+  Stats GetStats() const;
+
+  static std::string Serialize(const Entry& entry);
+  static bool Deserialize(const std::string& data, Entry& entry);
+
+private:
+  struct IndexEntry
+  {
+    int64_t size = 0;
+    uint64_t lastUse = 0; //!< sequence number of the last use, the oldest is evicted first
+  };
+
+  std::string GetEntryPath(const std::string& scraperId, const std::string& url) const;
+  bool Load(const std::string& path, Entry& entry);
+  void Store(const std::string& path, const Entry& entry);
+  void LoadIndex();
+  void Evict(int64_t maxSize);
+
+  const std::string m_folder;
+  mutable CCriticalSection m_critSection;
+  std::map<std::string, IndexEntry> m_index; // by file name
+  int64_t m_size = 0;
+  uint64_t m_lastUse = 0;
+  bool m_indexLoaded = false;
+  Stats m_stats;
+};
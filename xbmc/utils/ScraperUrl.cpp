@@ -9,6 +9,7 @@
 #include "ScraperUrl.h"
 
 #include "CharsetConverter.h"
+#include "ScraperResponseCache.h"
 #include "ServiceBroker.h"
 #include "URIUtils.h"
 #include "URL.h"
@@ -324,6 +325,8 @@ bool CScraperUrl::Get(const SUrlEntry& scrURL,
   }
 
   auto strHTML1 = strHTML;
+  std::string mimeType;
+  std::string reportedCharset;
 
   if (scrURL.m_post)
   {
@@ -333,13 +336,16 @@ bool CScraperUrl::Get(const SUrlEntry& scrURL,
 
     if (!http.Post(url.Get(), strOptions, strHTML1))
       return false;
+
+    mimeType = http.GetProperty(XFILE::FileProperty::MIME_TYPE);
+    reportedCharset = http.GetProperty(XFILE::FileProperty::CONTENT_CHARSET);
   }
-  else if (!http.Get(url.Get(), strHTML1))
+  else if (!CScraperResponseCache::GetInstance().Get(cacheContext, url.Get(), http, strHTML1,
+                                                     mimeType, reportedCharset))
     return false;
 
   strHTML = strHTML1;
 
-  const auto mimeType = http.GetProperty(XFILE::FileProperty::MIME_TYPE);
   CMime::EFileType ftype = CMime::GetFileTypeFromMime(mimeType);
   if (ftype == CMime::FileTypeUnknown)
     ftype = CMime::GetFileTypeFromContent(strHTML);
@@ -360,7 +366,6 @@ bool CScraperUrl::Get(const SUrlEntry& scrURL,
                 scrURL.m_url);
   }
 
-  const auto reportedCharset = http.GetProperty(XFILE::FileProperty::CONTENT_CHARSET);
   if (ftype == CMime::FileTypeHtml)
   {
     std::string realHtmlCharset, converted;
@@ -0,0 +1,143 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/MessagePackVariantParser.h"
+#include "utils/MessagePackVariantWriter.h"
+#include "utils/Variant.h"
+
+#include <cstdint>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using Result = CMessagePackVariantParser::Result;
+
+namespace
+{
+std::string Bytes(std::initializer_list<uint8_t> bytes)
+{
+  return std::string(bytes.begin(), bytes.end());
+}
+} // unnamed namespace
+
+TEST(TestMessagePackVariantParser, CannotParseEmpty)
+{
+  CVariant variant;
+  ASSERT_FALSE(CMessagePackVariantParser::Parse(std::string(), variant));
+}
+
+TEST(TestMessagePackVariantParser, CannotParseInvalid)
+{
+  CVariant variant;
+  size_t length;
+  // never used marker and extension types
+  EXPECT_EQ(Result::INVALID, CMessagePackVariantParser::Parse("\xC1", 1, variant, length));
+  EXPECT_EQ(Result::INVALID, CMessagePackVariantParser::Parse("\xD4\x01\x01", 3, variant, length));
+  // maps need string keys
+  const std::string intKey = Bytes({0x81, 0x01, 0x02});
+  EXPECT_EQ(Result::INVALID,
+            CMessagePackVariantParser::Parse(intKey.data(), intKey.size(), variant, length));
+  // trailing data
+  EXPECT_FALSE(CMessagePackVariantParser::Parse(Bytes({0x01, 0x02}), variant));
+}
+
+TEST(TestMessagePackVariantParser, CannotParseDeepNesting)
+{
+  CVariant variant;
+  EXPECT_FALSE(CMessagePackVariantParser::Parse(std::string(1000, '\x91') + '\xC0', variant));
+}
+
+TEST(TestMessagePackVariantParser, CanParseScalars)
+{
+  CVariant variant;
+  ASSERT_TRUE(CMessagePackVariantParser::Parse(Bytes({0xC0}), variant));
+  EXPECT_TRUE(variant.isNull());
+
+  ASSERT_TRUE(CMessagePackVariantParser::Parse(Bytes({0xC3}), variant));
+  EXPECT_TRUE(variant.isBoolean());
+  EXPECT_TRUE(variant.asBoolean());
+
+  ASSERT_TRUE(CMessagePackVariantParser::Parse(Bytes({0x2A}), variant));
+  EXPECT_EQ(42u, variant.asUnsignedInteger());
+
+  ASSERT_TRUE(CMessagePackVariantParser::Parse(Bytes({0xFF}), variant));
+  EXPECT_TRUE(variant.isInteger());
+  EXPECT_EQ(-1, variant.asInteger());
+
+  ASSERT_TRUE(CMessagePackVariantParser::Parse(Bytes({0xD1, 0xFF, 0x7F}), variant));
+  EXPECT_EQ(-129, variant.asInteger());
+
+  ASSERT_TRUE(CMessagePackVariantParser::Parse(Bytes({0xCD, 0x01, 0x00}), variant));
+  EXPECT_EQ(256u, variant.asUnsignedInteger());
+
+  ASSERT_TRUE(CMessagePackVariantParser::Parse(Bytes({0xCA, 0x3F, 0xC0, 0x00, 0x00}), variant));
+  EXPECT_DOUBLE_EQ(1.5, variant.asDouble());
+
+  ASSERT_TRUE(CMessagePackVariantParser::Parse(Bytes({0xA3, 'a', 'b', 'c'}), variant));
+  EXPECT_EQ("abc", variant.asString());
+
+  ASSERT_TRUE(CMessagePackVariantParser::Parse(Bytes({0xC4, 0x02, 'x', 'y'}), variant));
+  EXPECT_EQ("xy", variant.asString());
+}
+
+TEST(TestMessagePackVariantParser, CanParseRequest)
+{
+  CVariant request;
+  request["jsonrpc"] = "2.0";
+  request["method"] = "VideoLibrary.GetMovies";
+  request["id"] = 1;
+  request["params"]["properties"].push_back("title");
+  request["params"]["properties"].push_back("art");
+  request["params"]["limits"]["start"] = 0;
+  request["params"]["limits"]["end"] = 500;
+
+  std::string data;
+  ASSERT_TRUE(CMessagePackVariantWriter::Write(request, data));
+
+  CVariant variant;
+  ASSERT_TRUE(CMessagePackVariantParser::Parse(data, variant));
+  EXPECT_EQ("VideoLibrary.GetMovies", variant["method"].asString());
+  EXPECT_EQ(1, variant["id"].asInteger());
+  ASSERT_EQ(2u, variant["params"]["properties"].size());
+  EXPECT_EQ("art", variant["params"]["properties"][1].asString());
+  EXPECT_EQ(500, variant["params"]["limits"]["end"].asInteger());
+}
+
+TEST(TestMessagePackVariantParser, CanParseStream)
+{
+  std::string stream;
+  ASSERT_TRUE(CMessagePackVariantWriter::Write(CVariant("first"), stream));
+  ASSERT_TRUE(CMessagePackVariantWriter::Write(CVariant("second"), stream));
+
+  CVariant variant;
+  size_t length = 0;
+
+  // every prefix of a value is reported as incomplete
+  for (size_t size = 0; size < 6; ++size)
+    EXPECT_EQ(Result::INCOMPLETE,
+              CMessagePackVariantParser::Parse(stream.data(), size, variant, length));
+
+  ASSERT_EQ(Result::OK,
+            CMessagePackVariantParser::Parse(stream.data(), stream.size(), variant, length));
+  EXPECT_EQ(6u, length);
+  EXPECT_EQ("first", variant.asString());
+
+  ASSERT_EQ(Result::OK, CMessagePackVariantParser::Parse(stream.data() + length,
+                                                         stream.size() - length, variant, length));
+  EXPECT_EQ("second", variant.asString());
+}
+
+TEST(TestMessagePackVariantParser, IncompleteContainer)
+{
+  CVariant variant;
+  size_t length;
+  // claims far more elements than there are bytes
+  const std::string data = Bytes({0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0x01});
+  EXPECT_EQ(Result::INCOMPLETE,
+            CMessagePackVariantParser::Parse(data.data(), data.size(), variant, length));
+}
@@ -0,0 +1,196 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/JSONVariantWriter.h"
+#include "utils/MessagePackVariantParser.h"
+#include "utils/MessagePackVariantWriter.h"
+#include "utils/Variant.h"
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+std::string Bytes(std::initializer_list<uint8_t> bytes)
+{
+  return std::string(bytes.begin(), bytes.end());
+}
+
+std::string Write(const CVariant& variant)
+{
+  std::string output;
+  EXPECT_TRUE(CMessagePackVariantWriter::Write(variant, output));
+  return output;
+}
+
+// roughly what VideoLibrary.GetMovies returns with artwork
+CVariant MakeLibraryResponse(int movies)
+{
+  CVariant response;
+  response["jsonrpc"] = "2.0";
+  response["id"] = 1;
+  for (int i = 0; i < movies; ++i)
+  {
+    CVariant movie;
+    movie["movieid"] = i;
+    movie["label"] = "Some Movie Title " + std::to_string(i);
+    movie["year"] = 1950 + i % 70;
+    movie["rating"] = 6.5 + (i % 30) / 10.0;
+    movie["playcount"] = i % 3;
+    movie["file"] = "smb://nas/movies/Some Movie Title " + std::to_string(i) + ".mkv";
+    movie["art"]["poster"] = "image://smb%3a%2f%2fnas%2fmovies%2fposter" + std::to_string(i) +
+                             ".jpg/";
+    movie["art"]["fanart"] = "image://smb%3a%2f%2fnas%2fmovies%2ffanart" + std::to_string(i) +
+                             ".jpg/";
+    movie["genre"].push_back("Drama");
+    movie["genre"].push_back("Thriller");
+    response["result"]["movies"].push_back(movie);
+  }
+  response["result"]["limits"]["start"] = 0;
+  response["result"]["limits"]["end"] = movies;
+  response["result"]["limits"]["total"] = movies;
+  return response;
+}
+} // unnamed namespace
+
+TEST(TestMessagePackVariantWriter, CanWriteNull)
+{
+  EXPECT_EQ(Bytes({0xC0}), Write(CVariant()));
+}
+
+TEST(TestMessagePackVariantWriter, CanWriteBoolean)
+{
+  EXPECT_EQ(Bytes({0xC3}), Write(CVariant(true)));
+  EXPECT_EQ(Bytes({0xC2}), Write(CVariant(false)));
+}
+
+TEST(TestMessagePackVariantWriter, CanWriteInteger)
+{
+  EXPECT_EQ(Bytes({0x00}), Write(CVariant(0)));
+  EXPECT_EQ(Bytes({0x7F}), Write(CVariant(127)));
+  EXPECT_EQ(Bytes({0xCC, 0x80}), Write(CVariant(128)));
+  EXPECT_EQ(Bytes({0xCD, 0x01, 0x00}), Write(CVariant(256)));
+  EXPECT_EQ(Bytes({0xCE, 0x00, 0x01, 0x00, 0x00}), Write(CVariant(65536)));
+  EXPECT_EQ(Bytes({0xCF, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00}),
+            Write(CVariant(static_cast<uint64_t>(4294967296ULL))));
+
+  EXPECT_EQ(Bytes({0xFF}), Write(CVariant(-1)));
+  EXPECT_EQ(Bytes({0xE0}), Write(CVariant(-32)));
+  EXPECT_EQ(Bytes({0xD0, 0xDF}), Write(CVariant(-33)));
+  EXPECT_EQ(Bytes({0xD1, 0xFF, 0x7F}), Write(CVariant(-129)));
+  EXPECT_EQ(Bytes({0xD2, 0xFF, 0xFF, 0x7F, 0xFF}), Write(CVariant(-32769)));
+  EXPECT_EQ(Bytes({0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00}),
+            Write(CVariant(static_cast<int64_t>(-4294967296LL))));
+}
+
+TEST(TestMessagePackVariantWriter, CanWriteDouble)
+{
+  EXPECT_EQ(Bytes({0xCB, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}), Write(CVariant(1.5)));
+}
+
+TEST(TestMessagePackVariantWriter, CanWriteString)
+{
+  EXPECT_EQ(Bytes({0xA3, 'a', 'b', 'c'}), Write(CVariant("abc")));
+  EXPECT_EQ(Bytes({0xA0}), Write(CVariant("")));
+
+  std::string str8 = Write(CVariant(std::string(32, 'x')));
+  ASSERT_EQ(34u, str8.size());
+  EXPECT_EQ(Bytes({0xD9, 0x20}), str8.substr(0, 2));
+
+  std::string str16 = Write(CVariant(std::string(256, 'x')));
+  ASSERT_EQ(259u, str16.size());
+  EXPECT_EQ(Bytes({0xDA, 0x01, 0x00}), str16.substr(0, 3));
+}
+
+TEST(TestMessagePackVariantWriter, CanWriteArray)
+{
+  CVariant variant(CVariant::VariantTypeArray);
+  EXPECT_EQ(Bytes({0x90}), Write(variant));
+
+  variant.push_back(1);
+  variant.push_back("a");
+  EXPECT_EQ(Bytes({0x92, 0x01, 0xA1, 'a'}), Write(variant));
+
+  CVariant large(CVariant::VariantTypeArray);
+  for (int i = 0; i < 16; ++i)
+    large.push_back(CVariant());
+  EXPECT_EQ(Bytes({0xDC, 0x00, 0x10}), Write(large).substr(0, 3));
+}
+
+TEST(TestMessagePackVariantWriter, CanWriteObject)
+{
+  CVariant variant(CVariant::VariantTypeObject);
+  EXPECT_EQ(Bytes({0x80}), Write(variant));
+
+  variant["a"] = true;
+  EXPECT_EQ(Bytes({0x81, 0xA1, 'a', 0xC3}), Write(variant));
+}
+
+TEST(TestMessagePackVariantWriter, Appends)
+{
+  std::string output = "x";
+  ASSERT_TRUE(CMessagePackVariantWriter::Write(CVariant(1), output));
+  EXPECT_EQ(Bytes({'x', 0x01}), output);
+}
+
+TEST(TestMessagePackVariantWriter, ComparedToJSON)
+{
+  const CVariant response = MakeLibraryResponse(2000);
+
+  std::string json;
+  ASSERT_TRUE(CJSONVariantWriter::Write(response, json, true));
+
+  std::string messagePack;
+  ASSERT_TRUE(CMessagePackVariantWriter::Write(response, messagePack));
+
+  CVariant parsed;
+  ASSERT_TRUE(CMessagePackVariantParser::Parse(messagePack, parsed));
+
+  // the same response must come back
+  EXPECT_EQ(2000u, parsed["result"]["movies"].size());
+  EXPECT_EQ(response["result"]["movies"][1999]["art"]["fanart"].asString(),
+            parsed["result"]["movies"][1999]["art"]["fanart"].asString());
+  EXPECT_DOUBLE_EQ(response["result"]["movies"][7]["rating"].asDouble(),
+                   parsed["result"]["movies"][7]["rating"].asDouble());
+
+  EXPECT_LT(messagePack.size(), json.size());
+}
+
+// Benchmark, run with --gtest_also_run_disabled_tests. Writes a large library response as compact
+// JSON and as MessagePack and parses the MessagePack back.
+TEST(TestMessagePackVariantWriter, DISABLED_WriteBenchmark)
+{
+  const CVariant response = MakeLibraryResponse(2000);
+  const auto elapsed = [](std::chrono::steady_clock::time_point start)
+  {
+    return std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(
+                              std::chrono::steady_clock::now() - start)
+                              .count());
+  };
+
+  std::string json;
+  auto start = std::chrono::steady_clock::now();
+  ASSERT_TRUE(CJSONVariantWriter::Write(response, json, true));
+  RecordProperty("json_write_us", elapsed(start));
+
+  std::string messagePack;
+  start = std::chrono::steady_clock::now();
+  ASSERT_TRUE(CMessagePackVariantWriter::Write(response, messagePack));
+  RecordProperty("messagepack_write_us", elapsed(start));
+
+  CVariant parsed;
+  start = std::chrono::steady_clock::now();
+  ASSERT_TRUE(CMessagePackVariantParser::Parse(messagePack, parsed));
+  RecordProperty("messagepack_parse_us", elapsed(start));
+
+  RecordProperty("json_bytes", std::to_string(json.size()));
+  RecordProperty("messagepack_bytes", std::to_string(messagePack.size()));
+}
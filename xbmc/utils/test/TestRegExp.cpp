@@ -14,9 +14,14 @@
 #include "filesystem/File.h"
 #include "filesystem/SpecialProtocol.h"
 #include "utils/RegExp.h"
+#include "utils/RegExpCache.h"
 #include "utils/StringUtils.h"
 #include "utils/log.h"
 
+#include <chrono>
+#include <string>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 TEST(TestRegExp, RegFind)
@@ -129,6 +134,115 @@ TEST(TestRegExp, operatorEqual)
   EXPECT_EQ(0, regexcopy.RegFind("Test string."));
 }
 
+TEST(TestRegExp, CacheSharesCompiledPatterns)
+{
+  CRegExpCache& cache = CRegExpCache::GetInstance();
+  const unsigned int hits = cache.GetHits();
+  const unsigned int misses = cache.GetMisses();
+
+  CRegExp first;
+  EXPECT_TRUE(first.RegComp("^(CacheSharesCompiledPatterns)\\s*(.*)"));
+  EXPECT_EQ(misses + 1, cache.GetMisses());
+
+  CRegExp second;
+  EXPECT_TRUE(second.RegComp("^(CacheSharesCompiledPatterns)\\s*(.*)"));
+  EXPECT_EQ(hits + 1, cache.GetHits());
+
+  // the shared code matches for both, the match data is their own
+  EXPECT_EQ(0, first.RegFind("CacheSharesCompiledPatterns first"));
+  EXPECT_EQ(0, second.RegFind("CacheSharesCompiledPatterns second"));
+  EXPECT_EQ("first", first.GetMatch(2));
+  EXPECT_EQ("second", second.GetMatch(2));
+
+  // options are part of the key
+  CRegExp caseless(true);
+  EXPECT_TRUE(caseless.RegComp("^(CacheSharesCompiledPatterns)\\s*(.*)"));
+  EXPECT_EQ(misses + 2, cache.GetMisses());
+  EXPECT_EQ(0, caseless.RegFind("CACHESHARESCOMPILEDPATTERNS"));
+}
+
+TEST(TestRegExp, NoCache)
+{
+  CRegExpCache& cache = CRegExpCache::GetInstance();
+  const unsigned int hits = cache.GetHits();
+  const unsigned int misses = cache.GetMisses();
+  const size_t size = cache.Size();
+
+  CRegExp regex;
+  EXPECT_TRUE(regex.RegComp("^(NoCache)\\s*(.*)", CRegExp::NoStudy, CRegExp::NoCache));
+  EXPECT_TRUE(regex.RegComp("^(NoCache)\\s*(.*)", CRegExp::NoStudy, CRegExp::NoCache));
+  EXPECT_EQ(0, regex.RegFind("NoCache string"));
+  EXPECT_EQ("string", regex.GetMatch(2));
+
+  EXPECT_EQ(hits, cache.GetHits());
+  EXPECT_EQ(misses, cache.GetMisses());
+  EXPECT_EQ(size, cache.Size());
+}
+
+TEST(TestRegExp, CacheEvictsLeastRecentlyUsed)
+{
+  CRegExpCache cache(2);
+  CRegExpCache::Pattern pattern;
+
+  cache.Add("a", {});
+  cache.Add("b", {});
+  EXPECT_TRUE(cache.Get("a", pattern));
+
+  cache.Add("c", {});
+  EXPECT_EQ(2u, cache.Size());
+  EXPECT_TRUE(cache.Get("a", pattern));
+  EXPECT_FALSE(cache.Get("b", pattern));
+  EXPECT_TRUE(cache.Get("c", pattern));
+
+  // adding a cached pattern again only marks it as used
+  cache.Add("a", {});
+  cache.Add("d", {});
+  EXPECT_EQ(2u, cache.Size());
+  EXPECT_TRUE(cache.Get("a", pattern));
+  EXPECT_FALSE(cache.Get("c", pattern));
+  EXPECT_TRUE(cache.Get("d", pattern));
+}
+
+// Benchmark, run with --gtest_also_run_disabled_tests. Compiles and matches the default tvshow
+// patterns against a list of filenames with a fresh CRegExp per file and pattern, as the library
+// scanner does.
+TEST(TestRegExp, DISABLED_CompileBenchmark)
+{
+  const std::vector<std::string> patterns{
+      "s([0-9]+)[ ._x-]*e([0-9]+(?:(?:[a-i]|\\.[1-9])(?![0-9]))?)([^\\\\/]*)$",
+      "[\\._ -]()[Ee][Pp]_?([0-9]+(?:(?:[a-i]|\\.[1-9])(?![0-9]))?)([^\\\\/]*)$",
+      "([0-9]{4})[\\.-]([0-9]{2})[\\.-]([0-9]{2})",
+      "([0-9]{2})[\\.-]([0-9]{2})[\\.-]([0-9]{4})",
+      "[\\\\/\\._ \\[\\(-]([0-9]+)x([0-9]+(?:(?:[a-i]|\\.[1-9])(?![0-9]))?)([^\\\\/]*)$",
+      "[\\\\/\\._ -]([0-9]+)([0-9][0-9](?:(?:[a-i]|\\.[1-9])(?![0-9]))?)([\\._ -][^\\\\/]*)$"};
+  std::vector<std::string> files;
+  for (int i = 0; i < 2000; ++i)
+    files.emplace_back(
+        StringUtils::Format("/media/tv/Show {}/Season 1/Show.S01E{:02}.mkv", i, i % 24));
+
+  const auto run = [&](CRegExp::cacheMode cache)
+  {
+    int matches = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (const auto& file : files)
+    {
+      for (const auto& pattern : patterns)
+      {
+        CRegExp regex(true, CRegExp::autoUtf8);
+        if (regex.RegComp(pattern, CRegExp::StudyWithJitComp, cache) && regex.RegFind(file) >= 0)
+          matches++;
+      }
+    }
+    EXPECT_EQ(static_cast<int>(files.size()), matches);
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::steady_clock::now() - start)
+        .count();
+  };
+
+  RecordProperty("uncached_ms", std::to_string(run(CRegExp::NoCache)));
+  RecordProperty("cached_ms", std::to_string(run(CRegExp::UseCache)));
+}
+
 class TestRegExpLog : public testing::Test
 {
 protected:
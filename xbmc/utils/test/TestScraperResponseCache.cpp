@@ -0,0 +1,277 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "ServiceBroker.h"
+#include "filesystem/Directory.h"
+#include "filesystem/File.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
+#include "utils/ScraperResponseCache.h"
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST(TestScraperResponseCache, RoundTrip)
+{
+  CScraperResponseCache::Entry entry;
+  entry.etag = "\"abc123\"";
+  entry.lastModified = "Wed, 21 Oct 2015 07:28:00 GMT";
+  entry.mimeType = "application/json";
+  entry.charset = "UTF-8";
+  entry.stored = 1760000000;
+  entry.body = std::string("{\"episodes\":[]}\n\0binary", 24);
+
+  CScraperResponseCache::Entry loaded;
+  ASSERT_TRUE(
+      CScraperResponseCache::Deserialize(CScraperResponseCache::Serialize(entry), loaded));
+  EXPECT_EQ(entry.etag, loaded.etag);
+  EXPECT_EQ(entry.lastModified, loaded.lastModified);
+  EXPECT_EQ(entry.mimeType, loaded.mimeType);
+  EXPECT_EQ(entry.charset, loaded.charset);
+  EXPECT_EQ(entry.stored, loaded.stored);
+  EXPECT_EQ(entry.body, loaded.body);
+}
+
+TEST(TestScraperResponseCache, HeaderValuesStaySingleLine)
+{
+  CScraperResponseCache::Entry entry;
+  entry.etag = "\"a\r\nb\"";
+  entry.body = "body";
+
+  CScraperResponseCache::Entry loaded;
+  ASSERT_TRUE(
+      CScraperResponseCache::Deserialize(CScraperResponseCache::Serialize(entry), loaded));
+  EXPECT_EQ("\"ab\"", loaded.etag);
+  EXPECT_EQ("body", loaded.body);
+}
+
+TEST(TestScraperResponseCache, RejectsInvalidData)
+{
+  CScraperResponseCache::Entry loaded;
+  EXPECT_FALSE(CScraperResponseCache::Deserialize("", loaded));
+  EXPECT_FALSE(CScraperResponseCache::Deserialize("<html></html>", loaded));
+  EXPECT_FALSE(CScraperResponseCache::Deserialize("SomethingElse\n\n\n\n\n0\nbody", loaded));
+
+  CScraperResponseCache::Entry entry;
+  const std::string data = CScraperResponseCache::Serialize(entry);
+  EXPECT_FALSE(CScraperResponseCache::Deserialize(data.substr(0, data.size() - 3), loaded));
+
+  // a body cut short, as by a write that did not finish
+  entry.body = "{\"episodes\":[]}";
+  const std::string full = CScraperResponseCache::Serialize(entry);
+  EXPECT_TRUE(CScraperResponseCache::Deserialize(full, loaded));
+  EXPECT_FALSE(CScraperResponseCache::Deserialize(full.substr(0, full.size() - 1), loaded));
+  EXPECT_FALSE(CScraperResponseCache::Deserialize(full + "x", loaded));
+}
+
+namespace
+{
+// Answers with the current body and ETag, with 304 if the client sent the current ETag.
+struct CFakeServer
+{
+  std::string body = "response";
+  std::string etag;
+  unsigned int requests = 0;
+
+  CScraperResponseCache::FetchFunction Fetch()
+  {
+    return [this](const std::string& url, const std::string& sentEtag,
+                  const std::string& lastModified, CScraperResponseCache::Response& response)
+    {
+      requests++;
+      if (!etag.empty() && sentEtag == etag)
+      {
+        response.code = 304;
+        return true;
+      }
+
+      response.code = 200;
+      response.entry.etag = etag;
+      response.entry.mimeType = "application/json";
+      response.entry.body = body;
+      return true;
+    };
+  }
+};
+} // unnamed namespace
+
+class TestScraperResponseCacheStore : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    const auto settings = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+    m_maxSize = settings->m_scraperCacheMaxSize;
+    m_ttl = settings->m_scraperCacheTTL;
+    settings->m_scraperCacheMaxSize = 1;
+    settings->m_scraperCacheTTL = 60;
+    XFILE::CDirectory::RemoveRecursive(FOLDER);
+  }
+
+  void TearDown() override
+  {
+    const auto settings = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+    settings->m_scraperCacheMaxSize = m_maxSize;
+    settings->m_scraperCacheTTL = m_ttl;
+    XFILE::CDirectory::RemoveRecursive(FOLDER);
+  }
+
+  static void SetTTL(int ttl)
+  {
+    CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_scraperCacheTTL = ttl;
+  }
+
+  static std::vector<std::string> GetFiles()
+  {
+    CFileItemList items;
+    XFILE::CDirectory::GetDirectory(FOLDER, items, "", XFILE::DIR_FLAG_NO_FILE_DIRS);
+    std::vector<std::string> files;
+    for (const auto& item : items)
+      files.emplace_back(item->GetPath());
+    return files;
+  }
+
+  // moves the time all cached responses were stored back by the given number of seconds
+  static void Age(int64_t seconds)
+  {
+    for (const auto& path : GetFiles())
+    {
+      std::vector<uint8_t> buffer;
+      ASSERT_GT(XFILE::CFile().LoadFile(path, buffer), 0);
+      CScraperResponseCache::Entry entry;
+      ASSERT_TRUE(CScraperResponseCache::Deserialize(
+          std::string(reinterpret_cast<char*>(buffer.data()), buffer.size()), entry));
+      entry.stored -= seconds;
+
+      const std::string data = CScraperResponseCache::Serialize(entry);
+      XFILE::CFile file;
+      ASSERT_TRUE(file.OpenForWrite(path, true));
+      ASSERT_EQ(static_cast<ssize_t>(data.size()), file.Write(data.data(), data.size()));
+    }
+  }
+
+  static bool Get(CScraperResponseCache& cache, CFakeServer& server, const std::string& url)
+  {
+    std::string body;
+    std::string mimeType;
+    std::string charset;
+    return cache.Get("metadata.test", url, server.Fetch(), body, mimeType, charset) &&
+           body == server.body && mimeType == "application/json";
+  }
+
+  static constexpr const char* FOLDER = "special://temp/scraperresponsecache/";
+
+private:
+  int m_maxSize = 0;
+  int m_ttl = 0;
+};
+
+TEST_F(TestScraperResponseCacheStore, TTLExpiry)
+{
+  CScraperResponseCache cache(FOLDER);
+  CFakeServer server;
+
+  EXPECT_TRUE(Get(cache, server, "https://example.org/1"));
+  EXPECT_TRUE(Get(cache, server, "https://example.org/1"));
+  EXPECT_EQ(1u, server.requests);
+
+  Age(59 * 60);
+  EXPECT_TRUE(Get(cache, server, "https://example.org/1"));
+  EXPECT_EQ(1u, server.requests);
+
+  // expired and without validators, so downloaded again
+  Age(2 * 60);
+  server.body = "changed";
+  EXPECT_TRUE(Get(cache, server, "https://example.org/1"));
+  EXPECT_EQ(2u, server.requests);
+
+  const auto stats = cache.GetStats();
+  EXPECT_EQ(2u, stats.hits);
+  EXPECT_EQ(0u, stats.revalidated);
+  EXPECT_EQ(2u, stats.misses);
+  EXPECT_EQ(1u, GetFiles().size());
+}
+
+TEST_F(TestScraperResponseCacheStore, Revalidation)
+{
+  // without a TTL every use asks the server
+  SetTTL(0);
+  CScraperResponseCache cache(FOLDER);
+  CFakeServer server;
+  server.etag = "\"v1\"";
+
+  EXPECT_TRUE(Get(cache, server, "https://example.org/1"));
+  EXPECT_TRUE(Get(cache, server, "https://example.org/1"));
+  EXPECT_EQ(2u, server.requests);
+  EXPECT_EQ(1u, cache.GetStats().revalidated);
+
+  server.etag = "\"v2\"";
+  server.body = "changed";
+  EXPECT_TRUE(Get(cache, server, "https://example.org/1"));
+  EXPECT_TRUE(Get(cache, server, "https://example.org/1"));
+  EXPECT_EQ(4u, server.requests);
+
+  const auto stats = cache.GetStats();
+  EXPECT_EQ(0u, stats.hits);
+  EXPECT_EQ(2u, stats.revalidated);
+  EXPECT_EQ(2u, stats.misses);
+
+  // without a TTL or validators there is nothing to keep
+  CFakeServer uncacheable;
+  EXPECT_TRUE(Get(cache, uncacheable, "https://example.org/2"));
+  EXPECT_EQ(1u, GetFiles().size());
+}
+
+TEST_F(TestScraperResponseCacheStore, SizeBasedEviction)
+{
+  CScraperResponseCache cache(FOLDER);
+  CFakeServer server;
+  server.body = std::string(300 * 1024, 'x');
+
+  // 900 KiB, below the maximum of 1 MiB
+  for (const char* url : {"https://example.org/1", "https://example.org/2", "https://example.org/3"})
+    EXPECT_TRUE(Get(cache, server, url));
+  EXPECT_EQ(3u, GetFiles().size());
+  EXPECT_EQ(0u, cache.GetStats().evictions);
+
+  // the least recently used response is evicted, not the first one stored
+  EXPECT_TRUE(Get(cache, server, "https://example.org/1"));
+  EXPECT_TRUE(Get(cache, server, "https://example.org/4"));
+  EXPECT_EQ(3u, GetFiles().size());
+  EXPECT_EQ(1u, cache.GetStats().evictions);
+  EXPECT_EQ(4u, server.requests);
+
+  for (const char* url : {"https://example.org/1", "https://example.org/3", "https://example.org/4"})
+    EXPECT_TRUE(Get(cache, server, url));
+  EXPECT_EQ(4u, server.requests);
+
+  EXPECT_TRUE(Get(cache, server, "https://example.org/2"));
+  EXPECT_EQ(5u, server.requests);
+}
+
+// a new instance, as after a restart, picks up the responses stored and their order of use
+TEST_F(TestScraperResponseCacheStore, IndexLoadedFromFolder)
+{
+  CFakeServer server;
+  {
+    CScraperResponseCache cache(FOLDER);
+    EXPECT_TRUE(Get(cache, server, "https://example.org/1"));
+  }
+  ASSERT_TRUE(XFILE::CFile().OpenForWrite(GetFiles().front() + ".0.tmp", true));
+
+  CScraperResponseCache cache(FOLDER);
+  EXPECT_TRUE(Get(cache, server, "https://example.org/1"));
+  EXPECT_EQ(1u, server.requests);
+  EXPECT_EQ(1u, cache.GetStats().hits);
+  // the file a write did not finish is removed
+  EXPECT_EQ(1u, GetFiles().size());
+}
@@ -0,0 +1,143 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "StreamDetailsProber.h"
+
+#include "FileItem.h"
+#include "URL.h"
+#include "cores/VideoPlayer/DVDFileInfo.h"
+#include "threads/Thread.h"
+#include "utils/log.h"
+#include "video/VideoInfoTag.h"
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+
+using namespace KODI::VIDEO;
+
+CStreamDetailsProber::CStreamDetailsProber(unsigned int threads,
+                                           size_t maxPending,
+                                           ProbeFunction probe /* = {} */)
+  : m_maxPending(std::max<size_t>(maxPending, 1)),
+    m_probe(probe ? std::move(probe)
+                  : [](CFileItem& item) { return CDVDFileInfo::GetFileStreamDetails(&item); })
+{
+  for (unsigned int i = 0; i < std::max(threads, 1u); ++i)
+  {
+    m_threads.emplace_back(std::make_unique<CThread>(this, "StreamDetailsProber"));
+    m_threads.back()->Create();
+  }
+}
+
+CStreamDetailsProber::~CStreamDetailsProber()
+{
+  Cancel();
+  m_stop = true;
+  m_dequeued.Set();
+  for (auto& thread : m_threads)
+  {
+    m_queued.Set();
+    thread->StopThread();
+  }
+}
+
+void CStreamDetailsProber::Probe(int idFile, const CFileItem& item)
+{
+  {
+    std::unique_lock lock(m_critSection);
+    while (m_pending >= m_maxPending && !m_stop)
+    {
+      lock.unlock();
+      m_dequeued.Wait(std::chrono::milliseconds(100));
+      lock.lock();
+    }
+
+    m_tasks.push_back({idFile, std::make_unique<CFileItem>(item)});
+    m_pending++;
+    m_idle.Reset();
+  }
+  m_queued.Set();
+}
+
+size_t CStreamDetailsProber::GetResultCount() const
+{
+  std::unique_lock lock(m_critSection);
+  return m_results.size();
+}
+
+std::vector<CStreamDetailsProber::Result> CStreamDetailsProber::TakeResults()
+{
+  std::vector<Result> results;
+  std::unique_lock lock(m_critSection);
+  results.swap(m_results);
+  return results;
+}
+
+bool CStreamDetailsProber::Wait(std::chrono::milliseconds timeout)
+{
+  return m_idle.Wait(timeout);
+}
+
+void CStreamDetailsProber::Cancel()
+{
+  {
+    std::unique_lock lock(m_critSection);
+    m_pending -= m_tasks.size();
+    m_tasks.clear();
+    if (m_pending == 0)
+      m_idle.Set();
+  }
+  m_dequeued.Set();
+}
+
+void CStreamDetailsProber::TaskDone()
+{
+  {
+    std::unique_lock lock(m_critSection);
+    if (--m_pending == 0)
+      m_idle.Set();
+  }
+  m_dequeued.Set();
+}
+
+void CStreamDetailsProber::Run()
+{
+  while (!m_stop)
+  {
+    Task task;
+    {
+      std::unique_lock lock(m_critSection);
+      if (!m_tasks.empty())
+      {
+        task = std::move(m_tasks.front());
+        m_tasks.pop_front();
+        // more work is waiting, pass the wake-up on to another thread
+        if (!m_tasks.empty())
+          m_queued.Set();
+      }
+    }
+
+    if (!task.item)
+    {
+      m_queued.Wait(std::chrono::milliseconds(100));
+      continue;
+    }
+
+    if (m_probe(*task.item))
+    {
+      CLog::Log(LOGDEBUG, "StreamDetailsProber: Extracted filestream details from video file {}",
+                CURL::GetRedacted(task.item->GetVideoInfoTag()->m_strFileNameAndPath));
+
+      std::unique_lock lock(m_critSection);
+      m_results.push_back({task.idFile, task.item->GetVideoInfoTag()->m_streamDetails});
+    }
+
+    TaskDone();
+  }
+}
@@ -0,0 +1,108 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+#include "threads/Event.h"
+#include "threads/IRunnable.h"
+#include "utils/StreamDetails.h"
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <vector>
+
+class CFileItem;
+class CThread;
+
+namespace KODI::VIDEO
+{
+
+/*!
+ \brief Pool of threads probing the stream details of video files.
+
+ Probing opens the file and lets the demuxer read its headers, which takes the better part of a
+ second on network shares. The video scanner queues the files it added and carries on scraping
+ while they are probed, the stream details are then written to the database in batches. The
+ number of files in flight is bounded, queueing blocks while the queue is full.
+ */
+class CStreamDetailsProber : public IRunnable
+{
+public:
+  struct Result
+  {
+    int idFile;
+    CStreamDetails details;
+  };
+
+  //! Probes a file and stores the stream details in its video info tag, false on failure
+  using ProbeFunction = std::function<bool(CFileItem& item)>;
+
+  /*!
+   \param threads number of files probed at once
+   \param maxPending number of files queued or being probed before queueing blocks
+   \param probe probes a file, CDVDFileInfo::GetFileStreamDetails() if empty
+   */
+  CStreamDetailsProber(unsigned int threads, size_t maxPending, ProbeFunction probe = {});
+  ~CStreamDetailsProber() override;
+
+  /*!
+   \brief Queue a file for probing its stream details
+   \param idFile database id of the file, passed on with the result
+   \param item the file, copied
+   */
+  void Probe(int idFile, const CFileItem& item);
+
+  /*!
+   \brief Number of files probed whose results were not taken yet
+   */
+  size_t GetResultCount() const;
+
+  /*!
+   \brief Take the stream details of the files probed so far
+   */
+  std::vector<Result> TakeResults();
+
+  /*!
+   \brief Wait until all queued files were probed
+   \return true if no file is pending, false on timeout
+   */
+  bool Wait(std::chrono::milliseconds timeout);
+
+  /*!
+   \brief Drop all queued files, files being probed are finished
+   */
+  void Cancel();
+
+private:
+  void Run() override;
+  void TaskDone();
+
+  struct Task
+  {
+    int idFile{-1};
+    std::unique_ptr<CFileItem> item;
+  };
+
+  const size_t m_maxPending;
+  const ProbeFunction m_probe;
+  mutable CCriticalSection m_critSection;
+  std::deque<Task> m_tasks;
+  size_t m_pending{0}; //!< files queued or being probed
+  std::vector<Result> m_results;
+  CEvent m_queued;
+  CEvent m_dequeued;
+  CEvent m_idle{true, true};
+  std::atomic<bool> m_stop{false};
+  std::vector<std::unique_ptr<CThread>> m_threads;
+};
+
+} // namespace KODI::VIDEO
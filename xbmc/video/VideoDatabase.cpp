@@ -79,6 +79,11 @@ using namespace KODI::MESSAGING;
 using namespace KODI::GUILIB;
 using namespace KODI::VIDEO;
 
+namespace
+{
+constexpr unsigned int IMPORT_ITEMS_PER_COMMIT = 50;
+} // unnamed namespace
+
 //********************************************************************************************************************************
 CVideoDatabase::CVideoDatabase() = default;
 
@@ -387,6 +392,16 @@ void CVideoDatabase::CreateAnalytics()
   CreateViews();
 }
 
+std::vector<std::string> CVideoDatabase::GetDeferrableAnalytics() const
+{
+  // Indices not used when adding items. The triggers only act on deletes, they are kept.
+  std::vector<std::string> analytics{"ix_episode_bookmark", "ix_movie_title", "ix_tvshow_title",
+                                     "ix_actor_link_3"};
+  for (const char* table : {"tag", "director", "writer", "studio", "genre", "country"})
+    analytics.emplace_back(StringUtils::Format("ix_{}_link_3", table));
+  return analytics;
+}
+
 void CVideoDatabase::CreateViews()
 {
   CLog::Log(LOGINFO, "create episode_view");
@@ -12290,6 +12305,19 @@ void CVideoDatabase::ImportFromXML(const std::string &path)
       }
       pathElem = pathElem->NextSiblingElement();
     }
+
+    // The items are added through the scanner's connection, committed every few items so other
+    // writers are not held off for the whole import. Everything read or written below must use
+    // that connection, another one would wait for the open transaction. If the import fails,
+    // closing the connection rolls back the last batch. Deferred indices are created again at
+    // the next start then.
+    CVideoDatabase& importDb = scanner.GetDatabase();
+    if (!importDb.Open())
+      return;
+    importDb.BeginBulkImport(
+        IMPORT_ITEMS_PER_COMMIT,
+        CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_bVideoLibraryDeferIndices);
+
     movie = root->FirstChildElement();
     std::string lastTitle;
     int lastMovieId{-1};
@@ -12301,7 +12329,8 @@ void CVideoDatabase::ImportFromXML(const std::string &path)
         CVideoInfoTag info;
         info.Load(movie);
         CFileItem item(info);
-        bool useFolders = info.m_basePath.empty() ? LookupByFolders(item.GetPath()) : false;
+        bool useFolders =
+            info.m_basePath.empty() ? importDb.LookupByFolders(item.GetPath()) : false;
         currentTitle = info.m_strTitle;
 
         std::string filename = info.m_strTitle;
@@ -12347,11 +12376,12 @@ void CVideoDatabase::ImportFromXML(const std::string &path)
         {
           // Set version (AddVideo() ultimately uses AddNewMovie() which defaults to standard version)
           CVideoInfoTag* tag{item.GetVideoInfoTag()};
-          SetVideoVersion(tag->m_iFileId, tag->GetAssetInfo().GetId());
+          importDb.SetVideoVersion(tag->m_iFileId, tag->GetAssetInfo().GetId());
 
           // Set default version
           if (tag->IsDefaultVideoVersion())
-            SetDefaultVideoVersion(VideoDbContentType::MOVIES, lastMovieId, tag->m_iFileId);
+            importDb.SetDefaultVideoVersion(VideoDbContentType::MOVIES, lastMovieId,
+                                            tag->m_iFileId);
         }
         scanner.AddVideo(&item, nullptr, useFolders, true, nullptr, true, ContentType::MOVIES);
         current++;
@@ -12361,7 +12391,8 @@ void CVideoDatabase::ImportFromXML(const std::string &path)
         CVideoInfoTag info;
         info.Load(movie);
         CFileItem item(info);
-        bool useFolders = info.m_basePath.empty() ? LookupByFolders(item.GetPath()) : false;
+        bool useFolders =
+            info.m_basePath.empty() ? importDb.LookupByFolders(item.GetPath()) : false;
         currentTitle = info.m_strTitle;
 
         std::string filename = StringUtils::Join(info.m_artist, CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_videoItemSeparator) + "." + info.m_strTitle;
@@ -12383,9 +12414,10 @@ void CVideoDatabase::ImportFromXML(const std::string &path)
         currentTitle = info.m_strTitle;
 
         URIUtils::AddSlashAtEnd(info.m_strPath);
-        DeleteTvShow(info.m_strPath);
+        importDb.DeleteTvShow(info.m_strPath);
         CFileItem showItem(info);
-        bool useFolders = info.m_basePath.empty() ? LookupByFolders(showItem.GetPath(), true) : false;
+        bool useFolders =
+            info.m_basePath.empty() ? importDb.LookupByFolders(showItem.GetPath(), true) : false;
         CFileItem artItem(showItem);
         std::string artPath(GetSafeFile(tvshowsDir, info.m_strTitle));
         artItem.SetPath(artPath);
@@ -12400,8 +12432,8 @@ void CVideoDatabase::ImportFromXML(const std::string &path)
                                            CVideoThumbLoader::GetArtTypes(MediaTypeSeason), true);
         for (const auto& [seasonNumber, art] : seasonArt)
         {
-          const int seasonID = AddSeason(showID, seasonNumber);
-          SetArtForItem(seasonID, MediaTypeSeason, art);
+          const int seasonID = importDb.AddSeason(showID, seasonNumber);
+          importDb.SetArtForItem(seasonID, MediaTypeSeason, art);
         }
         current++;
         // now load the episodes
@@ -12432,6 +12464,7 @@ void CVideoDatabase::ImportFromXML(const std::string &path)
         current++;
       }
       movie = movie->NextSiblingElement();
+      importDb.BulkImportItemDone();
       if (progress && total)
       {
         progress->SetPercentage(current * 100 / total);
@@ -12439,11 +12472,16 @@ void CVideoDatabase::ImportFromXML(const std::string &path)
         progress->Progress();
         if (progress->IsCanceled())
         {
+          // keep what was imported so far
+          importDb.CommitBulkImport();
+          importDb.Close();
           progress->Close();
           return;
         }
       }
     }
+    importDb.CommitBulkImport();
+    importDb.Close();
   }
   catch (...)
   {
@@ -12533,7 +12571,12 @@ void CVideoDatabase::InvalidatePathHash(const std::string& strPath)
 bool CVideoDatabase::CommitTransaction()
 {
   if (CDatabase::CommitTransaction())
-  { // number of items in the db has likely changed, so recalculate
+  {
+    // the items of a bulk import are counted once it is done
+    if (InBulkImport())
+      return true;
+
+    // number of items in the db has likely changed, so recalculate
     GUIINFO::CLibraryGUIInfo& guiInfo = CServiceBroker::GetGUI()->GetInfoManager().GetInfoProviders().GetLibraryInfoProvider();
     guiInfo.SetLibraryBool(LIBRARY_HAS_MOVIES, HasContent(VideoDbContentType::MOVIES));
     guiInfo.SetLibraryBool(LIBRARY_HAS_TVSHOWS, HasContent(VideoDbContentType::TVSHOWS));
@@ -1545,6 +1545,7 @@ private:
   int GetSchemaVersion() const override;
   virtual int GetExportVersion() const { return 1; }
   const char* GetBaseDBName() const override { return "MyVideos"; }
+  std::vector<std::string> GetDeferrableAnalytics() const override;
 
   void ConstructPath(std::string& strDest,
                      const std::string& strPath,
@@ -8,7 +8,6 @@
 
 #include "VideoGeneratedImageFileLoader.h"
 
-#include "DVDFileInfo.h"
 #include "FileItem.h"
 #include "ServiceBroker.h"
 #include "URL.h"
@@ -20,6 +19,7 @@
 #include "utils/URIUtils.h"
 #include "video/VideoFileItemClassify.h"
 #include "video/VideoInfoTag.h"
+#include "video/VideoThumbExtractor.h"
 
 #include <charconv>
 
@@ -74,7 +74,7 @@ std::unique_ptr<CTexture> CVideoGeneratedImageFileLoader::Load(
   int chapter = 0;
   std::from_chars(chapterOption.data(), chapterOption.data() + chapterOption.size(), chapter);
 
-  return CDVDFileInfo::ExtractThumbToTexture(item, chapter);
+  return CVideoThumbExtractor::GetInstance().Extract(item, chapter);
 }
 
 } // namespace KODI::VIDEO
@@ -14,6 +14,7 @@
 #include "GUIUserMessages.h"
 #include "ServiceBroker.h"
 #include "SetInfoTag.h"
+#include "StreamDetailsProber.h"
 #include "TextureCache.h"
 #include "URL.h"
 #include "Util.h"
@@ -40,13 +41,17 @@
 #include "settings/SettingsComponent.h"
 #include "tags/SetInfoTagLoaderFactory.h"
 #include "tags/VideoInfoTagLoaderFactory.h"
+#include "threads/IRunnable.h"
+#include "threads/Thread.h"
 #include "utils/ArtUtils.h"
 #include "utils/Digest.h"
 #include "utils/FileExtensionProvider.h"
 #include "utils/RegExp.h"
+#include "utils/ScraperResponseCache.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/Variant.h"
+#include "utils/XTimeUtils.h"
 #include "utils/log.h"
 #include "video/VideoFileItemClassify.h"
 #include "video/VideoInfoTag.h"
@@ -57,6 +62,9 @@
 #include "video/dialogs/GUIDialogVideoManagerVersions.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
 #include <memory>
 #include <ranges>
 #include <set>
@@ -68,6 +76,7 @@ using namespace XFILE;
 using namespace ADDON;
 using namespace KODI::MESSAGING;
 using namespace KODI;
+using namespace std::chrono_literals;
 
 using KODI::MESSAGING::HELPERS::DialogResponse;
 using KODI::UTILITY::CDigest;
@@ -88,6 +97,12 @@ constexpr int MAX_EPISODE_RANGE = 50;
 // Character following season/episode range must be one of these for range to be valid.
 constexpr std::string_view allowed{"-_.esx "};
 
+// Files queued for probing per probe thread, before adding items waits for the probes
+constexpr size_t PENDING_PROBES_PER_THREAD = 8;
+
+// Probed stream details are written in one transaction once this many are waiting
+constexpr size_t STREAMDETAILS_PER_COMMIT = 50;
+
 /*! \brief Perform checks, then add episodes in a given range to the episode list
  \param first first episode in the range to add.
  \param last last episode in the range.
@@ -226,13 +241,75 @@ void OnDirectoryScanned(const std::string& strDirectory)
   CServiceBroker::GetGUI()->GetWindowManager().SendThreadMessage(msg);
 }
 
+// paths sharing a disk or a host compete for the same I/O
+std::string GetStorageKey(const std::string& path)
+{
+  const CURL url(path);
+  if (!url.IsLocal())
+    return url.GetProtocol() + "://" + url.GetHostName();
+
+  struct __stat64 st;
+  if (XFILE::CFile::Stat(path, &st) == 0)
+    return "dev://" + std::to_string(st.st_dev);
+  return "";
+}
+
 } // namespace
 
 namespace KODI::VIDEO
 {
 
+/*!
+ \brief Worker of a concurrent scan, scanning the paths of one storage device or host.
+
+ Workers are run by a fixed number of threads, each taking the next worker when done.
+ */
+class CVideoInfoScanner::CSourceWorker : public IRunnable
+{
+public:
+  explicit CSourceWorker(std::vector<std::unique_ptr<CVideoInfoScanner>>& scanners)
+    : m_scanners(scanners)
+  {
+  }
+
+  void Run() override
+  {
+    for (size_t i = m_next++; i < m_scanners.size(); i = m_next++)
+    {
+      CVideoInfoScanner& scanner = *m_scanners[i];
+      if (!scanner.m_database.Open())
+      {
+        // the scan is incomplete, it must neither clean the library nor commit the journal
+        CLog::Log(LOGERROR, "VideoInfoScanner: Failed to open the database, {} paths not scanned",
+                  scanner.m_pathsToScan.size());
+        scanner.m_bStop = true;
+        m_failed++;
+        m_finished++;
+        continue;
+      }
+
+      scanner.m_bRunning = true;
+      if (!scanner.ScanPaths())
+        scanner.m_bStop = true;
+      scanner.m_bRunning = false;
+      scanner.m_database.Close();
+      m_finished++;
+    }
+  }
+
+  size_t GetFinished() const { return m_finished; }
+  size_t GetFailed() const { return m_failed; }
+
+private:
+  std::vector<std::unique_ptr<CVideoInfoScanner>>& m_scanners;
+  std::atomic<size_t> m_next{0};
+  std::atomic<size_t> m_finished{0};
+  std::atomic<size_t> m_failed{0};
+};
+
 CVideoInfoScanner::CVideoInfoScanner()
-  : m_advancedSettings(CServiceBroker::GetSettingsComponent()->GetAdvancedSettings())
+  : m_advancedSettings(CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()),
+    m_shared(std::make_shared<SharedState>())
 {
   m_bStop = false;
   m_scanAll = false;
@@ -296,37 +373,30 @@ CVideoInfoScanner::~CVideoInfoScanner()
       // result in unexpected behaviour.
       m_bCanInterrupt = false;
 
-      bool bCancelled = false;
-      while (!bCancelled && !m_pathsToScan.empty())
+      // stream details are probed while the scan carries on, unless they are not wanted
+      const int probeThreads = m_advancedSettings->m_iVideoLibraryProbeThreads;
+      if (probeThreads > 0 && settings->GetBool(CSettings::SETTING_MYVIDEOS_EXTRACTFLAGS))
+        m_shared->prober = std::make_unique<CStreamDetailsProber>(
+            probeThreads, probeThreads * PENDING_PROBES_PER_THREAD);
+
+      const int workers = m_advancedSettings->m_iVideoLibraryScanWorkers;
+      const bool bCancelled = workers > 1 ? !ScanConcurrently(workers) : !ScanPaths();
+
+      if (m_shared->prober)
       {
-        /*
-         * A copy of the directory path is used because the path supplied is
-         * immediately removed from the m_pathsToScan set in DoScan(). If the
-         * reference points to the entry in the set a null reference error
-         * occurs.
-         */
-        std::string directory = *m_pathsToScan.begin();
-        if (m_bStop)
-        {
-          bCancelled = true;
-        }
-        else if (!CDirectory::Exists(directory))
-        {
-          /*
-           * Note that this will skip clean (if m_bClean is enabled) if the directory really
-           * doesn't exist rather than a NAS being switched off.  A manual clean from settings
-           * will still pick up and remove it though.
-           */
-          CLog::Log(LOGWARNING, "{} directory '{}' does not exist - skipping scan{}.", __FUNCTION__,
-                    CURL::GetRedacted(directory), m_bClean ? " and clean" : "");
-          m_pathsToScan.erase(m_pathsToScan.begin());
-        }
-        else if (!DoScan(directory))
-          bCancelled = true;
+        // Also after a cancel, the files queued are in the library and the hash of their folder
+        // is stored already. A later scan would skip them, so they are probed anyway. The queue
+        // holds no more than PENDING_PROBES_PER_THREAD files per thread.
+        auto writerLock = LockWriter();
+        while (!m_shared->prober->Wait(100ms))
+          WriteStreamDetails(STREAMDETAILS_PER_COMMIT);
+        WriteStreamDetails(0);
+        m_shared->prober.reset();
       }
 
       if (!bCancelled)
       {
+        CommitChangeJournal("video");
         if (m_bClean)
           m_database.CleanDatabase(m_handle, m_pathsToClean, false);
         else
@@ -345,6 +415,12 @@ CVideoInfoScanner::~CVideoInfoScanner()
 
       CLog::Log(LOGINFO, "VideoInfoScanner: Finished scan. Scanning for video info took {} ms",
                 duration.count());
+
+      const auto cacheStats = CScraperResponseCache::GetInstance().GetStats();
+      CLog::Log(LOGDEBUG,
+                "VideoInfoScanner: Scraper response cache totals: {} hits, {} not modified, {} "
+                "misses, {} evicted",
+                cacheStats.hits, cacheStats.revalidated, cacheStats.misses, cacheStats.evictions);
     }
     catch (...)
     {
@@ -392,6 +468,12 @@ CVideoInfoScanner::~CVideoInfoScanner()
     m_database.Close();
     m_bClean = m_advancedSettings->m_bVideoLibraryCleanOnUpdate;
 
+    // only updates of the whole library can rely on the changes journaled since the last one,
+    // movies and tv shows span several folders and are rescanned from their top folder
+    m_journaledPaths.clear();
+    if (strDirectory.empty() && m_advancedSettings->m_bVideoLibraryUseChangeJournal)
+      ApplyChangeJournal("video", true);
+
     m_bRunning = true;
     Process();
   }
@@ -402,6 +484,155 @@ CVideoInfoScanner::~CVideoInfoScanner()
       m_database.Interrupt();
 
     m_bStop = true;
+
+    std::unique_lock lock(m_workersSection);
+    for (auto* worker : m_workers)
+      worker->Stop();
+  }
+
+  void CVideoInfoScanner::WriteStreamDetails(size_t minResults)
+  {
+    if (!m_shared->prober || m_shared->prober->GetResultCount() < std::max<size_t>(minResults, 1))
+      return;
+
+    if (!m_database.Open())
+      return;
+
+    const auto results = m_shared->prober->TakeResults();
+    m_database.BeginTransaction();
+    for (const auto& result : results)
+      m_database.SetStreamDetailsForFileId(result.details, result.idFile);
+    m_database.CommitTransaction();
+    m_database.Close();
+
+    CLog::Log(LOGDEBUG, "VideoInfoScanner: Wrote stream details of {} files", results.size());
+  }
+
+  bool CVideoInfoScanner::ScanPaths()
+  {
+    while (!m_pathsToScan.empty())
+    {
+      /*
+       * A copy of the directory path is used because the path supplied is
+       * immediately removed from the m_pathsToScan set in DoScan(). If the
+       * reference points to the entry in the set a null reference error
+       * occurs.
+       */
+      std::string directory = *m_pathsToScan.begin();
+      if (m_bStop)
+        return false;
+
+      if (!CDirectory::Exists(directory))
+      {
+        /*
+         * Note that this will skip clean (if m_bClean is enabled) if the directory really
+         * doesn't exist rather than a NAS being switched off.  A manual clean from settings
+         * will still pick up and remove it though.
+         */
+        CLog::Log(LOGWARNING, "{} directory '{}' does not exist - skipping scan{}.", __FUNCTION__,
+                  CURL::GetRedacted(directory), m_bClean ? " and clean" : "");
+        m_pathsToScan.erase(m_pathsToScan.begin());
+      }
+      else if (!DoScan(directory))
+        return false;
+    }
+    return true;
+  }
+
+  bool CVideoInfoScanner::ScanConcurrently(int maxWorkers)
+  {
+    std::map<std::string, std::vector<std::string>> storages;
+    for (const auto& path : m_pathsToScan)
+      storages[GetStorageKey(path)].push_back(path);
+
+    if (storages.size() < 2)
+      return ScanPaths();
+
+    std::vector<std::unique_ptr<CVideoInfoScanner>> scanners;
+    for (const auto& [storage, paths] : storages)
+    {
+      auto scanner = std::make_unique<CVideoInfoScanner>();
+      scanner->m_pathsToScan.insert(paths.begin(), paths.end());
+      scanner->m_bClean = m_bClean;
+      scanner->m_scanAll = m_scanAll;
+      scanner->m_ignoreVideoVersions = m_ignoreVideoVersions;
+      scanner->m_ignoreVideoExtras = m_ignoreVideoExtras;
+      scanner->m_shared = m_shared;
+      scanner->m_handle = m_handle;
+      scanner->m_isWorker = true;
+      scanners.push_back(std::move(scanner));
+    }
+    m_pathsToScan.clear();
+
+    {
+      std::unique_lock lock(m_workersSection);
+      for (const auto& scanner : scanners)
+      {
+        scanner->m_bStop = m_bStop;
+        m_workers.push_back(scanner.get());
+      }
+    }
+
+    const size_t threadCount = std::min(static_cast<size_t>(maxWorkers), scanners.size());
+    CLog::Log(LOGINFO, "VideoInfoScanner: Scanning {} storages with {} workers", scanners.size(),
+              threadCount);
+
+    CSourceWorker worker(scanners);
+    std::vector<std::unique_ptr<CThread>> threads;
+    for (size_t i = 0; i < threadCount; ++i)
+    {
+      threads.emplace_back(std::make_unique<CThread>(&worker, "VideoInfoScanner"));
+      threads.back()->Create();
+    }
+
+    // the workers show what they scan, the overall progress is reported by this thread
+    for (const auto& thread : threads)
+    {
+      while (!thread->Join(500ms))
+      {
+        if (m_handle)
+          m_handle->SetProgress(static_cast<int>(worker.GetFinished()),
+                                static_cast<int>(scanners.size()));
+      }
+    }
+
+    if (worker.GetFailed() > 0)
+      CLog::Log(LOGERROR,
+                "VideoInfoScanner: {} of {} storages could not be scanned, the scan is incomplete",
+                worker.GetFailed(), scanners.size());
+
+    bool completed = !m_bStop;
+    {
+      std::unique_lock lock(m_workersSection);
+      m_workers.clear();
+    }
+    for (const auto& scanner : scanners)
+    {
+      completed = completed && !scanner->m_bStop;
+      m_pathsToClean.insert(scanner->m_pathsToClean.begin(), scanner->m_pathsToClean.end());
+    }
+    return completed;
+  }
+
+  std::unique_lock<CCriticalSection> CVideoInfoScanner::LockScraper()
+  {
+    std::unique_lock lock(m_shared->scraperSection);
+
+    const auto now = std::chrono::steady_clock::now();
+    if (m_shared->nextScraperCall > now)
+      KODI::TIME::Sleep(std::chrono::duration_cast<std::chrono::milliseconds>(
+          m_shared->nextScraperCall - now));
+
+    m_shared->nextScraperCall =
+        std::chrono::steady_clock::now() +
+        std::chrono::milliseconds(m_advancedSettings->m_iVideoLibraryScraperInterval);
+    return lock;
+  }
+
+  std::unique_lock<CCriticalSection> CVideoInfoScanner::LockWriter()
+  {
+    // each worker has its own connection, SQLite lets only one of them write at a time
+    return std::unique_lock(m_shared->writerSection);
   }
 
   bool CVideoInfoScanner::DoScan(const std::string& strDirectory)
@@ -549,6 +780,7 @@ CVideoInfoScanner::~CVideoInfoScanner()
       {
         if (!m_bStop && (content == ContentType::MOVIES || content == ContentType::MUSICVIDEOS))
         {
+          auto writerLock = LockWriter();
           m_database.SetPathHash(strDirectory, hash);
           if (m_bClean)
             m_pathsToClean.insert(m_database.GetPathId(strDirectory));
@@ -567,6 +799,7 @@ CVideoInfoScanner::~CVideoInfoScanner()
     else if (!StringUtils::EqualsNoCase(hash, dbHash) &&
              (content == ContentType::MOVIES || content == ContentType::MUSICVIDEOS))
     { // update the hash either way - we may have changed the hash to a fast version
+      auto writerLock = LockWriter();
       m_database.SetPathHash(strDirectory, hash);
     }
 
@@ -718,7 +951,7 @@ CVideoInfoScanner::~CVideoInfoScanner()
 
       if (info2->Content() == ContentType::MOVIES || info2->Content() == ContentType::MUSICVIDEOS)
       {
-        if (m_handle)
+        if (m_handle && !m_isWorker)
           m_handle->SetPercentage(i*100.f/items.Size());
       }
 
@@ -837,7 +1070,10 @@ CVideoInfoScanner::~CVideoInfoScanner()
     {
       InfoRet ret = RetrieveInfoForEpisodes(pItem, idTvShow, info2, useLocal, pDlgProgress);
       if (ret == InfoRet::ADDED)
+      {
+        auto writerLock = LockWriter();
         m_database.SetPathHash(strPath, pItem->GetProperty("hash").asString());
+      }
       return ret;
     }
 
@@ -866,7 +1102,10 @@ CVideoInfoScanner::~CVideoInfoScanner()
       {
         InfoRet ret = RetrieveInfoForEpisodes(pItem, lResult, info2, useLocal, pDlgProgress);
         if (ret == InfoRet::ADDED)
+        {
+          auto writerLock = LockWriter();
           m_database.SetPathHash(pItem->GetPath(), pItem->GetProperty("hash").asString());
+        }
         return ret;
       }
       return InfoRet::ADDED;
@@ -908,6 +1147,7 @@ CVideoInfoScanner::~CVideoInfoScanner()
               RetrieveInfoForEpisodes(pItem, lResult, info2, useLocal, pDlgProgress, true);
           if (ret == InfoRet::ADDED)
           {
+            auto writerLock = LockWriter();
             m_database.SetPathHash(pItem->GetPath(), pItem->GetProperty("hash").asString());
             return InfoRet::ADDED;
           }
@@ -937,7 +1177,10 @@ CVideoInfoScanner::~CVideoInfoScanner()
     {
       InfoRet ret = RetrieveInfoForEpisodes(pItem, lResult, info2, useLocal, pDlgProgress, true);
       if (ret == InfoRet::ADDED)
+      {
+        auto writerLock = LockWriter();
         m_database.SetPathHash(pItem->GetPath(), pItem->GetProperty("hash").asString());
+      }
     }
     return InfoRet::ADDED;
   }
@@ -1006,7 +1249,10 @@ CVideoInfoScanner::~CVideoInfoScanner()
       }
 
       // Set version (AddVideo() ultimately uses CVideoDatabase::AddNewMovie() which defaults to standard version)
-      m_database.SetVideoVersion(tag->m_iFileId, tag->GetAssetInfo().GetId());
+      {
+        auto writerLock = LockWriter();
+        m_database.SetVideoVersion(tag->m_iFileId, tag->GetAssetInfo().GetId());
+      }
 
       // Look for default version
       int defaultVersionFileId{-1};
@@ -1036,8 +1282,11 @@ CVideoInfoScanner::~CVideoInfoScanner()
 
       // Set default version
       if (defaultVersionFileId > -1)
+      {
+        auto writerLock = LockWriter();
         m_database.SetDefaultVideoVersion(VideoDbContentType::MOVIES, movieId,
                                           defaultVersionFileId);
+      }
 
       return InfoRet::ADDED;
     }
@@ -1231,6 +1480,7 @@ CVideoInfoScanner::~CVideoInfoScanner()
         if (!alreadyHasArt && !item->IsPlugin() && scraper->ID() != "metadata.local")
         {
           CVideoInfoDownloader loader(scraper);
+          auto scraperLock = LockScraper();
           loader.GetArtwork(showInfo);
         }
         const UseRemoteArtWithLocalScraper useRemoteArt{
@@ -1239,6 +1489,7 @@ CVideoInfoScanner::~CVideoInfoScanner()
                 : UseRemoteArtWithLocalScraper::YES};
         GetSeasonThumbs(showInfo, seasonArt, CVideoThumbLoader::GetArtTypes(MediaTypeSeason),
                         useLocal && !item->IsPlugin(), useRemoteArt);
+        auto writerLock = LockWriter();
         for (const auto& [season, art] : seasonArt)
         {
           const int seasonID{m_database.AddSeason(static_cast<int>(showID), season)};
@@ -1544,7 +1795,7 @@ CVideoInfoScanner::~CVideoInfoScanner()
     for (unsigned int i=0;i<expression.size();++i)
     {
       CRegExp reg(true, CRegExp::autoUtf8);
-      if (!reg.RegComp(expression[i].regexp))
+      if (!reg.RegComp(expression[i].regexp, CRegExp::StudyWithJitComp))
         continue;
 
       int regexppos, regexp2pos;
@@ -1627,7 +1878,8 @@ CVideoInfoScanner::~CVideoInfoScanner()
 
       CRegExp reg2(true, CRegExp::autoUtf8);
       // check the remainder of the string for any further episodes.
-      if (!byDate && reg2.RegComp(m_advancedSettings->m_tvshowMultiPartEnumRegExp))
+      if (!byDate &&
+          reg2.RegComp(m_advancedSettings->m_tvshowMultiPartEnumRegExp, CRegExp::StudyWithJitComp))
       {
         int offset{0};
         int currentSeason{episode.iSeason};
@@ -1795,6 +2047,8 @@ CVideoInfoScanner::~CVideoInfoScanner()
 
     CLog::LogF(LOGDEBUG, "Adding new set {}", set.GetTitle());
 
+    auto writerLock = LockWriter();
+
     // Create set
     const int idSet{m_database.AddSet(set.GetTitle(), set.GetOverview(), set.GetOriginalTitle())};
 
@@ -1817,6 +2071,9 @@ CVideoInfoScanner::~CVideoInfoScanner()
     if (!m_database.Open())
       return -1;
 
+    // workers of a concurrent scan add their items one at a time
+    auto writerLock = LockWriter();
+
     const ContentType content{
         !scraper || contentOverride != ContentType::NONE ? contentOverride : scraper->Content()};
     const bool usingLocalScraper{scraper && scraper->ID() == "metadata.local"};
@@ -1868,6 +2125,7 @@ CVideoInfoScanner::~CVideoInfoScanner()
      * missing.  If we have already read an nfo file then this data should be populated, otherwise
      * get it from the video file */
 
+    bool probeLater = false;
     if (CServiceBroker::GetSettingsComponent()->GetSettings()->GetBool(
             CSettings::SETTING_MYVIDEOS_EXTRACTFLAGS))
     {
@@ -1876,9 +2134,15 @@ CVideoInfoScanner::~CVideoInfoScanner()
           strmdetails.GetVideoWidth(1) == 0 || strmdetails.GetVideoDuration(1) == 0)
 
       {
-        CDVDFileInfo::GetFileStreamDetails(pItem);
-        CLog::Log(LOGDEBUG, "VideoInfoScanner: Extracted filestream details from video file {}",
-                  CURL::GetRedacted(path));
+        // files are probed in the background once they were added, if a scan is running
+        if (m_shared->prober && !pItem->IsFolder())
+          probeLater = true;
+        else
+        {
+          CDVDFileInfo::GetFileStreamDetails(pItem);
+          CLog::Log(LOGDEBUG, "VideoInfoScanner: Extracted filestream details from video file {}",
+                    CURL::GetRedacted(path));
+        }
       }
     }
 
@@ -2017,6 +2281,15 @@ CVideoInfoScanner::~CVideoInfoScanner()
         m_database.AddBookMarkToFile(path, movieDetails.GetResumePoint(), CBookmark::RESUME);
     }
 
+    if (probeLater && lResult > 0)
+    {
+      const int idFile =
+          movieDetails.m_iFileId > 0 ? movieDetails.m_iFileId : m_database.AddFile(movieDetails);
+      if (idFile > 0)
+        m_shared->prober->Probe(idFile, *pItem);
+      WriteStreamDetails(STREAMDETAILS_PER_COMMIT);
+    }
+
     m_database.Close();
 
     CFileItemPtr itemCopy = std::make_shared<CFileItem>(*pItem);
@@ -2294,7 +2567,7 @@ CVideoInfoScanner::~CVideoInfoScanner()
         pDlgProgress->SetPercentage((int)((float)(iCurr++)/iMax*100));
         pDlgProgress->Progress();
       }
-      if (m_handle)
+      if (m_handle && !m_isWorker)
         m_handle->SetPercentage(100.f*iCurr++/iMax);
 
       if ((pDlgProgress && pDlgProgress->IsCanceled()) || m_bStop)
@@ -2352,6 +2625,7 @@ CVideoInfoScanner::~CVideoInfoScanner()
           }
 
           CVideoInfoDownloader imdb(scraper);
+          auto scraperLock = LockScraper();
           if (!imdb.GetEpisodeList(url, episodes))
             return InfoRet::NOT_FOUND;
 
@@ -2472,9 +2746,12 @@ CVideoInfoScanner::~CVideoInfoScanner()
         CVideoInfoDownloader imdb(scraper);
         CFileItem scraperItem;
         scraperItem.SetPath(file->strPath);
-        if (!imdb.GetEpisodeDetails(guide->cScraperUrl, *scraperItem.GetVideoInfoTag(),
-                                    pDlgProgress))
-          return InfoRet::NOT_FOUND; //! @todo should we just skip to the next episode?
+        {
+          auto scraperLock = LockScraper();
+          if (!imdb.GetEpisodeDetails(guide->cScraperUrl, *scraperItem.GetVideoInfoTag(),
+                                      pDlgProgress))
+            return InfoRet::NOT_FOUND; //! @todo should we just skip to the next episode?
+        }
 
         if (result == InfoType::COMBINED || result == InfoType::OVERRIDE)
           scraperItem.GetVideoInfoTag()->Merge(*item.GetVideoInfoTag());
@@ -2514,7 +2791,9 @@ CVideoInfoScanner::~CVideoInfoScanner()
       m_handle->SetText(url.GetTitle());
 
     CVideoInfoDownloader imdb(scraper);
+    std::unique_lock scraperLock = LockScraper();
     bool ret = imdb.GetDetails(uniqueIDs, url, movieDetails, pDialog);
+    scraperLock.unlock();
 
     if (ret)
     {
@@ -2815,7 +3094,9 @@ CVideoInfoScanner::~CVideoInfoScanner()
   {
     MOVIELIST movielist;
     CVideoInfoDownloader imdb(scraper);
+    std::unique_lock scraperLock = LockScraper();
     int returncode = imdb.FindMovie(title, year, movielist, progress);
+    scraperLock.unlock();
     if (returncode < 0 || (returncode == 0 && (m_bStop || !DownloadFailed(progress))))
     { // scraper reported an error, or we had an error and user wants to cancel the scan
       m_bStop = true;
@@ -2866,8 +3147,10 @@ CVideoInfoScanner::~CVideoInfoScanner()
           const std::string extraTypeName =
               CGUIDialogVideoManagerExtras::GenerateVideoExtra(path, item->GetPath());
 
+          auto writerLock = LockWriter();
           const int idVideoAssetType = m_database.AddVideoVersionType(
               extraTypeName, VideoAssetTypeOwner::AUTO, VideoAssetType::EXTRA);
+          writerLock.unlock();
 
           // the video may have been added to the library as a movie earlier (different settings)
           const int idMovie{m_database.GetMovieId(item->GetPath())};
@@ -2885,6 +3168,7 @@ CVideoInfoScanner::~CVideoInfoScanner()
 
             GetArtwork(item.get(), content, true, true, "");
 
+            writerLock.lock();
             if (m_database.AddVideoAsset(ContentToVideoDbType(content), dbId, idVideoAssetType,
                                          VideoAssetType::EXTRA, *item.get()))
             {
@@ -2899,6 +3183,7 @@ CVideoInfoScanner::~CVideoInfoScanner()
           }
           else
           {
+            writerLock.lock();
             m_database.ConvertVideoToVersion(ContentToVideoDbType(content), idMovie, dbId,
                                              idVideoAssetType, VideoAssetType::EXTRA,
                                              DeleteMovieCascadeAction::ALL_ASSETS);
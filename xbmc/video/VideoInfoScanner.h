@@ -12,8 +12,12 @@
 #include "VideoDatabase.h"
 #include "addons/Scraper.h"
 #include "guilib/GUIListItem.h"
+#include "threads/CriticalSection.h"
 #include "utils/Artwork.h"
 
+#include <chrono>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <vector>
@@ -25,6 +29,7 @@ class CFileItemList;
 
 namespace KODI::VIDEO
 {
+  class CStreamDetailsProber;
   class IVideoInfoTagLoader;
   class ISetInfoTagLoader;
 
@@ -91,6 +96,12 @@ namespace KODI::VIDEO
                   bool libraryImport = false,
                   ADDON::ContentType contentOverride = ADDON::ContentType::NONE);
 
+    /*! \brief Get the database items are added to.
+     Lets a library import write everything it adds within a single bulk import session.
+     \return the database of this scanner.
+     */
+    CVideoDatabase& GetDatabase() { return m_database; }
+
     /*! \brief Retrieve information for a list of items and add them to the database.
      \param items list of items to retrieve info for.
      \param bDirNames whether we should use folder or file names for lookups.
@@ -321,13 +332,58 @@ namespace KODI::VIDEO
     std::pair<InfoType, std::unique_ptr<IVideoInfoTagLoader>> ReadInfoTag(
         CFileItem& item, const ADDON::ScraperPtr& scraper, bool lookInFolder, bool resetTag);
 
+    /*! \brief Scan the paths to scan one after another
+     \return false if the scan was cancelled, true otherwise
+     */
+    bool ScanPaths();
+
+    /*! \brief Scan the paths to scan with a worker per storage device or host
+     Paths on the same device or host are scanned one after another by the same worker, so a slow
+     remote source doesn't hold up the others. Each worker uses its own database connection,
+     items are added and scrapers are called by one worker at a time.
+     \param maxWorkers maximum number of workers running at once
+     \return false if the scan was cancelled, true otherwise
+     */
+    bool ScanConcurrently(int maxWorkers);
+
+    /*! \brief Wait until the scraper may be called, shared by all workers of a scan
+     \return lock to hold while calling the scraper
+     */
+    std::unique_lock<CCriticalSection> LockScraper();
+
+    /*! \brief Wait until no other worker of the scan writes to the database
+     \return lock to hold while writing to the database
+     */
+    std::unique_lock<CCriticalSection> LockWriter();
+
+    /*! \brief Write the stream details probed so far to the database
+     Must be called with the writer section held.
+     \param minResults write only if at least this many files were probed
+     */
+    void WriteStreamDetails(size_t minResults);
+
+    //! \brief State shared by the workers of a concurrent scan
+    struct SharedState
+    {
+      CCriticalSection writerSection; //!< Held while writing to the database
+      CCriticalSection scraperSection; //!< Held while calling a scraper
+      std::chrono::steady_clock::time_point nextScraperCall; //!< Earliest next scraper call
+      std::unique_ptr<CStreamDetailsProber> prober; //!< Probes stream details of added files
+    };
+
+    class CSourceWorker;
+
     bool m_bStop;
     bool m_scanAll;
     bool m_ignoreVideoVersions{false};
     bool m_ignoreVideoExtras{false};
+    bool m_isWorker{false}; //!< Worker of a concurrent scan, the overall progress is set by its owner
     CVideoDatabase m_database;
     std::set<int> m_pathsToClean;
     std::shared_ptr<CAdvancedSettings> m_advancedSettings;
     CVideoDatabase::ScraperCache m_scraperCache;
+    std::shared_ptr<SharedState> m_shared;
+    CCriticalSection m_workersSection;
+    std::vector<CVideoInfoScanner*> m_workers; //!< Workers of a concurrent scan, to stop them
   };
   } // namespace KODI::VIDEO
@@ -0,0 +1,67 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "VideoThumbExtractor.h"
+
+#include "ServiceBroker.h"
+#include "cores/VideoPlayer/DVDFileInfo.h"
+#include "guilib/Texture.h"
+#include "utils/CPUInfo.h"
+
+#include <algorithm>
+#include <mutex>
+
+using namespace KODI::VIDEO;
+
+namespace
+{
+// decoding runs single threaded, leave some cores to the GUI
+constexpr unsigned int MAX_EXTRACTIONS = 4;
+
+unsigned int GetMaxExtractions()
+{
+  const auto cpuInfo = CServiceBroker::GetCPUInfo();
+  const int cpus = cpuInfo ? cpuInfo->GetCPUCount() : 1;
+  return std::clamp(static_cast<unsigned int>(cpus / 2), 1u, MAX_EXTRACTIONS);
+}
+} // unnamed namespace
+
+CVideoThumbExtractor& CVideoThumbExtractor::GetInstance()
+{
+  static CVideoThumbExtractor extractor;
+  return extractor;
+}
+
+CVideoThumbExtractor::CVideoThumbExtractor() : m_maxRunning(GetMaxExtractions())
+{
+}
+
+std::unique_ptr<CTexture> CVideoThumbExtractor::Extract(const CFileItem& item, int chapter)
+{
+  {
+    std::unique_lock lock(m_critSection);
+    const uint64_t ticket = m_nextTicket++;
+    m_waiting.push_back(ticket);
+    m_changed.wait(lock,
+                   [this, ticket] { return m_running < m_maxRunning && m_waiting.back() == ticket; });
+    m_waiting.pop_back();
+    m_running++;
+  }
+  // the next newest request may be able to start as well
+  m_changed.notifyAll();
+
+  auto texture = CDVDFileInfo::ExtractThumbToTexture(item, chapter);
+
+  {
+    std::unique_lock lock(m_critSection);
+    m_running--;
+  }
+  m_changed.notifyAll();
+
+  return texture;
+}
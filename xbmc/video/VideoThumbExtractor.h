@@ -0,0 +1,57 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/Condition.h"
+#include "threads/CriticalSection.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class CFileItem;
+class CTexture;
+
+namespace KODI::VIDEO
+{
+
+/*!
+ \brief Extracts thumbnails and chapter images of video files, a few at a time.
+
+ Every extraction opens the file, seeks and decodes a frame, which is expensive in both CPU and
+ I/O. Images are requested by the texture cache from any number of job threads, so without a limit
+ scrolling through a large list starts dozens of extractions at once. Only a few run at a time,
+ and waiting requests are served newest first: the newest ones are for the items that just
+ scrolled into view, older ones are likely for items that are not visible anymore.
+ */
+class CVideoThumbExtractor
+{
+public:
+  static CVideoThumbExtractor& GetInstance();
+
+  /*!
+   \brief Extract a thumbnail, waiting for a free decoder if needed
+   \param item the video file
+   \param chapter the chapter to extract the image of, 0 for a frame about 1/3 into the video
+   \return the image, empty if it could not be extracted
+   */
+  std::unique_ptr<CTexture> Extract(const CFileItem& item, int chapter);
+
+private:
+  CVideoThumbExtractor();
+
+  const unsigned int m_maxRunning;
+  CCriticalSection m_critSection;
+  XbmcThreads::ConditionVariable m_changed;
+  unsigned int m_running{0};
+  uint64_t m_nextTicket{0};
+  std::vector<uint64_t> m_waiting; //!< tickets of the waiting requests, newest last
+};
+
+} // namespace KODI::VIDEO
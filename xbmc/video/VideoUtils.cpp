@@ -85,7 +85,7 @@ std::string FindTrailer(const CFileItem& item)
 
   for (const auto& strRegExp : strMatchRegExps)
   {
-    if (tmpRegExp.RegComp(strRegExp))
+    if (tmpRegExp.RegComp(strRegExp, CRegExp::StudyWithJitComp))
       matchRegExps.push_back(tmpRegExp);
   }
 
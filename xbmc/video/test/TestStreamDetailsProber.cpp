@@ -0,0 +1,155 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileItem.h"
+#include "threads/Event.h"
+#include "utils/StreamDetails.h"
+#include "video/StreamDetailsProber.h"
+#include "video/VideoInfoTag.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace KODI::VIDEO;
+using namespace std::chrono_literals;
+
+namespace
+{
+CFileItem MakeItem(int id)
+{
+  return CFileItem("/videos/" + std::to_string(id) + ".mkv", false);
+}
+
+bool ProbeWidth(CFileItem& item)
+{
+  auto* video = new CStreamDetailVideo();
+  video->m_iWidth = 1920;
+  item.GetVideoInfoTag()->m_streamDetails.AddStream(video);
+  return true;
+}
+
+std::vector<CStreamDetailsProber::Result> TakeSortedResults(CStreamDetailsProber& prober)
+{
+  auto results = prober.TakeResults();
+  std::sort(results.begin(), results.end(),
+            [](const auto& a, const auto& b) { return a.idFile < b.idFile; });
+  return results;
+}
+} // unnamed namespace
+
+TEST(TestStreamDetailsProber, ProbesQueuedFiles)
+{
+  CStreamDetailsProber prober(2, 4, ProbeWidth);
+  for (int i = 1; i <= 10; ++i)
+    prober.Probe(i, MakeItem(i));
+
+  ASSERT_TRUE(prober.Wait(5s));
+  const auto results = TakeSortedResults(prober);
+  ASSERT_EQ(10u, results.size());
+  for (int i = 0; i < 10; ++i)
+  {
+    EXPECT_EQ(i + 1, results[i].idFile);
+    EXPECT_EQ(1920, results[i].details.GetVideoWidth(1));
+  }
+  EXPECT_TRUE(prober.TakeResults().empty());
+}
+
+TEST(TestStreamDetailsProber, FailedProbesHaveNoResult)
+{
+  CStreamDetailsProber prober(2, 4,
+                              [](CFileItem& item)
+                              { return item.GetPath() != "/videos/2.mkv" && ProbeWidth(item); });
+  for (int i = 1; i <= 3; ++i)
+    prober.Probe(i, MakeItem(i));
+
+  ASSERT_TRUE(prober.Wait(5s));
+  const auto results = TakeSortedResults(prober);
+  ASSERT_EQ(2u, results.size());
+  EXPECT_EQ(1, results[0].idFile);
+  EXPECT_EQ(3, results[1].idFile);
+}
+
+// The scanner waits for the queue instead of cancelling it when a scan is cancelled, the files
+// queued are in the library already and would be skipped by the next scan
+TEST(TestStreamDetailsProber, WaitProbesAllQueuedFiles)
+{
+  CStreamDetailsProber prober(1, 8,
+                              [](CFileItem& item)
+                              {
+                                std::this_thread::sleep_for(10ms);
+                                return ProbeWidth(item);
+                              });
+  for (int i = 1; i <= 8; ++i)
+    prober.Probe(i, MakeItem(i));
+
+  while (!prober.Wait(100ms))
+    ;
+  EXPECT_EQ(8u, prober.GetResultCount());
+}
+
+TEST(TestStreamDetailsProber, CancelDropsQueuedFiles)
+{
+  CEvent started;
+  CEvent release(true);
+  CStreamDetailsProber prober(1, 8,
+                              [&](CFileItem& item)
+                              {
+                                started.Set();
+                                release.Wait(5s);
+                                return ProbeWidth(item);
+                              });
+  prober.Probe(1, MakeItem(1));
+  ASSERT_TRUE(started.Wait(5s));
+  prober.Probe(2, MakeItem(2));
+  prober.Probe(3, MakeItem(3));
+
+  // the file being probed is finished, the queued ones are dropped
+  prober.Cancel();
+  release.Set();
+  ASSERT_TRUE(prober.Wait(5s));
+  const auto results = TakeSortedResults(prober);
+  ASSERT_EQ(1u, results.size());
+  EXPECT_EQ(1, results[0].idFile);
+}
+
+TEST(TestStreamDetailsProber, ProbeBlocksWhileFull)
+{
+  CEvent started;
+  CEvent release(true);
+  CStreamDetailsProber prober(1, 2,
+                              [&](CFileItem& item)
+                              {
+                                started.Set();
+                                release.Wait(5s);
+                                return ProbeWidth(item);
+                              });
+  prober.Probe(1, MakeItem(1));
+  ASSERT_TRUE(started.Wait(5s));
+  prober.Probe(2, MakeItem(2));
+
+  std::atomic<bool> queued{false};
+  std::thread producer(
+      [&]
+      {
+        prober.Probe(3, MakeItem(3));
+        queued = true;
+      });
+  std::this_thread::sleep_for(50ms);
+  EXPECT_FALSE(queued);
+
+  release.Set();
+  producer.join();
+  EXPECT_TRUE(queued);
+  ASSERT_TRUE(prober.Wait(5s));
+  EXPECT_EQ(3u, prober.GetResultCount());
+}
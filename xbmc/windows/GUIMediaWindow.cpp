@@ -320,6 +320,18 @@ bool CGUIMediaWindow::OnMessage(CGUIMessage& message)
     }
     break;
 
+  case GUI_MSG_DIRECTORY_ITEMS:
+    {
+      // shown until the complete listing replaces them
+      const auto batch = std::static_pointer_cast<CFileItemList>(message.GetItem());
+      if (m_listingItems && batch && message.GetParam1() == m_listingId)
+      {
+        m_listingItems->Append(*batch);
+        m_viewControl.SetItems(*m_listingItems);
+      }
+      return true;
+    }
+
   case GUI_MSG_SETFOCUS:
     {
       if (m_viewControl.HasControl(message.GetControlId()) && m_viewControl.GetCurrentControl() != message.GetControlId())
@@ -2208,6 +2220,21 @@ bool CGUIMediaWindow::GetDirectoryItems(CURL &url, CFileItemList &items, bool us
     bool ret = true;
     CGetDirectoryItems getItems(m_rootDir, url, items, useDir);
 
+    // directories listing their items incrementally (plugins) pass them on in batches, show them
+    // while the busy dialog waits for the complete listing
+    const int listingId = ++m_listingId;
+    const int windowId = GetID();
+    m_listingItems = std::make_unique<CFileItemList>();
+    m_rootDir.SetItemsCallback(
+        [listingId, windowId](const CFileItemList& batch, bool final)
+        {
+          auto items = std::make_shared<CFileItemList>();
+          items->Assign(batch);
+          CGUIMessage msg(GUI_MSG_DIRECTORY_ITEMS, windowId, 0, listingId, final ? 1 : 0);
+          msg.SetItem(items);
+          CServiceBroker::GetGUI()->GetWindowManager().SendThreadMessage(msg, windowId);
+        });
+
     if (!CGUIDialogBusy::Wait(&getItems, 100, true))
     {
       // cancelled
@@ -2226,7 +2253,11 @@ bool CGUIMediaWindow::GetDirectoryItems(CURL &url, CFileItemList &items, bool us
       }
     }
 
+    m_rootDir.SetItemsCallback({});
     m_rootDir.ReleaseDirImpl();
+    // the view must not keep pointing at the partial listing once it is gone
+    m_viewControl.SetItems(*m_vecItems);
+    m_listingItems.reset();
     return ret;
   }
   else
@@ -187,6 +187,8 @@ protected:
   CDirectoryHistory m_history;
   std::unique_ptr<CGUIViewState> m_guiState;
   std::atomic_bool m_vecItemsUpdating = {false};
+  std::unique_ptr<CFileItemList> m_listingItems; ///< items shown while a directory is listed
+  int m_listingId = 0;
   class CUpdateGuard
   {
   public:
@@ -20,6 +20,7 @@
 #include "guilib/GUITextLayout.h"
 #include "guilib/GUIWindowManager.h"
 #include "input/WindowTranslator.h"
+#include "messaging/ApplicationMessenger.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/CPUInfo.h"
@@ -129,6 +130,10 @@ void CGUIWindowDebugInfo::Process(unsigned int currentTime, CDirtyRegionList &di
                                    .GetFPS(),
                                strCores, ucAppName, dCPU, profiling);
 #endif
+
+    const auto appMessenger = CServiceBroker::GetAppMessenger();
+    if (appMessenger && appMessenger->IsLatencyTracing())
+      info += "\n" + appMessenger->GetLatencyTracer().GetSummary();
   }
 
   // render the skin debug info